@@ -11,6 +11,8 @@ addSubdirs( src/OpenMesh/Tools , src/OpenMesh/Core )
 addSubdirs( src/OpenMesh/Apps/commandlineDecimater , src/OpenMesh/Core src/OpenMesh/Tools)
 addSubdirs( src/OpenMesh/Apps/Decimating/DecimaterGui , src/OpenMesh/Core src/OpenMesh/Tools)
 addSubdirs( src/OpenMesh/Apps/mconvert , src/OpenMesh/Core src/OpenMesh/Tools)
+addSubdirs( src/OpenMesh/Apps/ReaderBenchmark , src/OpenMesh/Core src/OpenMesh/Tools)
+addSubdirs( src/OpenMesh/Apps/VectorBenchmark , src/OpenMesh/Core src/OpenMesh/Tools)
 addSubdirs( src/OpenMesh/Apps/QtViewer , src/OpenMesh/Core src/OpenMesh/Tools)
 addSubdirs( src/OpenMesh/Apps/Smoothing , src/OpenMesh/Core src/OpenMesh/Tools)
 addSubdirs( src/OpenMesh/Apps/Subdivider/commandlineSubdivider , src/OpenMesh/Core src/OpenMesh/Tools)
@@ -120,6 +120,7 @@ struct DecOptions
 
   CmdOption<bool>        decorate_name;
   CmdOption<float>       n_collapses;
+  CmdOption<bool>        optimal_placement;
 
   CmdOption<float>       AR;   // Aspect ratio
   CmdOption<float>       EL;   // Edge length
@@ -332,6 +333,9 @@ decimate(const std::string &_ifname,
              !decimater.module(modQ).is_binary());
      }
 
+     if ( _opt.optimal_placement.is_enabled() )
+       decimater.set_collapse_mode( DecimaterType::OptimalPlacement );
+
      // ---- 3 - initialize decimater
 
      if (gverbose)
@@ -447,7 +451,7 @@ int main(int argc, char* argv[])
   {
     int c;
 
-    while ( (c=getopt( argc, argv, "dDhi:M:n:o:v")) != -1 )
+    while ( (c=getopt( argc, argv, "dDhi:M:n:o:Pv")) != -1 )
     {
       switch (c)
       {
@@ -458,6 +462,7 @@ int main(int argc, char* argv[])
         case 'M': opt.parse_argument( optarg ); break;
         case 'n': opt.n_collapses   = float(atof(optarg)); break;
         case 'o': ofname            = optarg; break;
+        case 'P': opt.optimal_placement = true; break;
         case 'v': gverbose          = true;   break;
         case '?':
         default:
@@ -535,6 +540,9 @@ void usage_and_exit(int xcode)
             << "    N >= 1: do N halfedge collapses.\n"
             << "    N <=-1: decimate down to |N| vertices.\n"
             << " 0 < N < 1: decimate down to N%.\n" << std::endl;
+  std::cerr << " -P\n"
+            << "    Collapse edges to the optimal position of the quadrics\n"
+            << "    instead of halfedges (requires Q, not with PM).\n" << std::endl;
   std::cerr << std::endl;
   std::cerr << "Modules:\n\n";
   std::cerr << "  AR[:ratio]      - ModAspectRatio\n";
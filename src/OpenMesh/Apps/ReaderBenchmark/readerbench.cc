@@ -0,0 +1,233 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+//=============================================================================
+//
+//  Reader benchmark: allocation counts and timings of mesh import
+//
+//=============================================================================
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <string>
+#include <cstdlib>
+#include <new>
+//
+#include <OpenMesh/Core/IO/MeshIO.hh>
+#include <OpenMesh/Core/Mesh/TriMesh_ArrayKernelT.hh>
+#include <OpenMesh/Tools/Utils/Timer.hh>
+#include <OpenMesh/Tools/Utils/getopt.h>
+
+
+// ----------------------------------------------------------------------------
+
+// Count all heap allocations of the process by replacing the global
+// operators new and delete.
+
+static size_t n_allocations = 0;
+static size_t n_bytes       = 0;
+
+#if __cplusplus >= 201103L
+#  define BAD_ALLOC_SPEC
+#else
+#  define BAD_ALLOC_SPEC throw(std::bad_alloc)
+#endif
+
+void* operator new(size_t _size) BAD_ALLOC_SPEC
+{
+  ++n_allocations;
+  n_bytes += _size;
+  void* p = std::malloc(_size ? _size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](size_t _size) BAD_ALLOC_SPEC
+{
+  return operator new(_size);
+}
+
+void operator delete(void* _p) throw()   { std::free(_p); }
+void operator delete[](void* _p) throw() { std::free(_p); }
+
+#if __cplusplus >= 201402L
+void operator delete(void* _p, size_t) throw()   { std::free(_p); }
+void operator delete[](void* _p, size_t) throw() { std::free(_p); }
+#endif
+
+
+// ----------------------------------------------------------------------------
+
+
+struct MyTraits : public OpenMesh::DefaultTraits
+{
+  VertexAttributes  ( OpenMesh::Attributes::Normal       |
+		      OpenMesh::Attributes::Color        |
+                      OpenMesh::Attributes::TexCoord2D   );
+  FaceAttributes    ( OpenMesh::Attributes::Color        );
+};
+
+typedef OpenMesh::TriMesh_ArrayKernelT<MyTraits> MyMesh;
+
+
+// ----------------------------------------------------------------------------
+
+
+void usage_and_exit(int xcode)
+{
+   using std::cout;
+   using std::endl;
+
+   cout << "\nUsage: readerbench [-r <runs>] [-c] [-n] [-t] <input>\n\n";
+   cout << "   Read <input> several times and report the number of heap\n"
+        << "   allocations and the time per read, once with the working\n"
+        << "   storage of each importer and once with a scratch context\n"
+        << "   shared by all reads.\n"
+        << endl;
+   cout << "Options:\n"
+        << endl;
+   cout << "  -r <runs>\tNumber of reads per mode (default 10).\n" << endl;
+   cout << "  -c\tRead vertex colors if provided by input.\n" << endl;
+   cout << "  -n\tRead vertex normals if provided by input.\n" << endl;
+   cout << "  -t\tRead vertex texture coordinates if provided by input.\n"
+        << endl;
+
+   exit(xcode);
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+// read _runs times, if _scratch is given it is shared by all reads
+bool benchmark(const std::string& _name, const std::string& _filename,
+               const OpenMesh::IO::Options& _opt, int _runs,
+               OpenMesh::IO::ImportScratch* _scratch)
+{
+  MyMesh                  mesh;
+  OpenMesh::Utils::Timer  timer;
+  size_t                  allocations(0), bytes(0);
+
+  mesh.request_vertex_normals();
+  mesh.request_vertex_colors();
+  mesh.request_vertex_texcoords2D();
+  mesh.request_face_colors();
+
+  for (int i=0; i<_runs; ++i)
+  {
+    OpenMesh::IO::Options opt(_opt);
+
+    mesh.clear();
+
+    size_t a(n_allocations), b(n_bytes);
+    timer.cont();
+
+    bool rc = _scratch
+      ? OpenMesh::IO::read_mesh(mesh, _filename, opt, *_scratch, false)
+      : OpenMesh::IO::read_mesh(mesh, _filename, opt, false);
+
+    timer.stop();
+    allocations += n_allocations - a;
+    bytes       += n_bytes - b;
+
+    if (!rc)
+    {
+      std::cerr << "Error reading " << _filename << std::endl;
+      return false;
+    }
+  }
+
+  std::cout << std::setw(16) << std::left << _name << std::right
+            << std::setw(12) << allocations / _runs << " allocations"
+            << std::setw(14) << bytes / _runs       << " bytes"
+            << "   " << timer.as_string(OpenMesh::Utils::Timer::MSeconds)
+            << " / " << _runs << " reads" << std::endl;
+
+  return true;
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+int main(int argc, char *argv[] )
+{
+  int c;
+  int runs = 10;
+  OpenMesh::IO::Options opt;
+
+  while ( (c=getopt(argc, argv, "cnr:th"))!=-1 )
+  {
+    switch(c)
+    {
+      case 'c': opt += OpenMesh::IO::Options::VertexColor;    break;
+      case 'n': opt += OpenMesh::IO::Options::VertexNormal;   break;
+      case 't': opt += OpenMesh::IO::Options::VertexTexCoord; break;
+      case 'r': runs = std::max(1, atoi(optarg));             break;
+      case 'h':
+        usage_and_exit(0);
+      case '?':
+      default:
+        usage_and_exit(1);
+    }
+  }
+
+  if (optind >= argc)
+    usage_and_exit(1);
+
+  std::string filename = argv[optind];
+
+  // keep the reader's log out of the measurement
+  omlog().disable();
+
+  std::cout << "Reading " << filename << " (averages per read)\n";
+
+  OpenMesh::IO::ImportScratch scratch;
+
+  if (!benchmark("own storage", filename, opt, runs, 0))
+    return 1;
+
+  if (!benchmark("shared scratch", filename, opt, runs, &scratch))
+    return 1;
+
+  return 0;
+}
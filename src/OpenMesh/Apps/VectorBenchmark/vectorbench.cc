@@ -0,0 +1,266 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+//=============================================================================
+//
+//  Vector benchmark: timings of the common VectorT kernels
+//
+//=============================================================================
+
+// The SIMD specializations of VectorT are compared with the generic code by
+// building this file twice, as vectorbench and as vectorbench-scalar (with
+// OM_VECTOR_NO_SIMD). The padded Vec3fa/Vec3da are measured in both.
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdlib>
+//
+#include <OpenMesh/Core/Geometry/VectorT.hh>
+#include <OpenMesh/Core/Geometry/AlignedVectorT.hh>
+#include <OpenMesh/Tools/Utils/Timer.hh>
+#include <OpenMesh/Tools/Utils/getopt.h>
+
+
+// ----------------------------------------------------------------------------
+
+
+void usage_and_exit(int xcode)
+{
+   using std::cout;
+   using std::endl;
+
+   cout << "\nUsage: vectorbench [-n <size>] [-r <runs>]\n\n";
+   cout << "   Run the common vector kernels on arrays of Vec3f, Vec3fa,\n"
+        << "   Vec4f, Vec3d, Vec3da and Vec4d and report the time per\n"
+        << "   element.\n"
+        << endl;
+   cout << "Options:\n"
+        << endl;
+   cout << "  -n <size>\tNumber of vectors per array (default 10000).\n" << endl;
+   cout << "  -r <runs>\tNumber of passes per kernel (default 1000).\n" << endl;
+
+   exit(xcode);
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+// result of a kernel, printed to keep the compiler from dropping the loops
+static double sink = 0.0;
+
+
+template <class Vec>
+struct Kernels
+{
+  typedef typename Vec::value_type Scalar;
+
+  static void axpy(std::vector<Vec>& _c, const std::vector<Vec>& _a,
+                   const std::vector<Vec>& _b)
+  {
+    const Scalar s(0.5);
+    for (size_t i=0; i<_c.size(); ++i)
+      _c[i] = _a[i] + _b[i] * s;
+  }
+
+  static void dot(std::vector<Vec>& _c, const std::vector<Vec>& _a,
+                  const std::vector<Vec>& _b)
+  {
+    Scalar s(0);
+    for (size_t i=0; i<_c.size(); ++i)
+      s += (_a[i] | _b[i]);
+    sink += s;
+  }
+
+  static void normalize(std::vector<Vec>& _c, const std::vector<Vec>& _a,
+                        const std::vector<Vec>& /* _b */)
+  {
+    for (size_t i=0; i<_c.size(); ++i)
+      (_c[i] = _a[i]).normalize();
+  }
+
+  static void bbox(std::vector<Vec>& _c, const std::vector<Vec>& _a,
+                   const std::vector<Vec>& /* _b */)
+  {
+    Vec bb_min(_a[0]), bb_max(_a[0]);
+    for (size_t i=1; i<_a.size(); ++i)
+    {
+      bb_min.minimize(_a[i]);
+      bb_max.maximize(_a[i]);
+    }
+    _c[0] = bb_min;
+    _c[1] = bb_max;
+  }
+
+  static void cross(std::vector<Vec>& _c, const std::vector<Vec>& _a,
+                    const std::vector<Vec>& _b)
+  {
+    for (size_t i=0; i<_c.size(); ++i)
+      _c[i] = _a[i] % _b[i];
+  }
+
+  // normals of the triangles (a[i], b[i], a[i+1])
+  static void face_normal(std::vector<Vec>& _c, const std::vector<Vec>& _a,
+                          const std::vector<Vec>& _b)
+  {
+    for (size_t i=0; i+1<_c.size(); ++i)
+    {
+      _c[i] = (_b[i] - _a[i]) % (_a[i+1] - _a[i]);
+      _c[i].normalize_cond();
+    }
+  }
+};
+
+
+// ----------------------------------------------------------------------------
+
+
+template <class Vec>
+class Benchmark
+{
+public:
+
+  typedef typename Vec::value_type Scalar;
+  typedef void (*Kernel)(std::vector<Vec>&, const std::vector<Vec>&,
+                         const std::vector<Vec>&);
+
+  Benchmark(const std::string& _name, size_t _n, int _runs)
+    : name_(_name), a_(_n), b_(_n), c_(_n), runs_(_runs)
+  {
+    srand(42);
+    for (size_t i=0; i<_n; ++i)
+      for (size_t j=0; j<Vec::size(); ++j)
+      {
+        a_[i][j] = Scalar(rand()) / Scalar(RAND_MAX) - Scalar(0.5);
+        b_[i][j] = Scalar(rand()) / Scalar(RAND_MAX) - Scalar(0.5);
+      }
+  }
+
+  void run(const char* _kernel, Kernel _f)
+  {
+    OpenMesh::Utils::Timer timer;
+
+    _f(c_, a_, b_); // warm up
+
+    timer.start();
+    for (int r=0; r<runs_; ++r)
+      _f(c_, a_, b_);
+    timer.stop();
+
+    sink += c_[0][0];
+
+    std::cout << std::setw(8)  << std::left << name_
+              << std::setw(14) << _kernel << std::right
+              << std::setw(10) << std::fixed << std::setprecision(3)
+              << timer.seconds() * 1e9 / (double(runs_) * a_.size())
+              << " ns" << std::endl;
+  }
+
+  void run_all()
+  {
+    run("axpy",      &Kernels<Vec>::axpy);
+    run("dot",       &Kernels<Vec>::dot);
+    run("normalize", &Kernels<Vec>::normalize);
+    run("bbox",      &Kernels<Vec>::bbox);
+  }
+
+  void run_all_3d()
+  {
+    run_all();
+    run("cross",       &Kernels<Vec>::cross);
+    run("face_normal", &Kernels<Vec>::face_normal);
+  }
+
+private:
+
+  std::string       name_;
+  std::vector<Vec>  a_, b_, c_;
+  int               runs_;
+};
+
+
+// ----------------------------------------------------------------------------
+
+
+int main(int argc, char *argv[] )
+{
+  int    c;
+  int    runs = 1000;
+  size_t n    = 10000;
+
+  while ( (c=getopt(argc, argv, "n:r:h"))!=-1 )
+  {
+    switch(c)
+    {
+      case 'n': n    = std::max(2, atoi(optarg)); break;
+      case 'r': runs = std::max(1, atoi(optarg)); break;
+      case 'h':
+        usage_and_exit(0);
+      case '?':
+      default:
+        usage_and_exit(1);
+    }
+  }
+
+#if defined(OM_VECTOR_SIMD)
+  std::cout << "VectorT with SIMD specializations";
+#  if defined(__AVX__)
+  std::cout << " (AVX)";
+#  endif
+#else
+  std::cout << "VectorT with generic code";
+#endif
+  std::cout << ", " << n << " vectors, time per element\n";
+
+  Benchmark<OpenMesh::Vec3f>  ("Vec3f",  n, runs).run_all_3d();
+  Benchmark<OpenMesh::Vec3fa> ("Vec3fa", n, runs).run_all_3d();
+  Benchmark<OpenMesh::Vec4f>  ("Vec4f",  n, runs).run_all();
+  Benchmark<OpenMesh::Vec3d>  ("Vec3d",  n, runs).run_all_3d();
+  Benchmark<OpenMesh::Vec3da> ("Vec3da", n, runs).run_all_3d();
+  Benchmark<OpenMesh::Vec4d>  ("Vec4d",  n, runs).run_all();
+
+  std::cout << "(" << sink << ")" << std::endl;
+
+  return 0;
+}
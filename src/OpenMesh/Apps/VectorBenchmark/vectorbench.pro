@@ -0,0 +1,20 @@
+################################################################################
+#
+################################################################################
+
+include( $$TOPDIR/qmake/all.include )
+
+Application()
+
+INCLUDEPATH += ../../..
+
+openmesh()
+
+DIRECTORIES = .
+
+# Input
+HEADERS += $$getFilesFromDir($$DIRECTORIES,*.hh)
+SOURCES += $$getFilesFromDir($$DIRECTORIES,*.cc)
+FORMS   += $$getFilesFromDir($$DIRECTORIES,*.ui)
+
+################################################################################
@@ -0,0 +1,406 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+//=============================================================================
+//
+//  CLASS AlignedVec3T
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_ALIGNEDVECTORT_HH
+#define OPENMESH_ALIGNEDVECTORT_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/Geometry/VectorT.hh>
+#include <algorithm>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Storage of AlignedVec3T: 3 values and a padding value, which is kept
+    zero. With OM_VECTOR_SIMD the storage is 16 byte aligned.
+*/
+template <typename Scalar> struct AlignedVectorDataT
+{
+  Scalar values_[4];
+};
+
+#if defined(OM_VECTOR_SIMD)
+
+template <> struct AlignedVectorDataT<float>
+{
+  union
+  {
+    __m128  m128;
+    float   values_[4];
+  };
+};
+
+template <> struct AlignedVectorDataT<double>
+{
+  union
+  {
+    __m128d m128d[2];
+    double  values_[4];
+  };
+};
+
+#endif
+
+
+/** \class AlignedVec3T AlignedVectorT.hh <OpenMesh/Core/Geometry/AlignedVectorT.hh>
+
+    A 3D vector padded to 4 values, meant for property storage of the
+    inner loop data of algorithms. All operators load and store the 4
+    values with single SIMD instructions (see SIMD::Ops), whereas the
+    operators of VectorT<Scalar,3> have to assemble 3 values.
+
+    The interface is the one of VectorT<Scalar,3>, size() is 3. The
+    vector converts implicitly to and from VectorT<Scalar,3>, results are
+    the same. The binary representation (see IO::binary) consists of the 3
+    values only, i.e. stored properties can be read as VectorT<Scalar,3>.
+
+    \note Containers of Vec3da are only 16 byte aligned, the AVX code uses
+    unaligned loads.
+*/
+template <typename Scalar>
+class AlignedVec3T : public AlignedVectorDataT<Scalar>
+{
+private:
+  typedef AlignedVectorDataT<Scalar>  Base;
+  typedef SIMD::Ops<Scalar>           Ops;
+  typedef typename Ops::reg           reg;
+
+  using Base::values_;
+
+  inline reg load() const { return Ops::load4(values_); }
+  inline void store(const reg& _r) { Ops::store4(values_, _r); }
+
+  static inline AlignedVec3T from(const reg& _r)
+  { AlignedVec3T v; v.store(_r); return v; }
+
+public:
+
+  //---------------------------------------------------------------- class info
+
+  /// the type of the scalar used in this template
+  typedef Scalar value_type;
+
+  /// type of this vector
+  typedef AlignedVec3T<Scalar> vector_type;
+
+  /// returns dimension of the vector (deprecated)
+  static inline int dim() { return 3; }
+
+  /// returns dimension of the vector
+  static inline size_t size() { return 3; }
+
+  static const size_t size_ = 3;
+
+
+  //-------------------------------------------------------------- constructors
+
+  /// default constructor creates uninitialized values, the padding is zero
+  inline AlignedVec3T() { values_[3] = Scalar(0); }
+
+  /// store the same value in each component
+  explicit inline AlignedVec3T(const Scalar& _v) { vectorize(_v); }
+
+  /// special constructor for 3D vectors
+  inline AlignedVec3T(const Scalar& _v0, const Scalar& _v1, const Scalar& _v2)
+  { values_[0] = _v0; values_[1] = _v1; values_[2] = _v2; values_[3] = Scalar(0); }
+
+  /// construct from a value array (explicit)
+  explicit inline AlignedVec3T(const Scalar _values[3])
+  { store(Ops::load3(_values)); }
+
+  /// conversion from VectorT<Scalar,3>
+  inline AlignedVec3T(const VectorT<Scalar,3>& _v)
+  { store(Ops::load3(_v.data())); }
+
+  /// conversion to VectorT<Scalar,3>
+  inline operator VectorT<Scalar,3>() const
+  { VectorT<Scalar,3> v; Ops::store3(v.data(), load()); return v; }
+
+
+  //------------------------------------------------------------- element access
+
+  /// access to Scalar array
+  inline Scalar* data() { return values_; }
+
+  /// access to const Scalar array
+  inline const Scalar* data() const { return values_; }
+
+  /// get i'th element read-write
+  inline Scalar& operator[](size_t _i) { assert(_i<3); return values_[_i]; }
+
+  /// get i'th element read-only
+  inline const Scalar& operator[](size_t _i) const { assert(_i<3); return values_[_i]; }
+
+
+  //---------------------------------------------------------------- comparsion
+
+  /// component-wise comparison
+  inline bool operator==(const vector_type& _rhs) const
+  { return Ops::equal3(load(), _rhs.load()); }
+
+  /// component-wise comparison
+  inline bool operator!=(const vector_type& _rhs) const
+  { return !(*this == _rhs); }
+
+  /// lexicographical comparison
+  inline bool operator<(const vector_type& _rhs) const
+  {
+    for (int i=0; i<3; ++i)
+      if (values_[i] != _rhs.values_[i])
+        return values_[i] < _rhs.values_[i];
+    return false;
+  }
+
+
+  //---------------------------------------------------------- scalar operators
+
+  /// component-wise self-multiplication with scalar
+  inline vector_type& operator*=(const Scalar& _s)
+  { store(Ops::mul(load(), Ops::set1(_s))); return *this; }
+
+  /// component-wise self-division by scalar, the padding stays zero for _s != 0
+  inline vector_type& operator/=(const Scalar& _s)
+  { store(Ops::div(load(), Ops::set1(_s))); values_[3] = Scalar(0); return *this; }
+
+  /// component-wise multiplication with scalar
+  inline vector_type operator*(const Scalar& _s) const
+  { return from(Ops::mul(load(), Ops::set1(_s))); }
+
+  /// component-wise division by scalar
+  inline vector_type operator/(const Scalar& _s) const
+  { return vector_type(*this) /= _s; }
+
+
+  //---------------------------------------------------------- vector operators
+
+  /// component-wise self-multiplication
+  inline vector_type& operator*=(const vector_type& _rhs)
+  { store(Ops::mul(load(), _rhs.load())); return *this; }
+
+  /// component-wise self-division
+  inline vector_type& operator/=(const vector_type& _rhs)
+  { store(Ops::div(load(), _rhs.load())); values_[3] = Scalar(0); return *this; }
+
+  /// vector difference from this
+  inline vector_type& operator-=(const vector_type& _rhs)
+  { store(Ops::sub(load(), _rhs.load())); return *this; }
+
+  /// vector self-addition
+  inline vector_type& operator+=(const vector_type& _rhs)
+  { store(Ops::add(load(), _rhs.load())); return *this; }
+
+  /// component-wise vector multiplication
+  inline vector_type operator*(const vector_type& _v) const
+  { return from(Ops::mul(load(), _v.load())); }
+
+  /// component-wise vector division
+  inline vector_type operator/(const vector_type& _v) const
+  { return vector_type(*this) /= _v; }
+
+  /// component-wise vector addition
+  inline vector_type operator+(const vector_type& _v) const
+  { return from(Ops::add(load(), _v.load())); }
+
+  /// component-wise vector difference
+  inline vector_type operator-(const vector_type& _v) const
+  { return from(Ops::sub(load(), _v.load())); }
+
+  /// unary minus
+  inline vector_type operator-(void) const
+  { return from(Ops::neg(load())); }
+
+  /// cross product
+  /// \see OpenMesh::cross
+  inline vector_type operator%(const vector_type& _rhs) const
+  { return from(Ops::cross(load(), _rhs.load())); }
+
+  /// compute scalar product
+  /// \see OpenMesh::dot
+  inline Scalar operator|(const vector_type& _rhs) const
+  { return Ops::sum3(Ops::mul(load(), _rhs.load())); }
+
+
+  //------------------------------------------------------------ euclidean norm
+
+  /// \name Euclidean norm calculations
+  //@{
+  /// compute euclidean norm
+  inline Scalar norm() const { return (Scalar)sqrt(sqrnorm()); }
+  inline Scalar length() const { return norm(); } // OpenSG interface
+
+  /// compute squared euclidean norm
+  inline Scalar sqrnorm() const
+  { reg v = load(); return Ops::sum3(Ops::mul(v, v)); }
+
+  /// normalize vector, return normalized vector
+  inline vector_type& normalize() { return *this /= norm(); }
+
+  /// return normalized vector
+  inline const vector_type normalized() const { return *this / norm(); }
+
+  /// normalize vector, return normalized vector and avoids div by zero
+  inline vector_type& normalize_cond()
+  {
+    Scalar n = norm();
+    if (n != (Scalar)0.0)
+      *this /= n;
+    return *this;
+  }
+  //@}
+
+
+  //------------------------------------------------------------ max, min, mean
+
+  /// \name Minimum maximum and mean
+  //@{
+
+  /// return the maximal component
+  inline Scalar max() const
+  { return std::max(std::max(values_[0], values_[1]), values_[2]); }
+
+  /// return the minimal component
+  inline Scalar min() const
+  { return std::min(std::min(values_[0], values_[1]), values_[2]); }
+
+  /// return arithmetic mean
+  inline Scalar mean() const { return (values_[0] + values_[1] + values_[2]) / Scalar(3); }
+
+  /// minimize values: same as *this = min(*this, _rhs), but faster
+  inline vector_type minimize(const vector_type& _rhs)
+  { store(Ops::min(_rhs.load(), load())); return *this; }
+
+  /// maximize values: same as *this = max(*this, _rhs), but faster
+  inline vector_type maximize(const vector_type& _rhs)
+  { store(Ops::max(_rhs.load(), load())); return *this; }
+
+  /// component-wise min
+  inline vector_type min(const vector_type& _rhs) const
+  { return vector_type(*this).minimize(_rhs); }
+
+  /// component-wise max
+  inline vector_type max(const vector_type& _rhs) const
+  { return vector_type(*this).maximize(_rhs); }
+
+  //@}
+
+
+  //------------------------------------------------------------ misc functions
+
+  /// store the same value in each component (e.g. to clear all entries)
+  inline vector_type& vectorize(const Scalar& _s)
+  {
+    values_[0] = values_[1] = values_[2] = _s;
+    values_[3] = Scalar(0);
+    return *this;
+  }
+
+  /// store the same value in each component
+  static vector_type vectorized(const Scalar& _s)
+  { return vector_type().vectorize(_s); }
+};
+
+
+//== GLOBAL FUNCTIONS =========================================================
+
+
+/// \relates OpenMesh::AlignedVec3T
+/// scalar * vector
+template<typename Scalar>
+inline AlignedVec3T<Scalar> operator*(Scalar _s, const AlignedVec3T<Scalar>& _v) {
+  return _v * _s;
+}
+
+/// \relates OpenMesh::AlignedVec3T
+/// symmetric version of the dot product
+template<typename Scalar>
+inline Scalar dot(const AlignedVec3T<Scalar>& _v1, const AlignedVec3T<Scalar>& _v2) {
+  return (_v1 | _v2);
+}
+
+/// \relates OpenMesh::AlignedVec3T
+/// symmetric version of the cross product
+template<typename Scalar>
+inline AlignedVec3T<Scalar> cross(const AlignedVec3T<Scalar>& _v1, const AlignedVec3T<Scalar>& _v2) {
+  return (_v1 % _v2);
+}
+
+/// read the space-separated components of a vector from a stream
+template<typename Scalar>
+inline std::istream& operator>>(std::istream& is, AlignedVec3T<Scalar>& vec) {
+  return is >> vec[0] >> vec[1] >> vec[2];
+}
+
+/// output a vector by printing its space-separated compontens
+template<typename Scalar>
+inline std::ostream& operator<<(std::ostream& os, const AlignedVec3T<Scalar>& vec) {
+  return os << vec[0] << " " << vec[1] << " " << vec[2];
+}
+
+
+//== TYPEDEFS =================================================================
+
+/** 3-float vector padded to 16 bytes */
+typedef AlignedVec3T<float>  Vec3fa;
+/** 3-double vector padded to 32 bytes */
+typedef AlignedVec3T<double> Vec3da;
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_ALIGNEDVECTORT_HH defined
+//=============================================================================
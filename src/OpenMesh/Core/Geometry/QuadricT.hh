@@ -119,6 +119,16 @@ public:
     set_distance_to_plane(_n,_p);
   }
 
+  /// convert from a quadric with another scalar type, e.g. Quadricf storage
+  /// accumulated in a Quadricd
+  template <class _Scalar>
+  QuadricT(const QuadricT<_Scalar>& _q)
+  : a_(_q.a()), b_(_q.b()), c_(_q.c()), d_(_q.d()),
+                e_(_q.e()), f_(_q.f()), g_(_q.g()),
+                            h_(_q.h()), i_(_q.i()),
+                                        j_(_q.j())
+  {}
+
   //set operator
   void set(Scalar _a, Scalar _b, Scalar _c, Scalar _d,
                       Scalar _e, Scalar _f, Scalar _g,
@@ -161,7 +171,12 @@ public:
   /// set all entries to zero
   void clear()  { a_ = b_ = c_ = d_ = e_ = f_ = g_ = h_ = i_ = j_ = 0.0; }
 
-  /// add quadrics
+  /** add quadrics
+
+      Like operator*=() this is written member by member on purpose:
+      compilers emit packed SIMD adds (multiplies) for it at -O2/-O3 on
+      their own.
+  **/
   QuadricT<Scalar>& operator+=( const QuadricT<Scalar>& _q )
   {
     a_ += _q.a_;  b_ += _q.b_;  c_ += _q.c_;  d_ += _q.d_;
@@ -201,6 +216,44 @@ public:
     return evaluate(_v, GenProg::Int2Type<_Vec::size_>());
   }
 
+  /** evaluate quadric Q at the 3D points _points[0.._n-1] and store the
+      results in _errors. Gives the same values as operator(), but
+      evaluates several points at once with SSE for Quadricf and Quadricd.
+  **/
+  void operator()(const VectorT<Scalar,3>* _points, size_t _n,
+                  Scalar* _errors) const
+  {
+    for (size_t k=0; k<_n; ++k)
+      _errors[k] = evaluate(_points[k], GenProg::Int2Type<3>());
+  }
+
+  /** compute the 3D point minimizing the quadric, i.e. solve
+      [a b c; b e f; c f h] x = -[d g i]. Returns false, leaving _v
+      unchanged, if the matrix is (close to) singular, e.g. for quadrics
+      of flat or cylindrical regions.
+  **/
+  template <class _Vec3>
+  bool minimizer(_Vec3& _v) const
+  {
+    // cofactors of the symmetric 3x3 matrix
+    Scalar c00 = e_*h_ - f_*f_, c01 = c_*f_ - b_*h_, c02 = b_*f_ - c_*e_;
+    Scalar c11 = a_*h_ - c_*c_, c12 = b_*c_ - a_*f_;
+    Scalar c22 = a_*e_ - b_*b_;
+
+    Scalar det   = a_*c00 + b_*c01 + c_*c02;
+    Scalar trace = (a_ + e_ + h_) / 3;
+
+    // the matrix is positive semidefinite, det/trace^3 is in [0,1]
+    if (!(det > Scalar(1e-6) * trace*trace*trace))
+      return false;
+
+    Scalar inv = Scalar(1) / det;
+    _v[0] = -(c00*d_ + c01*g_ + c02*i_) * inv;
+    _v[1] = -(c01*d_ + c11*g_ + c12*i_) * inv;
+    _v[2] = -(c02*d_ + c12*g_ + c22*i_) * inv;
+    return true;
+  }
+
   Scalar a() const { return a_; }
   Scalar b() const { return b_; }
   Scalar c() const { return c_; }
@@ -225,15 +278,16 @@ public:
 
 protected:
 
-  /// evaluate quadric Q at 3D vector v: v*Q*v
+  /// evaluate quadric Q at 3D vector v: v*Q*v (factored by rows, the
+  /// batch evaluation in operator()(_points, _n, _errors) uses the same order)
   template <class _Vec3>
   Scalar evaluate(const _Vec3& _v, GenProg::Int2Type<3>/*_dimension*/) const
   {
     Scalar x(_v[0]), y(_v[1]), z(_v[2]);
-    return a_*x*x + 2.0*b_*x*y + 2.0*c_*x*z + 2.0*d_*x
-                  +     e_*y*y + 2.0*f_*y*z + 2.0*g_*y
-                               +     h_*z*z + 2.0*i_*z
-                                            +     j_;
+    return x*(a_*x + 2*b_*y + 2*c_*z + 2*d_)
+         + y*(e_*y + 2*f_*z + 2*g_)
+         + z*(h_*z + 2*i_)
+         + j_;
   }
 
   /// evaluate quadric Q at 4D vector v: v*Q*v
@@ -256,6 +310,94 @@ private:
 };
 
 
+//== SIMD SPECIALIZATIONS =====================================================
+
+
+#if defined(OM_VECTOR_SIMD)
+
+/// evaluate a float quadric at four points at a time
+template <>
+inline void
+QuadricT<float>::operator()(const Vec3f* _points, size_t _n,
+                            float* _errors) const
+{
+  const __m128 a  = _mm_set1_ps(a_),   b2 = _mm_set1_ps(2*b_),
+               c2 = _mm_set1_ps(2*c_), d2 = _mm_set1_ps(2*d_),
+               e  = _mm_set1_ps(e_),   f2 = _mm_set1_ps(2*f_),
+               g2 = _mm_set1_ps(2*g_), h  = _mm_set1_ps(h_),
+               i2 = _mm_set1_ps(2*i_), j  = _mm_set1_ps(j_);
+
+  const size_t n4 = _n - _n%4;
+  size_t k=0;
+  for (; k<n4; k+=4)
+  {
+    const Vec3f *p = _points+k;
+    __m128 x = _mm_set_ps(p[3][0], p[2][0], p[1][0], p[0][0]);
+    __m128 y = _mm_set_ps(p[3][1], p[2][1], p[1][1], p[0][1]);
+    __m128 z = _mm_set_ps(p[3][2], p[2][2], p[1][2], p[0][2]);
+
+    __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a, x),
+                                                 _mm_mul_ps(b2, y)),
+                                      _mm_mul_ps(c2, z)), d2);
+    __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e, y),
+                                      _mm_mul_ps(f2, z)), g2);
+    __m128 rz = _mm_add_ps(_mm_mul_ps(h, z), i2);
+
+    __m128 r = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, rx),
+                                                _mm_mul_ps(y, ry)),
+                                     _mm_mul_ps(z, rz)), j);
+    _mm_storeu_ps(_errors+k, r);
+  }
+
+  for (; k<_n; ++k)
+    _errors[k] = evaluate(_points[k], GenProg::Int2Type<3>());
+}
+
+
+/// evaluate a double quadric at two points at a time
+template <>
+inline void
+QuadricT<double>::operator()(const Vec3d* _points, size_t _n,
+                             double* _errors) const
+{
+  const __m128d a  = _mm_set1_pd(a_),   b2 = _mm_set1_pd(2*b_),
+                c2 = _mm_set1_pd(2*c_), d2 = _mm_set1_pd(2*d_),
+                e  = _mm_set1_pd(e_),   f2 = _mm_set1_pd(2*f_),
+                g2 = _mm_set1_pd(2*g_), h  = _mm_set1_pd(h_),
+                i2 = _mm_set1_pd(2*i_), j  = _mm_set1_pd(j_);
+
+  const size_t n2 = _n - _n%2;
+  size_t k=0;
+  for (; k<n2; k+=2)
+  {
+    const Vec3d *p = _points+k;
+    __m128d x = _mm_set_pd(p[1][0], p[0][0]);
+    __m128d y = _mm_set_pd(p[1][1], p[0][1]);
+    __m128d z = _mm_set_pd(p[1][2], p[0][2]);
+
+    __m128d rx = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(a, x),
+                                                  _mm_mul_pd(b2, y)),
+                                       _mm_mul_pd(c2, z)), d2);
+    __m128d ry = _mm_add_pd(_mm_add_pd(_mm_mul_pd(e, y),
+                                       _mm_mul_pd(f2, z)), g2);
+    __m128d rz = _mm_add_pd(_mm_mul_pd(h, z), i2);
+
+    __m128d r = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(x, rx),
+                                                 _mm_mul_pd(y, ry)),
+                                      _mm_mul_pd(z, rz)), j);
+    _mm_storeu_pd(_errors+k, r);
+  }
+
+  for (; k<_n; ++k)
+    _errors[k] = evaluate(_points[k], GenProg::Int2Type<3>());
+}
+
+#endif // OM_VECTOR_SIMD
+
+
+//== TYPEDEFS =================================================================
+
+
 /// Quadric using floats
 typedef QuadricT<float> Quadricf;
 
@@ -70,6 +70,16 @@
 #include <xmmintrin.h>
 #endif
 
+// SIMD versions of the Vec4f and Vec4d operators and of AlignedVec3T (see
+// VectorT_simd.hh). Define OM_VECTOR_NO_SIMD to use the generic code only.
+#if defined(__GNUC__) && defined(__SSE2__) && !defined(OM_VECTOR_NO_SIMD)
+#  define OM_VECTOR_SIMD
+#  include <emmintrin.h>
+#  if defined(__AVX__)
+#    include <immintrin.h>
+#  endif
+#endif
+
 
 //== NAMESPACES ===============================================================
 
@@ -217,6 +227,13 @@ VectorT<double,3>::operator%(const VectorT<double,3>& _rhs) const
 
 
 
+//== SIMD SPECIALIZATIONS =====================================================
+
+
+#include "VectorT_simd.hh"
+
+
+
 //== GLOBAL FUNCTIONS =========================================================
 
 
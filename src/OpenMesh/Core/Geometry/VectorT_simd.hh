@@ -0,0 +1,521 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+//=============================================================================
+//
+//  SIMD lane operations and SIMD specializations of VectorT
+//
+//=============================================================================
+
+// Included by VectorT.hh inside namespace OpenMesh, after the definition of
+// VectorT. The intrinsics headers are included by VectorT.hh as well.
+
+#if defined( OPENMESH_VECTOR_HH )
+
+// ----------------------------------------------------------------------------
+
+namespace SIMD {
+
+
+/** Operations on a register of 4 lanes of type Scalar, used by the SIMD
+    specializations of VectorT and by AlignedVec3T.
+
+    load3()/store3() access 3 values and set the 4th lane to zero,
+    load4()/store4() access 4 values. No alignment is required. sum3() and
+    sum4() add up the lanes in index order, so the results are the same as
+    those of the generic VectorT code.
+
+    This generic version works on plain arrays. It is specialized for float
+    and double if OM_VECTOR_SIMD is defined.
+*/
+template <typename Scalar> struct Ops
+{
+  struct reg { Scalar v[4]; };
+
+#define LANES(expr) expr(0) expr(1) expr(2) expr(3)
+
+  static inline reg load3(const Scalar* _p)
+  { reg r; r.v[0]=_p[0]; r.v[1]=_p[1]; r.v[2]=_p[2]; r.v[3]=Scalar(0); return r; }
+
+  static inline reg load4(const Scalar* _p)
+  { reg r; r.v[0]=_p[0]; r.v[1]=_p[1]; r.v[2]=_p[2]; r.v[3]=_p[3]; return r; }
+
+  static inline void store3(Scalar* _p, const reg& _r)
+  { _p[0]=_r.v[0]; _p[1]=_r.v[1]; _p[2]=_r.v[2]; }
+
+  static inline void store4(Scalar* _p, const reg& _r)
+  { _p[0]=_r.v[0]; _p[1]=_r.v[1]; _p[2]=_r.v[2]; _p[3]=_r.v[3]; }
+
+  static inline reg set1(const Scalar& _s)
+  { reg r; r.v[0]=r.v[1]=r.v[2]=r.v[3]=_s; return r; }
+
+#define BINARY_OP(name, expr_)                                          \
+  static inline reg name(const reg& _a, const reg& _b)                  \
+  {                                                                     \
+    reg r;                                                              \
+    LANES(expr_)                                                        \
+    return r;                                                           \
+  }
+#define ADD(i) r.v[i] = _a.v[i] + _b.v[i];
+#define SUB(i) r.v[i] = _a.v[i] - _b.v[i];
+#define MUL(i) r.v[i] = _a.v[i] * _b.v[i];
+#define DIV(i) r.v[i] = _a.v[i] / _b.v[i];
+#define MIN(i) r.v[i] = _a.v[i] < _b.v[i] ? _a.v[i] : _b.v[i];
+#define MAX(i) r.v[i] = _a.v[i] > _b.v[i] ? _a.v[i] : _b.v[i];
+  BINARY_OP(add, ADD)
+  BINARY_OP(sub, SUB)
+  BINARY_OP(mul, MUL)
+  BINARY_OP(div, DIV)
+  BINARY_OP(min, MIN)
+  BINARY_OP(max, MAX)
+#undef ADD
+#undef SUB
+#undef MUL
+#undef DIV
+#undef MIN
+#undef MAX
+#undef BINARY_OP
+
+  static inline reg neg(const reg& _a)
+  { reg r; r.v[0]=-_a.v[0]; r.v[1]=-_a.v[1]; r.v[2]=-_a.v[2]; r.v[3]=-_a.v[3]; return r; }
+
+  static inline Scalar sum3(const reg& _a) { return _a.v[0] + _a.v[1] + _a.v[2]; }
+  static inline Scalar sum4(const reg& _a) { return _a.v[0] + _a.v[1] + _a.v[2] + _a.v[3]; }
+
+  static inline bool equal3(const reg& _a, const reg& _b)
+  { return _a.v[0]==_b.v[0] && _a.v[1]==_b.v[1] && _a.v[2]==_b.v[2]; }
+
+  static inline bool equal4(const reg& _a, const reg& _b)
+  { return equal3(_a, _b) && _a.v[3]==_b.v[3]; }
+
+  /// cross product of the first 3 lanes, the 4th lane is zero
+  static inline reg cross(const reg& _a, const reg& _b)
+  {
+    reg r;
+    r.v[0] = _a.v[1]*_b.v[2] - _a.v[2]*_b.v[1];
+    r.v[1] = _a.v[2]*_b.v[0] - _a.v[0]*_b.v[2];
+    r.v[2] = _a.v[0]*_b.v[1] - _a.v[1]*_b.v[0];
+    r.v[3] = Scalar(0);
+    return r;
+  }
+
+#undef LANES
+};
+
+
+#if defined(OM_VECTOR_SIMD)
+
+/// SSE version for float
+template <> struct Ops<float>
+{
+  typedef __m128 reg;
+
+  static inline reg load3(const float* _p)
+  {
+    // x y | z 0
+    return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd((const double*)_p)),
+                         _mm_load_ss(_p+2));
+  }
+
+  static inline reg load4(const float* _p) { return _mm_loadu_ps(_p); }
+
+  static inline void store3(float* _p, const reg& _r)
+  {
+    _mm_store_sd((double*)_p, _mm_castps_pd(_r));
+    _mm_store_ss(_p+2, _mm_movehl_ps(_r, _r));
+  }
+
+  static inline void store4(float* _p, const reg& _r) { _mm_storeu_ps(_p, _r); }
+
+  static inline reg set1(const float& _s) { return _mm_set1_ps(_s); }
+
+  static inline reg add(const reg& _a, const reg& _b) { return _mm_add_ps(_a, _b); }
+  static inline reg sub(const reg& _a, const reg& _b) { return _mm_sub_ps(_a, _b); }
+  static inline reg mul(const reg& _a, const reg& _b) { return _mm_mul_ps(_a, _b); }
+  static inline reg div(const reg& _a, const reg& _b) { return _mm_div_ps(_a, _b); }
+
+  // same operand order as the generic version: a < b ? a : b
+  static inline reg min(const reg& _a, const reg& _b) { return _mm_min_ps(_a, _b); }
+  static inline reg max(const reg& _a, const reg& _b) { return _mm_max_ps(_a, _b); }
+
+  static inline reg neg(const reg& _a) { return _mm_xor_ps(_a, _mm_set1_ps(-0.0f)); }
+
+  static inline float sum3(const reg& _a)
+  {
+    __m128 s = _mm_add_ss(_a, _mm_shuffle_ps(_a, _a, _MM_SHUFFLE(1,1,1,1)));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehl_ps(_a, _a)));
+  }
+
+  static inline float sum4(const reg& _a)
+  {
+    __m128 s = _mm_add_ss(_a, _mm_shuffle_ps(_a, _a, _MM_SHUFFLE(1,1,1,1)));
+    s = _mm_add_ss(s, _mm_movehl_ps(_a, _a));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(_a, _a, _MM_SHUFFLE(3,3,3,3))));
+  }
+
+  static inline bool equal3(const reg& _a, const reg& _b)
+  { return (_mm_movemask_ps(_mm_cmpeq_ps(_a, _b)) & 0x7) == 0x7; }
+
+  static inline bool equal4(const reg& _a, const reg& _b)
+  { return _mm_movemask_ps(_mm_cmpeq_ps(_a, _b)) == 0xf; }
+
+  static inline reg cross(const reg& _a, const reg& _b)
+  {
+    __m128 a_yzx = _mm_shuffle_ps(_a, _a, _MM_SHUFFLE(3,0,2,1));
+    __m128 b_yzx = _mm_shuffle_ps(_b, _b, _MM_SHUFFLE(3,0,2,1));
+    __m128 a_zxy = _mm_shuffle_ps(_a, _a, _MM_SHUFFLE(3,1,0,2));
+    __m128 b_zxy = _mm_shuffle_ps(_b, _b, _MM_SHUFFLE(3,1,0,2));
+    __m128 r = _mm_sub_ps(_mm_mul_ps(a_yzx, b_zxy), _mm_mul_ps(a_zxy, b_yzx));
+    // the 4th lane is w*w - w*w, clear it in case of inf or nan
+    return _mm_and_ps(r, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+  }
+};
+
+
+#if defined(__AVX__)
+
+/// AVX version for double
+template <> struct Ops<double>
+{
+  typedef __m256d reg;
+
+  static inline reg load3(const double* _p)
+  {
+    return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(_p)),
+                                _mm_load_sd(_p+2), 1);
+  }
+
+  static inline reg load4(const double* _p) { return _mm256_loadu_pd(_p); }
+
+  static inline void store3(double* _p, const reg& _r)
+  {
+    _mm_storeu_pd(_p, _mm256_castpd256_pd128(_r));
+    _mm_store_sd(_p+2, _mm256_extractf128_pd(_r, 1));
+  }
+
+  static inline void store4(double* _p, const reg& _r) { _mm256_storeu_pd(_p, _r); }
+
+  static inline reg set1(const double& _s) { return _mm256_set1_pd(_s); }
+
+  static inline reg add(const reg& _a, const reg& _b) { return _mm256_add_pd(_a, _b); }
+  static inline reg sub(const reg& _a, const reg& _b) { return _mm256_sub_pd(_a, _b); }
+  static inline reg mul(const reg& _a, const reg& _b) { return _mm256_mul_pd(_a, _b); }
+  static inline reg div(const reg& _a, const reg& _b) { return _mm256_div_pd(_a, _b); }
+  static inline reg min(const reg& _a, const reg& _b) { return _mm256_min_pd(_a, _b); }
+  static inline reg max(const reg& _a, const reg& _b) { return _mm256_max_pd(_a, _b); }
+
+  static inline reg neg(const reg& _a) { return _mm256_xor_pd(_a, _mm256_set1_pd(-0.0)); }
+
+  static inline double sum3(const reg& _a)
+  {
+    __m128d lo = _mm256_castpd256_pd128(_a);
+    __m128d s  = _mm_add_sd(lo, _mm_unpackhi_pd(lo, lo));
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm256_extractf128_pd(_a, 1)));
+  }
+
+  static inline double sum4(const reg& _a)
+  {
+    __m128d lo = _mm256_castpd256_pd128(_a);
+    __m128d hi = _mm256_extractf128_pd(_a, 1);
+    __m128d s  = _mm_add_sd(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)), hi);
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(hi, hi)));
+  }
+
+  static inline bool equal3(const reg& _a, const reg& _b)
+  { return (_mm256_movemask_pd(_mm256_cmp_pd(_a, _b, _CMP_EQ_OQ)) & 0x7) == 0x7; }
+
+  static inline bool equal4(const reg& _a, const reg& _b)
+  { return _mm256_movemask_pd(_mm256_cmp_pd(_a, _b, _CMP_EQ_OQ)) == 0xf; }
+
+  static inline reg cross(const reg& _a, const reg& _b)
+  {
+    double a[4], b[4];
+    _mm256_storeu_pd(a, _a);
+    _mm256_storeu_pd(b, _b);
+    return _mm256_setr_pd(a[1]*b[2] - a[2]*b[1],
+                          a[2]*b[0] - a[0]*b[2],
+                          a[0]*b[1] - a[1]*b[0], 0.0);
+  }
+};
+
+#else
+
+/// SSE2 version for double, the 4 lanes are kept in two registers
+template <> struct Ops<double>
+{
+  struct reg { __m128d lo, hi; };
+
+  static inline reg make(const __m128d& _lo, const __m128d& _hi)
+  { reg r; r.lo = _lo; r.hi = _hi; return r; }
+
+  static inline reg load3(const double* _p)
+  { return make(_mm_loadu_pd(_p), _mm_load_sd(_p+2)); }
+
+  static inline reg load4(const double* _p)
+  { return make(_mm_loadu_pd(_p), _mm_loadu_pd(_p+2)); }
+
+  static inline void store3(double* _p, const reg& _r)
+  { _mm_storeu_pd(_p, _r.lo); _mm_store_sd(_p+2, _r.hi); }
+
+  static inline void store4(double* _p, const reg& _r)
+  { _mm_storeu_pd(_p, _r.lo); _mm_storeu_pd(_p+2, _r.hi); }
+
+  static inline reg set1(const double& _s)
+  { __m128d s = _mm_set1_pd(_s); return make(s, s); }
+
+#define BINARY_OP(name, intrinsic)                                      \
+  static inline reg name(const reg& _a, const reg& _b)                  \
+  { return make(intrinsic(_a.lo, _b.lo), intrinsic(_a.hi, _b.hi)); }
+  BINARY_OP(add, _mm_add_pd)
+  BINARY_OP(sub, _mm_sub_pd)
+  BINARY_OP(mul, _mm_mul_pd)
+  BINARY_OP(div, _mm_div_pd)
+  BINARY_OP(min, _mm_min_pd)
+  BINARY_OP(max, _mm_max_pd)
+#undef BINARY_OP
+
+  static inline reg neg(const reg& _a)
+  {
+    __m128d m = _mm_set1_pd(-0.0);
+    return make(_mm_xor_pd(_a.lo, m), _mm_xor_pd(_a.hi, m));
+  }
+
+  static inline double sum3(const reg& _a)
+  {
+    __m128d s = _mm_add_sd(_a.lo, _mm_unpackhi_pd(_a.lo, _a.lo));
+    return _mm_cvtsd_f64(_mm_add_sd(s, _a.hi));
+  }
+
+  static inline double sum4(const reg& _a)
+  {
+    __m128d s = _mm_add_sd(_mm_add_sd(_a.lo, _mm_unpackhi_pd(_a.lo, _a.lo)), _a.hi);
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(_a.hi, _a.hi)));
+  }
+
+  static inline bool equal3(const reg& _a, const reg& _b)
+  {
+    return _mm_movemask_pd(_mm_cmpeq_pd(_a.lo, _b.lo)) == 0x3 &&
+           (_mm_movemask_pd(_mm_cmpeq_pd(_a.hi, _b.hi)) & 0x1);
+  }
+
+  static inline bool equal4(const reg& _a, const reg& _b)
+  {
+    return _mm_movemask_pd(_mm_cmpeq_pd(_a.lo, _b.lo)) == 0x3 &&
+           _mm_movemask_pd(_mm_cmpeq_pd(_a.hi, _b.hi)) == 0x3;
+  }
+
+  static inline reg cross(const reg& _a, const reg& _b)
+  {
+    // x y | z w  ->  y z | x w  and  z x | y w
+    __m128d a_yz = _mm_shuffle_pd(_a.lo, _a.hi, 1), b_yz = _mm_shuffle_pd(_b.lo, _b.hi, 1);
+    __m128d a_zx = _mm_unpacklo_pd(_a.hi, _a.lo),   b_zx = _mm_unpacklo_pd(_b.hi, _b.lo);
+    __m128d a_x  = _a.lo, b_x = _b.lo;
+    __m128d a_y  = _mm_unpackhi_pd(_a.lo, _a.lo),   b_y  = _mm_unpackhi_pd(_b.lo, _b.lo);
+
+    return make(_mm_sub_pd(_mm_mul_pd(a_yz, b_zx), _mm_mul_pd(a_zx, b_yz)),
+                _mm_move_sd(_mm_setzero_pd(),
+                            _mm_sub_sd(_mm_mul_sd(a_x, b_y), _mm_mul_sd(a_y, b_x))));
+  }
+};
+
+#endif // __AVX__
+
+#endif // OM_VECTOR_SIMD
+
+} // namespace SIMD
+
+
+// ----------------------------------------------------------------------------
+
+#if defined(OM_VECTOR_SIMD)
+
+// Member specializations of VectorT<Scalar,4> for Scalar = float, double.
+// The lanes are computed in the same order as in the generic code, the
+// results are identical.
+//
+// VectorT<Scalar,3> keeps the generic code: assembling 3 values costs more
+// than it saves, and loops over arrays of Vec3f are vectorized across the
+// elements by the compiler, which the SIMD versions prevent (see
+// Apps/VectorBenchmark). Use AlignedVec3T for SIMD operations on 3D vectors.
+
+#define SIMD_VECTORT(S, N)                                                    \
+                                                                              \
+template<> inline VectorT<S,N>& VectorT<S,N>::operator+=(const VectorT<S,N>& _rhs) \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  O::store##N(values_, O::add(O::load##N(values_), O::load##N(_rhs.values_))); \
+  return *this;                                                               \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N>& VectorT<S,N>::operator-=(const VectorT<S,N>& _rhs) \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  O::store##N(values_, O::sub(O::load##N(values_), O::load##N(_rhs.values_))); \
+  return *this;                                                               \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N>& VectorT<S,N>::operator*=(const VectorT<S,N>& _rhs) \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  O::store##N(values_, O::mul(O::load##N(values_), O::load##N(_rhs.values_))); \
+  return *this;                                                               \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N>& VectorT<S,N>::operator/=(const VectorT<S,N>& _rhs) \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  O::store##N(values_, O::div(O::load##N(values_), O::load##N(_rhs.values_))); \
+  return *this;                                                               \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N>& VectorT<S,N>::operator*=(const S& _s)         \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  O::store##N(values_, O::mul(O::load##N(values_), O::set1(_s)));             \
+  return *this;                                                               \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N>& VectorT<S,N>::operator/=(const S& _s)         \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  O::store##N(values_, O::div(O::load##N(values_), O::set1(_s)));             \
+  return *this;                                                               \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N> VectorT<S,N>::operator+(const VectorT<S,N>& _v) const \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  VectorT<S,N> r;                                                             \
+  O::store##N(r.values_, O::add(O::load##N(values_), O::load##N(_v.values_))); \
+  return r;                                                                   \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N> VectorT<S,N>::operator-(const VectorT<S,N>& _v) const \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  VectorT<S,N> r;                                                             \
+  O::store##N(r.values_, O::sub(O::load##N(values_), O::load##N(_v.values_))); \
+  return r;                                                                   \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N> VectorT<S,N>::operator*(const VectorT<S,N>& _v) const \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  VectorT<S,N> r;                                                             \
+  O::store##N(r.values_, O::mul(O::load##N(values_), O::load##N(_v.values_))); \
+  return r;                                                                   \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N> VectorT<S,N>::operator/(const VectorT<S,N>& _v) const \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  VectorT<S,N> r;                                                             \
+  O::store##N(r.values_, O::div(O::load##N(values_), O::load##N(_v.values_))); \
+  return r;                                                                   \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N> VectorT<S,N>::operator*(const S& _s) const     \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  VectorT<S,N> r;                                                             \
+  O::store##N(r.values_, O::mul(O::load##N(values_), O::set1(_s)));           \
+  return r;                                                                   \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N> VectorT<S,N>::operator/(const S& _s) const     \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  VectorT<S,N> r;                                                             \
+  O::store##N(r.values_, O::div(O::load##N(values_), O::set1(_s)));           \
+  return r;                                                                   \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N> VectorT<S,N>::operator-(void) const            \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  VectorT<S,N> r;                                                             \
+  O::store##N(r.values_, O::neg(O::load##N(values_)));                        \
+  return r;                                                                   \
+}                                                                             \
+                                                                              \
+template<> inline bool VectorT<S,N>::operator==(const VectorT<S,N>& _rhs) const \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  return O::equal##N(O::load##N(values_), O::load##N(_rhs.values_));          \
+}                                                                             \
+                                                                              \
+template<> inline S VectorT<S,N>::operator|(const VectorT<S,N>& _rhs) const   \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  return O::sum##N(O::mul(O::load##N(values_), O::load##N(_rhs.values_)));   \
+}                                                                             \
+                                                                              \
+template<> inline S VectorT<S,N>::sqrnorm() const                             \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  O::reg v = O::load##N(values_);                                             \
+  return O::sum##N(O::mul(v, v));                                             \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N> VectorT<S,N>::minimize(const VectorT<S,N>& _rhs) \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  O::store##N(values_, O::min(O::load##N(_rhs.values_), O::load##N(values_))); \
+  return *this;                                                               \
+}                                                                             \
+                                                                              \
+template<> inline VectorT<S,N> VectorT<S,N>::maximize(const VectorT<S,N>& _rhs) \
+{                                                                             \
+  typedef SIMD::Ops<S> O;                                                     \
+  O::store##N(values_, O::max(O::load##N(_rhs.values_), O::load##N(values_))); \
+  return *this;                                                               \
+}
+
+SIMD_VECTORT(float,  4)
+SIMD_VECTORT(double, 4)
+
+#undef SIMD_VECTORT
+
+#endif // OM_VECTOR_SIMD
+
+// ----------------------------------------------------------------------------
+#endif // included by VectorT.hh
+//=============================================================================
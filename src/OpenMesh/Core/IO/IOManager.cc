@@ -89,13 +89,23 @@ read(const std::string& _filename, BaseImporter& _bi, Options& _opt)
     
   // Try all registered modules
   for(; it != it_end; ++it)
-    if ((*it)->can_u_read(_filename))
+  {
+    // modules with state work on a private copy (thread safety),
+    // can_u_read() may already store header information
+    BaseReader* copy   = (*it)->clone();
+    BaseReader* reader = copy ? copy : *it;
+
+    if (reader->can_u_read(_filename))
     {
       _bi.prepare();
-      bool ok = (*it)->read(_filename, _bi, _opt);
+      bool ok = reader->read(_filename, _bi, _opt);
       _bi.finish();
+      delete copy;
       return ok;
     }
+
+    delete copy;
+  }
   
   // All modules failed to read
   return false;
@@ -116,9 +126,14 @@ read(std::istream& _is, const std::string& _ext, BaseImporter& _bi, Options& _op
   for(; it != it_end; ++it)
     if ((*it)->BaseReader::can_u_read(_ext))  //Use the extension check only (no file existence)
     {
+      // modules with state work on a private copy (thread safety)
+      BaseReader* copy   = (*it)->clone();
+      BaseReader* reader = copy ? copy : *it;
+
       _bi.prepare();
-      bool ok = (*it)->read(_is, _bi, _opt);
+      bool ok = reader->read(_is, _bi, _opt);
       _bi.finish();
+      delete copy;
       return ok;
     }
   
@@ -148,7 +163,11 @@ write(const std::string& _filename, BaseExporter& _be, Options _opt)
   {
     if ((*it)->can_u_write(_filename))
     {
-      return (*it)->write(_filename, _be, _opt); 
+      // modules with state work on a private copy (thread safety)
+      BaseWriter* copy = (*it)->clone();
+      bool ok = (copy ? copy : *it)->write(_filename, _be, _opt);
+      delete copy;
+      return ok;
     }
   }
   
@@ -177,7 +196,11 @@ write(std::ostream& _os,const std::string &_ext, BaseExporter& _be, Options _opt
   {
     if ((*it)->BaseWriter::can_u_write(_ext)) //Restrict test to the extension check
     {
-      return (*it)->write(_os, _be, _opt); 
+      // modules with state work on a private copy (thread safety)
+      BaseWriter* copy = (*it)->clone();
+      bool ok = (copy ? copy : *it)->write(_os, _be, _opt);
+      delete copy;
+      return ok;
     }
   }
   
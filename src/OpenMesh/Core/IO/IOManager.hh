@@ -94,6 +94,11 @@ namespace IO {
     BaseExporter interface, providing iterators over vertices/faces to
     the writer modules.
 
+    Reading and writing is thread safe: modules that keep state between
+    calls are used through a private copy (see BaseReader::clone()), so
+    several meshes can be read or written concurrently. Modules have to
+    be registered before, usually during static initialization.
+
     \see \ref mesh_io
 */
 
@@ -53,6 +53,13 @@
     defined (OPENMESH_POLYMESH_ARRAY_KERNEL_HH)
 #  error "Include MeshIO.hh before including a mesh type!"
 #endif
+// -------------------- STL
+#include <vector>
+#include <string>
+#ifdef USE_OPENMP
+#  include <omp.h>
+#endif
+
 // -------------------- OpenMesh
 #include <OpenMesh/Core/IO/SR_store.hh>
 #include <OpenMesh/Core/IO/IOManager.hh>
@@ -135,6 +142,37 @@ read_mesh(Mesh&         _mesh,
 }
 
 
+/** \brief Read a mesh from file _filename using the caller provided
+    working storage \c _scratch.
+
+    Same as above, but the reader modules take their temporary containers
+    from \c _scratch. Passing the same scratch context to subsequent calls
+    avoids reallocating this memory for every file.
+
+    @param _mesh     The target mesh that will be filled with the read data
+    @param _filename fill to load
+    @param _opt      Reader options (e.g. skip loading of normals ... depends
+                     on the reader capabilities)
+    @param _scratch  Working storage of the readers
+    @param _clear    Clear the target data before filling it (allows to
+                     load multiple files into one Mesh)
+
+    @return Successful?
+*/
+template <class Mesh>
+bool 
+read_mesh(Mesh&         _mesh,
+	  const std::string&  _filename, 
+	  Options&            _opt, 
+	  ImportScratch&      _scratch,
+	  bool                _clear = true) 
+{
+  if (_clear) _mesh.clear();
+  ImporterT<Mesh> importer(_mesh, &_scratch);
+  return IOManager().read(_filename, importer, _opt); 
+}
+
+
 /** \brief Read a mesh from file open std::istream. 
 
     The file format is determined by parameter _ext. _ext has to include 
@@ -169,6 +207,66 @@ read_mesh(Mesh&         _mesh,
 
 
 
+//-----------------------------------------------------------------------------
+
+
+/** \brief Read a batch of meshes, in parallel if OpenMP is available.
+
+    Each file is read into its own mesh by read_mesh(). Up to
+    \c _max_threads files are loaded concurrently (all available cores
+    if \c _max_threads is 0).
+
+    @param _meshes    The target meshes, resized to the number of files
+    @param _filenames Files to load
+    @param _opts      Reader options per file. If its size does not match
+                      the number of files, default options are used. After
+                      execution it contains the options that were read.
+    @param _ok        Receives per file if reading was successful
+    @param _max_threads Maximum number of concurrent loads
+    @return Number of successfully read files
+*/
+template <class Mesh>
+size_t
+read_meshes(std::vector<Mesh>&               _meshes,
+            const std::vector<std::string>&  _filenames,
+            std::vector<Options>&            _opts,
+            std::vector<bool>&               _ok,
+            int                              _max_threads = 0)
+{
+  const int n = int(_filenames.size());
+
+  _meshes.resize(n);
+  if (_opts.size() != _filenames.size())
+    _opts.assign(n, Options());
+
+  // std::vector<bool> must not be written concurrently
+  std::vector<unsigned char> ok(n, 0);
+
+  // every thread reuses its reader working storage for all of its files
+#ifdef USE_OPENMP
+  const int n_threads = (_max_threads > 0) ? _max_threads
+                                           : omp_get_max_threads();
+  std::vector<ImportScratch> scratch(n_threads);
+  #pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+  for (int i=0; i<n; ++i)
+    ok[i] = read_mesh(_meshes[i], _filenames[i], _opts[i],
+                      scratch[omp_get_thread_num()]);
+#else
+  ImportScratch scratch;
+  for (int i=0; i<n; ++i)
+    ok[i] = read_mesh(_meshes[i], _filenames[i], _opts[i], scratch);
+#endif
+
+  size_t n_ok(0);
+  _ok.resize(n);
+  for (int i=0; i<n; ++i)
+    if ((_ok[i] = (ok[i] != 0)))
+      ++n_ok;
+
+  return n_ok;
+}
+
+
 //-----------------------------------------------------------------------------
 
 
@@ -199,6 +199,18 @@ namespace OMFormat {
       Float_128 = 0x02  // 16 bytes for long double (an assumption!)
     };
 
+    // Name of the custom mesh chunk holding the connectivity snapshot.
+    // Readers without support skip it like an unknown mesh property.
+    static const char* connectivity_name() { return "<<connectivity>>"; }
+
+    // status arrays following the handles in the connectivity chunk
+    enum Status_Mask {
+      Status_Vertex   = 0x01,
+      Status_Halfedge = 0x02,
+      Status_Edge     = 0x04,
+      Status_Face     = 0x08
+    };
+
     static const int SIZE_RESERVED = 1; //  1
     static const int SIZE_NAME     = 1; //  2
     static const int SIZE_ENTITY   = 3; //  5
@@ -613,6 +625,27 @@ namespace OMFormat {
 		  _swap );
   }
 
+  /// storing an array of vector types, as one block if no byte swapping
+  /// is needed and the vectors are tightly packed
+  template <typename VecT> inline
+  size_t store_array( std::ostream& _os, const VecT* _vecs, size_t _n,
+                      bool _swap )
+  {
+    typedef typename vector_traits<VecT>::value_type scalar_type;
+
+    if ( !_swap &&
+         sizeof(VecT) == vector_traits<VecT>::size_ * sizeof(scalar_type) )
+    {
+      _os.write( reinterpret_cast<const char*>(_vecs), _n*sizeof(VecT) );
+      return _n*sizeof(VecT);
+    }
+
+    size_t bytes(0);
+    for (size_t i=0; i<_n; ++i)
+      bytes += vector_store( _os, _vecs[i], _swap );
+    return bytes;
+  }
+
   // ---------------------------------------- restoring vectors
   template <typename VecT>
   inline
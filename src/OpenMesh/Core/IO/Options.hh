@@ -105,7 +105,8 @@ public:
       EdgeColor      = 0x0080, ///< Has (r) / store (w) edge colors
       FaceNormal     = 0x0100, ///< Has (r) / store (w) face normals
       FaceColor      = 0x0200, ///< Has (r) / store (w) face colors
-      ColorAlpha     = 0x0400  ///< Has (r) / store (w) alpha values for colors
+      ColorAlpha     = 0x0400, ///< Has (r) / store (w) alpha values for colors
+      Connectivity   = 0x0800  ///< Has (r) / store (w) the halfedge connectivity (OM only)
   };
 
 public:
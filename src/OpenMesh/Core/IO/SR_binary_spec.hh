@@ -65,6 +65,7 @@
 #include <numeric>   // accumulate
 // -------------------- OpenMesh
 #include <OpenMesh/Core/Geometry/VectorT.hh>
+#include <OpenMesh/Core/Geometry/AlignedVectorT.hh>
 #include <OpenMesh/Core/Mesh/Status.hh>
 #include <OpenMesh/Core/IO/SR_types.hh>
 #include <OpenMesh/Core/IO/SR_rbo.hh>
@@ -167,7 +168,8 @@ SIMPLE_BINARY(unsigned long);
   template <> struct binary< T > {                              \
     typedef T value_type;                                       \
     static const bool is_streamable = true;                     \
-    static size_t size_of(void) { return sizeof(value_type); }  \
+    static size_t size_of(void)                                 \
+    { return value_type::size_ * sizeof(value_type::value_type); } \
     static size_t size_of(const value_type&) { return size_of(); } \
     static size_t store( std::ostream& _os, const value_type& _val, \
 		         bool _swap=false) {                    \
@@ -206,6 +208,10 @@ VECTORTS_BINARY( 3 )
 VECTORTS_BINARY( 4 )
 VECTORTS_BINARY( 6 )
 
+// padded vectors, stored without the padding
+VECTORT_BINARY( Vec3fa );
+VECTORT_BINARY( Vec3da );
+
 #undef VECTORTS_BINARY
 #undef VECTORT_BINARY
 
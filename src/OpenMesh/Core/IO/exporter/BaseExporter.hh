@@ -61,6 +61,7 @@
 #include <OpenMesh/Core/System/config.h>
 #include <OpenMesh/Core/Geometry/VectorT.hh>
 #include <OpenMesh/Core/Mesh/BaseKernel.hh>
+#include <OpenMesh/Core/Mesh/ArrayKernel.hh>
 
 
 //=== NAMESPACES ==============================================================
@@ -109,6 +110,96 @@ public:
   // get reference to base kernel
   virtual const BaseKernel* kernel() { return 0; }
 
+  // get the array kernel holding the connectivity, 0 if there is none
+  virtual const ArrayKernel* array_kernel() { return 0; }
+
+
+  /** \name Bulk access
+      Exporters may hand out contiguous arrays of vertex or face data
+      (n_vertices() resp. n_faces() entries) if the mesh stores them in
+      the requested format. Otherwise the array functions return 0 and
+      writers have to use the per-element accessors above. The non-virtual
+      get_*() helpers hide this distinction: they return the exporter's
+      array if available or fill the given buffer and return its data.
+  */
+  //@{
+
+  virtual const Vec3f*  points_array()         const { return 0; }
+  virtual const Vec3f*  vertex_normals_array() const { return 0; }
+  virtual const Vec3uc* vertex_colors_array()  const { return 0; }
+  virtual const Vec3f*  face_normals_array()   const { return 0; }
+
+  /** Store the vertex indices of all faces, one face after the other, in
+      \c _indices. If \c _offsets is given, it receives n_faces()+1
+      entries such that face \c i uses the indices in
+      [_offsets[i], _offsets[i+1]). Returns the number of indices. */
+  virtual size_t get_face_indices(std::vector<unsigned int>&  _indices,
+                                  std::vector<unsigned int>*  _offsets=0) const
+  {
+    std::vector<VertexHandle> vhandles;
+    size_t i, j, nF(n_faces());
+
+    _indices.clear();
+    if (_offsets)
+    {
+      _offsets->clear();
+      _offsets->reserve(nF+1);
+      _offsets->push_back(0);
+    }
+
+    for (i=0; i<nF; ++i)
+    {
+      get_vhandles(FaceHandle(i), vhandles);
+      for (j=0; j<vhandles.size(); ++j)
+        _indices.push_back(vhandles[j].idx());
+      if (_offsets)
+        _offsets->push_back(_indices.size());
+    }
+    return _indices.size();
+  }
+
+  const Vec3f* get_points(std::vector<Vec3f>& _buffer) const
+  {
+    const Vec3f* p = points_array();
+    if (p || !n_vertices()) return p;
+    _buffer.resize(n_vertices());
+    for (size_t i=0; i<_buffer.size(); ++i)
+      _buffer[i] = point(VertexHandle(i));
+    return &_buffer[0];
+  }
+
+  const Vec3f* get_vertex_normals(std::vector<Vec3f>& _buffer) const
+  {
+    const Vec3f* p = vertex_normals_array();
+    if (p || !n_vertices()) return p;
+    _buffer.resize(n_vertices());
+    for (size_t i=0; i<_buffer.size(); ++i)
+      _buffer[i] = normal(VertexHandle(i));
+    return &_buffer[0];
+  }
+
+  const Vec3uc* get_vertex_colors(std::vector<Vec3uc>& _buffer) const
+  {
+    const Vec3uc* p = vertex_colors_array();
+    if (p || !n_vertices()) return p;
+    _buffer.resize(n_vertices());
+    for (size_t i=0; i<_buffer.size(); ++i)
+      _buffer[i] = color(VertexHandle(i));
+    return &_buffer[0];
+  }
+
+  const Vec3f* get_face_normals(std::vector<Vec3f>& _buffer) const
+  {
+    const Vec3f* p = face_normals_array();
+    if (p || !n_faces()) return p;
+    _buffer.resize(n_faces());
+    for (size_t i=0; i<_buffer.size(); ++i)
+      _buffer[i] = normal(FaceHandle(i));
+    return &_buffer[0];
+  }
+
+  //@}
+
 
   // query number of faces, vertices, normals, texcoords
   virtual size_t n_vertices()   const = 0;
@@ -73,6 +73,19 @@ namespace IO {
 
 //=== EXPORTER CLASS ==========================================================
 
+#ifndef DOXY_IGNORE_THIS
+template <class Dst, class Src> struct ArrayCastT
+{
+  static const Dst* cast(const Src*) { return 0; }
+};
+
+template <class T> struct ArrayCastT<T, T>
+{
+  static const T* cast(const T* _p) { return _p; }
+};
+#endif
+
+
 /**
  *  This class template provides an exporter module for OpenMesh meshes.
  */
@@ -184,6 +197,70 @@ public:
 
   virtual const BaseKernel* kernel() { return &mesh_; }
 
+  virtual const ArrayKernel* array_kernel() { return &mesh_; }
+
+
+  // bulk access (only if the mesh stores the data in the exported format)
+
+  const Vec3f* points_array() const
+  {
+    return array_cast<Vec3f>(mesh_.points());
+  }
+
+  const Vec3f* vertex_normals_array() const
+  {
+    return (mesh_.has_vertex_normals()
+            ? array_cast<Vec3f>(mesh_.vertex_normals())
+            : 0);
+  }
+
+  const Vec3uc* vertex_colors_array() const
+  {
+    return (mesh_.has_vertex_colors()
+            ? array_cast<Vec3uc>(mesh_.vertex_colors())
+            : 0);
+  }
+
+  const Vec3f* face_normals_array() const
+  {
+    return (mesh_.has_face_normals()
+            ? array_cast<Vec3f>(mesh_.property(mesh_.face_normals_pph()).data())
+            : 0);
+  }
+
+  size_t get_face_indices(std::vector<unsigned int>&  _indices,
+                          std::vector<unsigned int>*  _offsets=0) const
+  {
+    typename Mesh::ConstFaceIter f_it(mesh_.faces_begin()),
+                                 f_end(mesh_.faces_end());
+    typename Mesh::HalfedgeHandle heh, hend;
+
+    _indices.clear();
+    if (Mesh::is_triangles())
+      _indices.reserve(3*mesh_.n_faces());
+    if (_offsets)
+    {
+      _offsets->clear();
+      _offsets->reserve(mesh_.n_faces()+1);
+      _offsets->push_back(0);
+    }
+
+    // walk the halfedge loops directly, no circulators and virtual calls
+    for (; f_it!=f_end; ++f_it)
+    {
+      heh = hend = mesh_.halfedge_handle(f_it.handle());
+      do
+      {
+        _indices.push_back(mesh_.to_vertex_handle(heh).idx());
+        heh = mesh_.next_halfedge_handle(heh);
+      } while (heh != hend);
+
+      if (_offsets)
+        _offsets->push_back(_indices.size());
+    }
+    return _indices.size();
+  }
+
 
   // query number of faces, vertices, normals, texcoords
   size_t n_vertices()  const { return mesh_.n_vertices(); }   
@@ -202,6 +279,13 @@ public:
   bool has_face_normals()     const { return mesh_.has_face_normals();     }
   bool has_face_colors()      const { return mesh_.has_face_colors();      }
 
+private:
+
+  // pass through arrays that already have the requested type, else 0
+  template <class Dst, class Src>
+  static const Dst* array_cast(const Src* _p)
+  { return ArrayCastT<Dst, Src>::cast(_p); }
+
 private:
   
    const Mesh& mesh_;
@@ -56,11 +56,13 @@
 
 // STL
 #include <vector>
+#include <string>
 
 // OpenMesh
 #include <OpenMesh/Core/System/config.h>
 #include <OpenMesh/Core/Geometry/VectorT.hh>
 #include <OpenMesh/Core/Mesh/BaseKernel.hh>
+#include <OpenMesh/Core/Mesh/ArrayKernel.hh>
 
 
 //== NAMESPACES ===============================================================
@@ -73,6 +75,71 @@ namespace IO {
 //=== IMPLEMENTATION ==========================================================
 
 
+/** Working storage of the reader modules.
+
+    Readers fetch their temporary containers (face index lists, line
+    buffers, per file attribute lists) from the importer's scratch
+    context instead of allocating them per line or per face. Containers
+    are only cleared between uses, hence their capacity is kept.
+
+    By default every importer owns its scratch context. A caller loading
+    many files can provide its own context (see BaseImporter::set_scratch())
+    in order to reuse the memory across files. A context must not be
+    used by two importers concurrently.
+ */
+class ImportScratch
+{
+public:
+
+  /// vertex handles of the current face
+  std::vector<VertexHandle> vhandles;
+
+  /// texture coordinates of the current face
+  std::vector<Vec2f>        face_texcoords;
+
+  /// vertices of the current file in file order
+  std::vector<VertexHandle> vertices;
+
+  /// per file attribute lists
+  std::vector<Vec3f>        normals;
+  std::vector<Vec3uc>       colors;
+  std::vector<Vec2f>        texcoords;
+
+  /// line and token buffers
+  std::string               line;
+  std::string               word;
+
+  /// Clear all containers, keeps the allocated memory.
+  void clear()
+  {
+    vhandles.clear();
+    face_texcoords.clear();
+    vertices.clear();
+    normals.clear();
+    colors.clear();
+    texcoords.clear();
+    line.clear();
+    word.clear();
+  }
+
+  /// Free the allocated memory.
+  void release()
+  {
+    std::vector<VertexHandle>().swap(vhandles);
+    std::vector<Vec2f>().swap(face_texcoords);
+    std::vector<VertexHandle>().swap(vertices);
+    std::vector<Vec3f>().swap(normals);
+    std::vector<Vec3uc>().swap(colors);
+    std::vector<Vec2f>().swap(texcoords);
+    std::string().swap(line);
+    std::string().swap(word);
+  }
+};
+
+
+//-----------------------------------------------------------------------------
+
+
 /**  Base class for importer modules. Importer modules provide an
  *   interface between the loader modules and the target data
  *   structure. This is basically a wrapper providing virtual versions
@@ -82,6 +149,8 @@ class BaseImporter
 {
 public:
 
+  BaseImporter() : scratch_(0) {}
+
   // base class needs virtual destructor
   virtual ~BaseImporter() {}
 
@@ -136,8 +205,16 @@ public:
   // get reference to base kernel
   virtual BaseKernel* kernel() { return 0; }
 
+  // get the array kernel holding the connectivity, 0 if there is none
+  virtual ArrayKernel* array_kernel() { return 0; }
+
   virtual bool is_triangle_mesh()     const { return false; }
 
+  // called by readers of unindexed triangles (STL) before adding vertices,
+  // true if the importer merges vertices at equal positions itself. The
+  // reader then adds every corner as a new vertex.
+  virtual bool weld_vertices() { return false; }
+
   // reserve mem for elements
   virtual void reserve( unsigned int /* nV */,
 		                  unsigned int /* nE */,
@@ -154,6 +231,19 @@ public:
 
   // post-processing
   virtual void finish()  {}
+
+
+  /// Use \c _scratch as working storage of the readers (0: use own storage)
+  void set_scratch(ImportScratch* _scratch) { scratch_ = _scratch; }
+
+  /// Working storage of the readers
+  ImportScratch& scratch() { return scratch_ ? *scratch_ : own_scratch_; }
+
+
+private:
+
+  ImportScratch  own_scratch_;
+  ImportScratch* scratch_;
 };
 
 
@@ -86,7 +86,11 @@ public:
   typedef std::vector<VertexHandle>  VHandles;
 
 
-  ImporterT(Mesh& _mesh) : mesh_(_mesh) {}
+  /** Constructor. If \c _scratch is given, the readers use it as working
+      storage, this way the memory can be reused for several files.
+   */
+  ImporterT(Mesh& _mesh, ImportScratch* _scratch = 0) : mesh_(_mesh)
+  { set_scratch(_scratch); }
 
 
   virtual VertexHandle add_vertex(const Vec3f& _point)
@@ -241,6 +245,8 @@ public:
 
   virtual BaseKernel* kernel() { return &mesh_; }
 
+  virtual ArrayKernel* array_kernel() { return &mesh_; }
+
   bool is_triangle_mesh() const
   { return Mesh::is_triangles(); }
 
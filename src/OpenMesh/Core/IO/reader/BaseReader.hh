@@ -125,6 +125,15 @@ public:
   virtual bool can_u_read(const std::string& _filename) const;
 
 
+  /** Returns a new, unregistered copy of the module, or 0 if the module
+      keeps no state between calls. The IOManager reads through such a
+      private copy, so that several meshes can be read concurrently from
+      different threads. Modules that store per-file data in member
+      variables have to override this function.
+  */
+  virtual BaseReader* clone() const { return 0; }
+
+
 protected:
 
   // case insensitive search for _ext in _fname.
@@ -60,6 +60,8 @@
 using std::isspace;
 #endif
 
+#include <cstdlib>
+
 #ifndef WIN32
 #include <string.h>
 #endif
@@ -88,10 +90,40 @@ void trimString( std::string& _string) {
   size_t start = _string.find_first_not_of(" \t\r\n");
   size_t end   = _string.find_last_not_of(" \t\r\n");
 
+  // work in place, the string keeps its memory
   if(( std::string::npos == start ) || ( std::string::npos == end))
-    _string = "";
+    _string.erase();
   else
-    _string = _string.substr( start, end-start+1 );
+  {
+    _string.erase( end+1 );
+    _string.erase( 0, start );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+// Read a number from _p and advance _p behind it, returns false if there is
+// none. Used instead of a std::istream, which allocates a buffer per float.
+static bool readFloat( const char*& _p, float& _value ) {
+  char* end;
+#if defined(_MSC_VER) && (_MSC_VER < 1800)
+  _value = float(strtod( _p, &end ));
+#else
+  _value = strtof( _p, &end );
+#endif
+  if ( end == _p )
+    return false;
+  _p = end;
+  return true;
+}
+
+static bool readInt( const char*& _p, int& _value ) {
+  char* end;
+  _value = int(strtol( _p, &end, 10 ));
+  if ( end == _p )
+    return false;
+  _p = end;
+  return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -268,20 +300,30 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
   omlog() << "[OBJReader] : read file\n";
 
 
-  std::string line;
-  std::string keyWrd;
+  // temporary containers are taken from the importer's scratch context,
+  // their memory is reused for all lines and faces (and maybe files)
+  ImportScratch&             scratch        = _bi.scratch();
+  std::string&               line           = scratch.line;
+  std::string&               keyWrd         = scratch.word;
+  BaseImporter::VHandles&    vhandles       = scratch.vhandles;
+  std::vector<Vec3f>&        normals        = scratch.normals;
+  std::vector<Vec3uc>&       colors         = scratch.colors;
+  std::vector<Vec2f>&        texcoords      = scratch.texcoords;
+  std::vector<Vec2f>&        face_texcoords = scratch.face_texcoords;
+  std::vector<VertexHandle>& vertexHandles  = scratch.vertices;
+
+  scratch.clear();
 
   float                     x, y, z, u, v;
   int                       r, g, b;
-  BaseImporter::VHandles    vhandles;
-  std::vector<Vec3f>        normals;
-  std::vector<Vec3uc>       colors;
-  std::vector<Vec2f>        texcoords;
-  std::vector<Vec2f>        face_texcoords;
-  std::vector<VertexHandle> vertexHandles;
 
   std::string               matname;
 
+  // one stream for all lines, constructing a stream per line is expensive.
+  // Numbers are parsed from the line directly, the line is trimmed and
+  // starts with the keyword.
+  std::istringstream        stream;
+
 
   while( _in && !_in.eof() )
   {
@@ -299,7 +341,8 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
       continue;
     }
 
-    std::stringstream stream(line);
+    stream.clear();
+    stream.str(line);
 
     stream >> keyWrd;
 
@@ -354,14 +397,13 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
     // vertex
     else if (keyWrd == "v")
     {
-      stream >> x; stream >> y; stream >> z;
+      const char* p = line.c_str() + keyWrd.size();
 
-      if ( !stream.fail() )
+      if ( readFloat(p, x) && readFloat(p, y) && readFloat(p, z) )
       {
         vertexHandles.push_back(_bi.add_vertex(OpenMesh::Vec3f(x,y,z)));
-        stream >> r; stream >> g; stream >> b;
 
-        if ( !stream.fail() )
+        if ( readInt(p, r) && readInt(p, g) && readInt(p, b) )
         {
           _opt += Options::VertexColor;
           colors.push_back(OpenMesh::Vec3uc((unsigned char)r,(unsigned char)g,(unsigned char)b));
@@ -372,9 +414,9 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
     // texture coord
     else if (keyWrd == "vt")
     {
-      stream >> u; stream >> v;
+      const char* p = line.c_str() + keyWrd.size();
 
-      if ( !stream.fail() ){
+      if ( readFloat(p, u) && readFloat(p, v) ){
 
         texcoords.push_back(OpenMesh::Vec2f(u, v));
         _opt += Options::VertexTexCoord;
@@ -390,9 +432,9 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
     // color per vertex
     else if (keyWrd == "vc")
     {
-      stream >> r; stream >> g; stream >> b;
+      const char* p = line.c_str() + keyWrd.size();
 
-      if ( !stream.fail() ){
+      if ( readInt(p, r) && readInt(p, g) && readInt(p, b) ){
         colors.push_back(OpenMesh::Vec3uc((unsigned char)r,(unsigned char)g,(unsigned char)b));
         _opt += Options::VertexColor;
       }
@@ -401,9 +443,9 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
     // normal
     else if (keyWrd == "vn")
     {
-      stream >> x; stream >> y; stream >> z;
+      const char* p = line.c_str() + keyWrd.size();
 
-      if ( !stream.fail() ){
+      if ( readFloat(p, x) && readFloat(p, y) && readFloat(p, z) ){
         normals.push_back(OpenMesh::Vec3f(x,y,z));
         _opt += Options::VertexNormal;
       }
@@ -413,67 +455,38 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
     // face
     else if (keyWrd == "f")
     {
-      int component(0), nV(0);
+      int component;
       int value;
 
       vhandles.clear();
       face_texcoords.clear();
 
-      // read full line after detecting a face
-      std::string faceLine;
-      std::getline(stream,faceLine);
-      std::stringstream lineData( faceLine );
+      const char* p = line.c_str() + keyWrd.size();
 
       // work on the line until nothing left to read
-      while ( !lineData.eof() )
+      while ( *p )
       {
-        // read one block from the line ( vertex/texCoord/normal )
-        std::string vertex;
-        lineData >> vertex;
-
-        do{
+        // skip white space in front of the next block
+        while ( *p && isspace(*p) ) ++p;
+        if ( !*p ) break;
 
-          //get the component (vertex/texCoord/normal)
-          size_t found=vertex.find("/");
-
-          // parts are seperated by '/' So if no '/' found its the last component
-          if( found != std::string::npos ){
-
-            // read the index value
-            std::stringstream tmp( vertex.substr(0,found) );
-
-            // If we get an empty string this property is undefined in the file
-            if ( vertex.substr(0,found).empty() ) {
-              // Switch to next field
-              vertex = vertex.substr(found+1);
-
-              // Now we are at the next component
-              ++component;
-
-              // Skip further processing of this component
-              continue;
-            }
-
-            // Read current value
-            tmp >> value;
-
-            // remove the read part from the string
-            vertex = vertex.substr(found+1);
-
-          } else {
-
-            // last component of the vertex, read it.
-            std::stringstream tmp( vertex );
-            tmp >> value;
+        // read one block from the line ( vertex/texCoord/normal ),
+        // parts are seperated by '/'
+        for ( component = 0; *p && !isspace(*p); ++component )
+        {
+          // read the index value
+          char* end;
+          value = int(strtol(p, &end, 10));
+          bool found = (end != p);
 
-            // Clear vertex after finished reading the line
-            vertex="";
+          // skip the rest of the part ( garbage ) and the separator
+          p = end;
+          while ( *p && *p != '/' && !isspace(*p) ) ++p;
+          if ( *p == '/' ) ++p;
 
-            // Nothing to read here ( garbage at end of line )
-            if ( tmp.fail() ) {
-              continue;
-            }
-          }
+          // If we get an empty part this property is undefined in the file
+          if ( !found )
+            continue;
 
           // store the component ( each component is referenced by the index here! )
           switch (component)
@@ -522,15 +535,7 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
               _bi.set_normal(vhandles.back(), normals[value-1]);
               break;
           }
-
-          // Prepare for reading next component
-          ++component;
-
-          // Read until line does not contain any other info
-        } while ( !vertex.empty() );
-
-        component = 0;
-        nV++;
+        }
       }
 
 
@@ -540,21 +545,18 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
       if( !vhandles.empty() && fh.is_valid() )
 	     _bi.add_face_texcoords( fh, vhandles[0], face_texcoords );
 
+      // faces added for this line ( polygons may have been triangulated )
+      const size_t n_new_faces = _bi.n_faces() - n_faces;
+
       if ( !matname.empty()  )
       {
-        std::vector<FaceHandle> newfaces;
-
-        for( size_t i=0; i < _bi.n_faces()-n_faces; ++i )
-          newfaces.push_back(FaceHandle(n_faces+i));
-
         Material& mat = materials_[matname];
 
         if ( mat.has_Kd() ) {
           Vec3uc fc = color_cast<Vec3uc, Vec3f>(mat.Kd());
 
-          for (std::vector<FaceHandle>::iterator it  = newfaces.begin();
-                                                 it != newfaces.end(); ++it)
-            _bi.set_color( *it, fc );
+          for( size_t i=0; i < n_new_faces; ++i )
+            _bi.set_color( FaceHandle(n_faces+i), fc );
 
           _opt += Options::FaceColor;
         }
@@ -562,27 +564,19 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
         // Set the texture index in the face index property
         if ( mat.has_map_Kd() ) {
 
-          for (std::vector<FaceHandle>::iterator it  = newfaces.begin();
-                                                 it != newfaces.end(); ++it)
-            _bi.set_face_texindex( *it, mat.map_Kd_index() );
+          for( size_t i=0; i < n_new_faces; ++i )
+            _bi.set_face_texindex( FaceHandle(n_faces+i), mat.map_Kd_index() );
 
         } else {
           // If we don't have the info, set it to no texture
-          for (std::vector<FaceHandle>::iterator it  = newfaces.begin();
-                                                 it != newfaces.end(); ++it)
-            _bi.set_face_texindex( *it, 0 );
+          for( size_t i=0; i < n_new_faces; ++i )
+            _bi.set_face_texindex( FaceHandle(n_faces+i), 0 );
         }
 
       } else {
-        std::vector<FaceHandle> newfaces;
-
-        for( size_t i=0; i < _bi.n_faces()-n_faces; ++i )
-          newfaces.push_back(FaceHandle(n_faces+i));
-
         // Set the texture index to zero as we don't have any information
-        for (std::vector<FaceHandle>::iterator it  = newfaces.begin();
-                                              it != newfaces.end(); ++it)
-          _bi.set_face_texindex( *it, 0 );
+        for( size_t i=0; i < n_new_faces; ++i )
+          _bi.set_face_texindex( FaceHandle(n_faces+i), 0 );
       }
 
     }
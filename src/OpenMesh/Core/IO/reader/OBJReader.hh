@@ -98,6 +98,8 @@ public:
           BaseImporter& _bi,
           Options& _opt);
 
+  BaseReader* clone() const { return new _OBJReader_(*this); }
+
 private:
 
 #ifndef DOXY_IGNORE_THIS
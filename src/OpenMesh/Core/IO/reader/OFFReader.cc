@@ -186,9 +186,16 @@ omlog() << "[OFFReader] : read ascii file\n";
   OpenMesh::Vec3f         c3f;
   OpenMesh::Vec4i         c4;
   OpenMesh::Vec4f         c4f;
-  BaseImporter::VHandles  vhandles;
   VertexHandle            vh;
 
+  // temporary containers are taken from the importer's scratch context
+  BaseImporter::VHandles& vhandles = _bi.scratch().vhandles;
+  std::string&            line     = _bi.scratch().line;
+  std::string&            trash    = _bi.scratch().word;
+
+  // one stream for the color specifications of all elements
+  std::istringstream      stream;
+
   // read header line
   std::string header;
   std::getline(_in,header);
@@ -218,18 +225,16 @@ omlog() << "[OFFReader] : read ascii file\n";
     }
 
     //take the rest of the line and check how colors are defined
-    std::string line;
     std::getline(_in,line);
 
     int colorType = getColorType(line, options_.vertex_has_texcoord() );
 
-    std::stringstream stream( line );
+    stream.clear();
+    stream.str(line);
 
     //perhaps read COLOR
     if ( options_.vertex_has_color() ){
 
-      std::string trash;
-
       switch (colorType){
         case 0 : break; //no color
         case 1 : stream >> trash; break; //one int (isn't handled atm)
@@ -302,14 +307,12 @@ omlog() << "[OFFReader] : read ascii file\n";
     if ( options_.face_has_color() ){
 
       //take the rest of the line and check how colors are defined
-      std::string line;
       std::getline(_in,line);
 
       int colorType = getColorType(line, false );
 
-      std::stringstream stream( line );
-
-      std::string trash;
+      stream.clear();
+      stream.str(line);
 
       switch (colorType){
         case 0 : break; //no color
@@ -366,11 +369,13 @@ int _OFFReader_::getColorType(std::string& _line, bool _texCoordsAvailable) cons
 	if ( _line.size() < 1 )
 		return 0;
 
-    //first remove spaces at start/end of the line
-    while (_line.size() > 0 && std::isspace(_line[0]))
-      _line = _line.substr(1);
+    //first remove spaces at start/end of the line (in place, no reallocation)
+    size_t start = 0;
+    while (start < _line.size() && std::isspace(_line[start]))
+      ++start;
+    _line.erase(0, start);
     while (_line.size() > 0 && std::isspace(_line[ _line.length()-1 ]))
-      _line = _line.substr(0, _line.length()-1);
+      _line.erase(_line.length()-1);
 
     //count the remaining items in the line
     size_t found;
@@ -387,11 +392,10 @@ int _OFFReader_::getColorType(std::string& _line, bool _texCoordsAvailable) cons
     if (_texCoordsAvailable) count -= 2;
 
     if (count == 3 || count == 4){
-      //get first item
+      //check if the first item is a float
       found = _line.find(" ");
-      std::string c1 = _line.substr (0,found);
 
-      if (c1.find(".") != std::string::npos){
+      if (_line.find(".") < found){
         if (count == 3)
           count = 5;
         else
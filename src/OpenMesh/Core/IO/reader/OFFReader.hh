@@ -130,6 +130,8 @@ public:
 
   bool can_u_read(const std::string& _filename) const;
 
+  BaseReader* clone() const { return new _OFFReader_(*this); }
+
   bool read(std::istream& _in, BaseImporter& _bi, Options& _opt );
 
 private:
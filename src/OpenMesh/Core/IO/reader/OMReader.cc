@@ -74,6 +74,7 @@ _OMReader_&  OMReader() { return __OMReaderInstance; }
 
 
 _OMReader_::_OMReader_()
+  : connectivity_read_(false)
 {
   IOManager().register_module(this);
 }
@@ -150,6 +151,7 @@ bool _OMReader_::read_binary(std::istream& _is, BaseImporter& _bi, Options& _opt
 
   // Initialize byte counter
   bytes_ = 0;
+  connectivity_read_ = false;
 
   bytes_ += restore(_is, header_, swap);
 
@@ -367,6 +369,20 @@ bool _OMReader_::read_binary_face_chunk(std::istream &_is, BaseImporter &_bi, Op
           break;
       }
 
+      // faces are already restored from the connectivity chunk, skip the list
+      if (connectivity_read_) {
+        const size_t size_of = size_t(1) << chunk_header_.bits_; // Integer_Size
+
+        for (; fidx < header_.n_faces_; ++fidx) {
+          if (header_.mesh_ == 'P')
+            bytes_ += restore(_is, nV, Chunk::Integer_16, _swap);
+
+          _is.ignore(nV * size_of);
+          bytes_ += nV * size_of;
+        }
+        break;
+      }
+
       for (; fidx < header_.n_faces_; ++fidx) {
         if (header_.mesh_ == 'P')
           bytes_ += restore(_is, nV, Chunk::Integer_16, _swap);
@@ -482,7 +498,7 @@ bool _OMReader_::read_binary_halfedge_chunk(std::istream &_is, BaseImporter &_bi
 
 //-----------------------------------------------------------------------------
 
-bool _OMReader_::read_binary_mesh_chunk(std::istream &_is, BaseImporter &_bi, Options & /* _opt */, bool _swap) const
+bool _OMReader_::read_binary_mesh_chunk(std::istream &_is, BaseImporter &_bi, Options &_opt, bool _swap) const
 {
   using OMFormat::Chunk;
 
@@ -493,7 +509,10 @@ bool _OMReader_::read_binary_mesh_chunk(std::istream &_is, BaseImporter &_bi, Op
   switch (chunk_header_.type_) {
     case Chunk::Type_Custom:
 
-      bytes_ += restore_binary_custom_data(_is, _bi.kernel()->_get_mprop(property_name_), 1, _swap);
+      if (property_name_ == Chunk::connectivity_name())
+        bytes_ += restore_binary_connectivity(_is, _bi, _opt, _swap);
+      else
+        bytes_ += restore_binary_custom_data(_is, _bi.kernel()->_get_mprop(property_name_), 1, _swap);
 
       break;
 
@@ -511,6 +530,138 @@ bool _OMReader_::read_binary_mesh_chunk(std::istream &_is, BaseImporter &_bi, Op
 //-----------------------------------------------------------------------------
 
 
+size_t _OMReader_::restore_binary_connectivity(std::istream& _is, BaseImporter& _bi, Options& _opt, bool _swap) const
+{
+  using OMFormat::Chunk;
+
+  size_t bytes = 0;
+  Chunk::esize_t block_size;
+  OMFormat::uint32 nV, nE, nF, status_mask;
+
+  bytes += binary<Chunk::esize_t>::restore(_is, block_size, _swap);
+  bytes += binary<OMFormat::uint32>::restore(_is, nV, _swap);
+  bytes += binary<OMFormat::uint32>::restore(_is, nE, _swap);
+  bytes += binary<OMFormat::uint32>::restore(_is, nF, _swap);
+  bytes += binary<OMFormat::uint32>::restore(_is, status_mask, _swap);
+
+  const size_t nH = 2 * size_t(nE);
+
+  size_t n_status = 0;
+  if (status_mask & Chunk::Status_Vertex)   n_status += nV;
+  if (status_mask & Chunk::Status_Halfedge) n_status += nH;
+  if (status_mask & Chunk::Status_Edge)     n_status += nE;
+  if (status_mask & Chunk::Status_Face)     n_status += nF;
+
+  // The snapshot replaces the face list only if the target holds nothing but
+  // the vertices read so far. Polygons are not forced into a triangle mesh,
+  // in that case the faces are added from the face list as usual.
+  ArrayKernel* kernel = _bi.array_kernel();
+
+  bool use = kernel
+      && nV == header_.n_vertices_ && nE == header_.n_edges_ && nF == header_.n_faces_
+      && block_size == sizeof(OMFormat::uint32) * 4
+                      + sizeof(OMFormat::int32) * (nV + 4 * nH + nF + n_status)
+      && kernel->n_vertices() == nV && kernel->n_edges() == 0 && kernel->n_faces() == 0
+      && (header_.mesh_ == 'T' || !_bi.is_triangle_mesh());
+
+  if (!use) {
+    // the block size covers the counts and the mask read above
+    const size_t n_skip = (block_size > bytes - sizeof(Chunk::esize_t))
+                        ? block_size - (bytes - sizeof(Chunk::esize_t)) : 0;
+
+    omlog() << "[OMReader] : connectivity chunk skipped\n";
+    _is.ignore(n_skip);
+    return bytes + n_skip;
+  }
+
+  std::vector<int> vertices(nV), halfedges(4 * nH), faces(nF);
+  std::vector<unsigned int> status(n_status);
+
+  if (!vertices.empty())  bytes += restore(_is, vertices,  _swap);
+  if (!halfedges.empty()) bytes += restore(_is, halfedges, _swap);
+  if (!faces.empty())     bytes += restore(_is, faces,     _swap);
+  if (!status.empty())    bytes += restore(_is, status,    _swap);
+
+  // reject handles out of range, the face list is used instead
+  size_t i;
+
+  for (i = 0; i < nV; ++i)
+    use = use && vertices[i] >= -1 && vertices[i] < int(nH);
+
+  for (i = 0; i < nH; ++i)
+    use = use && halfedges[4*i  ] >= -1 && halfedges[4*i  ] < int(nV)
+              && halfedges[4*i+1] >= -1 && halfedges[4*i+1] < int(nH)
+              && halfedges[4*i+2] >= -1 && halfedges[4*i+2] < int(nH)
+              && halfedges[4*i+3] >= -1 && halfedges[4*i+3] < int(nF);
+
+  for (i = 0; i < nF; ++i)
+    use = use && faces[i] >= -1 && faces[i] < int(nH);
+
+  if (!use || !_is.good()) {
+    omerr() << "[OMReader] : Invalid connectivity chunk ignored!\n";
+    return bytes;
+  }
+
+  kernel->resize(nV, nE, nF);
+
+  for (i = 0; i < nV; ++i)
+    kernel->set_halfedge_handle(VertexHandle(i), HalfedgeHandle(vertices[i]));
+
+  // set_next_halfedge_handle() links the previous halfedge too, the stored
+  // ones are set afterwards since halfedges of deleted edges may be stale
+  for (i = 0; i < nH; ++i) {
+    HalfedgeHandle heh(i);
+
+    kernel->set_vertex_handle(heh, VertexHandle(halfedges[4*i]));
+    kernel->set_face_handle(heh, FaceHandle(halfedges[4*i+3]));
+    if (halfedges[4*i+1] != -1)
+      kernel->set_next_halfedge_handle(heh, HalfedgeHandle(halfedges[4*i+1]));
+  }
+
+  for (i = 0; i < nH; ++i)
+    if (halfedges[4*i+2] != -1)
+      kernel->set_prev_halfedge_handle(HalfedgeHandle(i), HalfedgeHandle(halfedges[4*i+2]));
+
+  for (i = 0; i < nF; ++i)
+    kernel->set_halfedge_handle(FaceHandle(i), HalfedgeHandle(faces[i]));
+
+  // status bits, as far as the target provides the status
+  std::vector<unsigned int>::const_iterator s_it = status.begin();
+
+  if (status_mask & Chunk::Status_Vertex) {
+    if (kernel->has_vertex_status())
+      for (i = 0; i < nV; ++i)
+        kernel->status(VertexHandle(i)).set_bits(s_it[i]);
+    s_it += nV;
+  }
+  if (status_mask & Chunk::Status_Halfedge) {
+    if (kernel->has_halfedge_status())
+      for (i = 0; i < nH; ++i)
+        kernel->status(HalfedgeHandle(i)).set_bits(s_it[i]);
+    s_it += nH;
+  }
+  if (status_mask & Chunk::Status_Edge) {
+    if (kernel->has_edge_status())
+      for (i = 0; i < nE; ++i)
+        kernel->status(EdgeHandle(i)).set_bits(s_it[i]);
+    s_it += nE;
+  }
+  if (status_mask & Chunk::Status_Face) {
+    if (kernel->has_face_status())
+      for (i = 0; i < nF; ++i)
+        kernel->status(FaceHandle(i)).set_bits(s_it[i]);
+  }
+
+  connectivity_read_ = true;
+  _opt += Options::Connectivity;
+
+  return bytes;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
 size_t _OMReader_::restore_binary_custom_data(std::istream& _is, BaseProperty* _bp, size_t _n_elem, bool _swap) const
 {
   assert( !_bp || (_bp->name() == property_name_));
@@ -101,6 +101,8 @@ public:
 	    Options& _opt );
 	    
   virtual bool can_u_read(const std::string& _filename) const;
+
+  BaseReader* clone() const { return new _OMReader_(*this); }
   virtual bool can_u_read(std::istream& _is) const;
 
   
@@ -120,6 +122,7 @@ private:
   mutable Header       header_;
   mutable ChunkHeader  chunk_header_;
   mutable PropertyName property_name_;
+  mutable bool         connectivity_read_;
 
   bool read_binary_vertex_chunk(   std::istream      &_is, 
 				   BaseImporter      &_bi, 
@@ -146,6 +149,11 @@ private:
 				   Options           &_opt,
 				   bool              _swap) const;
 
+  size_t restore_binary_connectivity( std::istream& _is,
+				      BaseImporter& _bi,
+				      Options& _opt,
+				      bool _swap) const;
+
   size_t restore_binary_custom_data( std::istream& _is, 
 				     BaseProperty* _bp,
 				     size_t _n_elem, 
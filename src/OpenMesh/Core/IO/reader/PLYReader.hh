@@ -109,6 +109,8 @@ public:
 
   bool can_u_read(const std::string& _filename) const;
 
+  BaseReader* clone() const { return new _PLYReader_(*this); }
+
   enum ValueType {
     Unsupported,
     ValueTypeINT8, ValueTypeCHAR,
@@ -228,6 +228,9 @@ read_stla(const std::string& _filename, BaseImporter& _bi) const
 
   bool normal = false;
 
+  // the importer may merge the vertices itself
+  const bool weld = !_bi.weld_vertices();
+
   while( in && !in.eof() ) {
 
     // Get one line
@@ -280,7 +283,12 @@ read_stla(const std::string& _filename, BaseImporter& _bi) const
         strstream >> v[2];
 
         // has vector been referenced before?
-        if ((vMapIt=vMap.find(v)) == vMap.end())
+        if (!weld)
+        {
+          _bi.add_vertex(v);
+          vhandles.push_back(VertexHandle(cur_idx++));
+        }
+        else if ((vMapIt=vMap.find(v)) == vMap.end())
         {
           // No : add vertex and remember idx/vector mapping
           _bi.add_vertex(v);
@@ -359,6 +367,9 @@ read_stlb(const std::string& _filename, BaseImporter& _bi) const
   fread(dummy, 1, 80, in);
   nT = read_int(in, swapFlag);
 
+  // the importer may merge the vertices itself
+  const bool weld = !_bi.weld_vertices();
+
   // read triangles
   while (nT)
   {
@@ -375,7 +386,12 @@ read_stlb(const std::string& _filename, BaseImporter& _bi) const
       v[2] = read_float(in, swapFlag);
 
       // has vector been referenced before?
-      if ((vMapIt=vMap.find(v)) == vMap.end())
+      if (!weld)
+      {
+	_bi.add_vertex(v);
+	vhandles.push_back(VertexHandle(cur_idx++));
+      }
+      else if ((vMapIt=vMap.find(v)) == vMap.end())
       {
 	// No : add vertex and remember idx/vector mapping
 	_bi.add_vertex(v);
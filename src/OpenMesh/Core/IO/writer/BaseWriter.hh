@@ -109,6 +109,11 @@ public:
   /// Returns expected size of file if binary format is supported else 0.
   virtual size_t binary_size(BaseExporter&, Options) const { return 0; }
 
+  /** Returns a new, unregistered copy of the module, or 0 if the module
+      keeps no state between calls (see BaseReader::clone()).
+  */
+  virtual BaseWriter* clone() const { return 0; }
+
 
 
 protected:
@@ -95,6 +95,8 @@ public:
 
   size_t binary_size(BaseExporter&, Options) const { return 0; }
 
+  BaseWriter* clone() const { return new _OBJWriter_(*this); }
+
 private:
 
   mutable std::string path_;
@@ -182,7 +182,8 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
   unsigned int i, nV, nF;
   Vec3f v;
   Vec2f t;
-  std::vector<VertexHandle> vhandles;
+  std::vector<Vec3f>  buffer3f;
+  std::vector<Vec3uc> buffer3uc;
 
 
   // -------------------- write header
@@ -219,8 +220,8 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
     chunk_header.bits_     = OMFormat::bits(v[0]);
   
     bytes += store( _os, chunk_header, swap );
-    for (i=0, nV=_be.n_vertices(); i<nV; ++i)
-      bytes += vector_store( _os, _be.point(VertexHandle(i)), swap );
+    bytes += store_array( _os, _be.get_points(buffer3f), _be.n_vertices(),
+                          swap );
   }
 
 
@@ -238,8 +239,8 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
     chunk_header.bits_     = OMFormat::bits(n[0]);
   
     bytes += store( _os, chunk_header, swap );
-    for (i=0, nV=_be.n_vertices(); i<nV; ++i)
-      bytes += vector_store( _os, _be.normal(VertexHandle(i)), swap );
+    bytes += store_array( _os, _be.get_vertex_normals(buffer3f),
+                          _be.n_vertices(), swap );
   }
 
   // ---------- write vertex color
@@ -256,8 +257,8 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
     chunk_header.bits_     = OMFormat::bits( c );    
 
     bytes += store( _os, chunk_header, swap );
-    for (i=0, nV=_be.n_vertices(); i<nV; ++i)
-      bytes += vector_store( _os, _be.color(VertexHandle(i)), swap );
+    bytes += store_array( _os, _be.get_vertex_colors(buffer3uc),
+                          _be.n_vertices(), swap );
   }
 
   // ---------- write vertex texture coords
@@ -282,6 +283,11 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
 
   // -------------------- write face data
 
+  // ---------- write connectivity
+
+  if ( _opt.check(Options::Connectivity) && _be.array_kernel() )
+    bytes += store_binary_connectivity_chunk( _os, *_be.array_kernel(), swap );
+
   // ---------- write topology
   {
     chunk_header.name_     = false;
@@ -294,19 +300,21 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
 
     bytes += store( _os, chunk_header, swap );
 
+    std::vector<unsigned int> indices, offsets;
+    _be.get_face_indices(indices, &offsets);
+
     for (i=0, nF=_be.n_faces(); i<nF; ++i)
     {
-      nV = _be.get_vhandles(FaceHandle(i), vhandles);
       if ( header.mesh_ == 'P' )
-	bytes += store( _os, vhandles.size(), 
+	bytes += store( _os, size_t(offsets[i+1] - offsets[i]), 
 			OMFormat::Chunk::Integer_16, swap );
       
-      for (size_t j=0; j < vhandles.size(); ++j)
+      for (size_t j=offsets[i]; j < offsets[i+1]; ++j)
       {
 	using namespace OMFormat;
 	using namespace GenProg;
 	
-	bytes += store( _os, vhandles[j].idx(),
+	bytes += store( _os, (int)indices[j],
 			Chunk::Integer_Size(chunk_header.bits_), swap );
       }
     }
@@ -335,8 +343,8 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
   
       bytes += store( _os, chunk_header, swap );
 #if !NEW_STYLE
-      for (i=0, nF=_be.n_faces(); i<nF; ++i)
-        bytes += vector_store( _os, _be.normal(FaceHandle(i)), swap );
+      bytes += store_array( _os, _be.get_face_normals(buffer3f),
+                            _be.n_faces(), swap );
 #else
       bytes += bp->store(_os, swap );
     }
@@ -489,6 +497,113 @@ size_t _OMWriter_::store_binary_custom_chunk(std::ostream& _os,
 
 // ----------------------------------------------------------------------------
 
+size_t _OMWriter_::store_binary_connectivity_chunk(std::ostream& _os,
+                                                   const ArrayKernel& _kernel,
+                                                   bool _swap) const
+{
+  omlog() << "Connectivity snapshot" << std::endl;
+
+  const unsigned int nV = _kernel.n_vertices();
+  const unsigned int nE = _kernel.n_edges();
+  const unsigned int nH = _kernel.n_halfedges();
+  const unsigned int nF = _kernel.n_faces();
+  unsigned int i;
+
+  // handles of the kernel items
+  std::vector<int> vertices(nV), halfedges(4*nH), faces(nF);
+
+  for (i=0; i<nV; ++i)
+    vertices[i] = _kernel.halfedge_handle(VertexHandle(i)).idx();
+
+  for (i=0; i<nH; ++i)
+  {
+    HalfedgeHandle heh(i);
+    halfedges[4*i  ] = _kernel.to_vertex_handle(heh).idx();
+    halfedges[4*i+1] = _kernel.next_halfedge_handle(heh).idx();
+    halfedges[4*i+2] = _kernel.prev_halfedge_handle(heh).idx();
+    halfedges[4*i+3] = _kernel.face_handle(heh).idx();
+  }
+
+  for (i=0; i<nF; ++i)
+    faces[i] = _kernel.halfedge_handle(FaceHandle(i)).idx();
+
+  // status bits of the items whose status is available
+  OMFormat::uint32 status_mask = 0;
+  std::vector<unsigned int> status;
+
+  if (_kernel.has_vertex_status())
+  {
+    status_mask |= OMFormat::Chunk::Status_Vertex;
+    for (i=0; i<nV; ++i)
+      status.push_back(_kernel.status(VertexHandle(i)).bits());
+  }
+  if (_kernel.has_halfedge_status())
+  {
+    status_mask |= OMFormat::Chunk::Status_Halfedge;
+    for (i=0; i<nH; ++i)
+      status.push_back(_kernel.status(HalfedgeHandle(i)).bits());
+  }
+  if (_kernel.has_edge_status())
+  {
+    status_mask |= OMFormat::Chunk::Status_Edge;
+    for (i=0; i<nE; ++i)
+      status.push_back(_kernel.status(EdgeHandle(i)).bits());
+  }
+  if (_kernel.has_face_status())
+  {
+    status_mask |= OMFormat::Chunk::Status_Face;
+    for (i=0; i<nF; ++i)
+      status.push_back(_kernel.status(FaceHandle(i)).bits());
+  }
+
+  size_t bytes = 0;
+
+  OMFormat::Chunk::Header chdr;
+
+  // set header, the snapshot is a named custom mesh chunk so that readers
+  // without support skip it by its block size
+  chdr.name_     = true;
+  chdr.entity_   = OMFormat::Chunk::Entity_Mesh;
+  chdr.type_     = OMFormat::Chunk::Type_Custom;
+  chdr.signed_   = 0;
+  chdr.float_    = 0;
+  chdr.dim_      = OMFormat::Chunk::Dim_1D; // ignored
+  chdr.bits_     = 0;
+
+  // 1. chunk header
+  bytes += store( _os, chdr, _swap );
+
+  // 2. chunk name
+  bytes += store( _os, OMFormat::Chunk::PropertyName(OMFormat::Chunk::connectivity_name()), _swap );
+
+  // 3. block size, includes the item counts and the status mask
+  OMFormat::Chunk::esize_t block_size =
+    OMFormat::Chunk::esize_t( sizeof(OMFormat::uint32) * 4 +
+                              sizeof(OMFormat::int32) *
+                              (vertices.size() + halfedges.size() +
+                               faces.size() + status.size()) );
+
+  bytes += store( _os, block_size, _swap );
+
+  // 4. item counts and status mask
+  bytes += store( _os, OMFormat::uint32(nV), _swap );
+  bytes += store( _os, OMFormat::uint32(nE), _swap );
+  bytes += store( _os, OMFormat::uint32(nF), _swap );
+  bytes += store( _os, status_mask, _swap );
+
+  // 5. data
+  if (!vertices.empty())  bytes += store( _os, vertices,  _swap );
+  if (!halfedges.empty()) bytes += store( _os, halfedges, _swap );
+  if (!faces.empty())     bytes += store( _os, faces,     _swap );
+  if (!status.empty())    bytes += store( _os, status,    _swap );
+
+  omlog() << "  n_bytes = " << block_size << std::endl;
+
+  return bytes;
+}
+
+// ----------------------------------------------------------------------------
+
 size_t _OMWriter_::binary_size(BaseExporter& /* _be */, Options /* _opt */) const
 {
   // std::clog << "[OMWriter]: binary_size()" << std::endl;
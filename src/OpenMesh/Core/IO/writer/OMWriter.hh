@@ -121,6 +121,9 @@ protected:
 
   size_t store_binary_custom_chunk( std::ostream&, const BaseProperty&,
 				    OMFormat::Chunk::Entity, bool) const;
+
+  size_t store_binary_connectivity_chunk( std::ostream&, const ArrayKernel&,
+                                          bool) const;
 };
 
 
@@ -378,7 +378,6 @@ write_binary(std::ostream& _out, BaseExporter& _be, Options _opt) const
   Vec2f t;
   OpenMesh::Vec4f c;
   VertexHandle vh;
-  std::vector<VertexHandle> vhandles;
 
   //writing header
   _out << "ply" << std::endl;
@@ -421,11 +420,18 @@ write_binary(std::ostream& _out, BaseExporter& _be, Options _opt) const
   _out << "property list uchar int32 vertex_indices" << std::endl;
   _out << "end_header" << std::endl;
 
+  // fetch positions, normals and face indices in bulk
+  std::vector<Vec3f>         points_buf, normals_buf;
+  std::vector<unsigned int>  indices, offsets;
+  const Vec3f* points  = _be.get_points(points_buf);
+  const Vec3f* normals = (_opt.vertex_has_normal() ?
+                          _be.get_vertex_normals(normals_buf) : 0);
+
   // vertex data (point, normals, texcoords)
   for (i=0, nV=_be.n_vertices(); i<nV; ++i)
   {
     vh = VertexHandle(i);
-    v  = _be.point(vh);
+    v  = points[i];
 
     //vertex
     writeValue(ValueTypeFLOAT, _out, v[0]);
@@ -434,7 +440,7 @@ write_binary(std::ostream& _out, BaseExporter& _be, Options _opt) const
 
     // Vertex Normal
     if ( _opt.vertex_has_normal() ){
-      n = _be.normal(vh);
+      n = normals[i];
       writeValue(ValueTypeFLOAT, _out, n[0]);
       writeValue(ValueTypeFLOAT, _out, n[1]);
       writeValue(ValueTypeFLOAT, _out, n[2]);
@@ -460,16 +466,17 @@ write_binary(std::ostream& _out, BaseExporter& _be, Options _opt) const
   }
 
   // faces (indices starting at 0)
+  _be.get_face_indices(indices, &offsets);
+
   if (_be.is_triangle_mesh())
   {
     for (i=0, nF=_be.n_faces(); i<nF; ++i)
     {
       //face
-      _be.get_vhandles(FaceHandle(i), vhandles);
       writeValue(ValueTypeUINT8, _out, 3);
-      writeValue(ValueTypeINT32, _out, vhandles[0].idx());
-      writeValue(ValueTypeINT32, _out, vhandles[1].idx());
-      writeValue(ValueTypeINT32, _out, vhandles[2].idx());
+      writeValue(ValueTypeINT32, _out, (int)indices[3*i  ]);
+      writeValue(ValueTypeINT32, _out, (int)indices[3*i+1]);
+      writeValue(ValueTypeINT32, _out, (int)indices[3*i+2]);
 
 //       //face color
 //       if ( _opt.face_has_color() ){
@@ -488,10 +495,10 @@ write_binary(std::ostream& _out, BaseExporter& _be, Options _opt) const
     for (i=0, nF=_be.n_faces(); i<nF; ++i)
     {
       //face
-      nV = _be.get_vhandles(FaceHandle(i), vhandles);
+      nV = offsets[i+1] - offsets[i];
       writeValue(ValueTypeUINT8, _out, nV);
-      for (j=0; j<vhandles.size(); ++j)
-        writeValue(ValueTypeINT32, _out, vhandles[j].idx() );
+      for (j=offsets[i]; j<offsets[i+1]; ++j)
+        writeValue(ValueTypeINT32, _out, (int)indices[j] );
 
 //       //face color
 //       if ( _opt.face_has_color() ){
@@ -101,6 +101,8 @@ public:
   
   size_t binary_size(BaseExporter& _be, Options _opt) const;
 
+  BaseWriter* clone() const { return new _PLYWriter_(*this); }
+
   enum ValueType {
     Unsupported ,
     ValueTypeFLOAT32, ValueTypeFLOAT,
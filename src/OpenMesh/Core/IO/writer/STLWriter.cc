@@ -45,6 +45,7 @@
 
 //STL
 #include <fstream>
+#include <cstring>
 
 // OpenMesh
 #include <OpenMesh/Core/System/config.h>
@@ -147,10 +148,16 @@ write_stla(const std::string& _filename, BaseExporter& _be, Options /* _opt */)
 
 
 
-  unsigned int i, nF(_be.n_faces()), nV;
+  unsigned int i, nF(_be.n_faces());
   Vec3f  a, b, c, n;
-  std::vector<VertexHandle> vhandles;
-  FaceHandle fh;
+
+  // fetch all data in bulk instead of per-face virtual calls
+  std::vector<Vec3f>         points_buf, normals_buf;
+  std::vector<unsigned int>  indices, offsets;
+  const Vec3f* points  = _be.get_points(points_buf);
+  const Vec3f* normals = (_be.has_face_normals() ?
+                          _be.get_face_normals(normals_buf) : 0);
+  _be.get_face_indices(indices, &offsets);
 
 
   // header
@@ -160,17 +167,12 @@ write_stla(const std::string& _filename, BaseExporter& _be, Options /* _opt */)
   // write face set
   for (i=0; i<nF; ++i)
   {
-    fh = FaceHandle(i);
-    nV = _be.get_vhandles(fh, vhandles);
-
-    if (nV == 3)
+    if (offsets[i+1] - offsets[i] == 3)
     {
-      a = _be.point(vhandles[0]);
-      b = _be.point(vhandles[1]);
-      c = _be.point(vhandles[2]);
-      n = (_be.has_face_normals() ?
-     _be.normal(fh) :
-     ((c-b) % (a-b)).normalize());
+      a = points[indices[offsets[i]  ]];
+      b = points[indices[offsets[i]+1]];
+      c = points[indices[offsets[i]+2]];
+      n = (normals ? normals[i] : ((c-b) % (a-b)).normalize());
 
       fprintf(out, "facet normal %f %f %f\nouter loop\n", n[0], n[1], n[2]);
       fprintf(out, "vertex %.10f %.10f %.10f\n", a[0], a[1], a[2]);
@@ -210,10 +212,16 @@ write_stlb(const std::string& _filename, BaseExporter& _be, Options /* _opt */)
   }
 
 
-  unsigned int i, nF(_be.n_faces()), nV;
+  unsigned int i, nF(_be.n_faces());
   Vec3f  a, b, c, n;
-  std::vector<VertexHandle> vhandles;
-  FaceHandle fh;
+
+  // fetch all data in bulk instead of per-face virtual calls
+  std::vector<Vec3f>         points_buf, normals_buf;
+  std::vector<unsigned int>  indices, offsets;
+  const Vec3f* points  = _be.get_points(points_buf);
+  const Vec3f* normals = (_be.has_face_normals() ?
+                          _be.get_face_normals(normals_buf) : 0);
+  _be.get_face_indices(indices, &offsets);
 
 
    // write header
@@ -227,46 +235,43 @@ write_stlb(const std::string& _filename, BaseExporter& _be, Options /* _opt */)
   write_int(_be.n_faces(), out);
 
 
-  // write face set
+  // write face set in blocks of records:
+  // normal, three vertices (12 floats) and a short space filler
+  const size_t  record_size = 12*sizeof(float) + sizeof(short);
+  const size_t  block_size  = 4096;
+  std::vector<char>  block(block_size * record_size);
+  char*  record = &block[0];
+  const short  filler(0);
+
   for (i=0; i<nF; ++i)
   {
-    fh = FaceHandle(i);
-    nV = _be.get_vhandles(fh, vhandles);
-
-    if (nV == 3)
+    if (offsets[i+1] - offsets[i] == 3)
     {
-      a = _be.point(vhandles[0]);
-      b = _be.point(vhandles[1]);
-      c = _be.point(vhandles[2]);
-      n = (_be.has_face_normals() ?
-     _be.normal(fh) :
-     ((c-b) % (a-b)).normalize());
-
-      // face normal
-      write_float(n[0], out);
-      write_float(n[1], out);
-      write_float(n[2], out);
-
-      // face vertices
-      write_float(a[0], out);
-      write_float(a[1], out);
-      write_float(a[2], out);
-
-      write_float(b[0], out);
-      write_float(b[1], out);
-      write_float(b[2], out);
-
-      write_float(c[0], out);
-      write_float(c[1], out);
-      write_float(c[2], out);
-
-      // space filler
-      write_short(0, out);
+      a = points[indices[offsets[i]  ]];
+      b = points[indices[offsets[i]+1]];
+      c = points[indices[offsets[i]+2]];
+      n = (normals ? normals[i] : ((c-b) % (a-b)).normalize());
+
+      memcpy(record,                   n.data(), 3*sizeof(float));
+      memcpy(record +  3*sizeof(float), a.data(), 3*sizeof(float));
+      memcpy(record +  6*sizeof(float), b.data(), 3*sizeof(float));
+      memcpy(record +  9*sizeof(float), c.data(), 3*sizeof(float));
+      memcpy(record + 12*sizeof(float), &filler,  sizeof(short));
+      record += record_size;
+
+      if (record == &block[0] + block.size())
+      {
+        fwrite(&block[0], 1, block.size(), out);
+        record = &block[0];
+      }
     }
     else
       omerr() << "[STLWriter] : Warning: Skipped non-triangle data!\n";
   }
 
+  if (record != &block[0])
+    fwrite(&block[0], 1, record - &block[0], out);
+
 
   fclose(out);
   return true;
@@ -288,10 +293,11 @@ binary_size(BaseExporter& _be, Options /* _opt */) const
 
 
   unsigned int i, nF(_be.n_faces());
-  std::vector<VertexHandle> vhandles;
+  std::vector<unsigned int> indices, offsets;
+  _be.get_face_indices(indices, &offsets);
 
   for (i=0; i<nF; ++i)
-    if (_be.get_vhandles(FaceHandle(i), vhandles) == 3)
+    if (offsets[i+1] - offsets[i] == 3)
       bytes += _12floats + sizeof(short);
     else
       omerr() << "[STLWriter] : Warning: Skipped non-triangle data!\n";
@@ -46,7 +46,8 @@ namespace OpenMesh
 
 ArrayKernel::ArrayKernel()
 : refcount_vstatus_(0), refcount_hstatus_(0),
-  refcount_estatus_(0), refcount_fstatus_(0)
+  refcount_estatus_(0), refcount_fstatus_(0),
+  dirty_tracking_(false), all_dirty_(false)
 {
   init_bit_masks(); //Status bit masks initialization
 }
@@ -92,6 +93,8 @@ void ArrayKernel::assign_connectivity(const ArrayKernel& _other)
   COPY_STATUS_PROPERTY(face)
   
 #undef COPY_STATUS_PROPERTY
+
+  if (dirty_tracking_) mark_all_dirty();
 }
 
 uint ArrayKernel::delete_isolated_vertices()
@@ -113,6 +116,9 @@ void ArrayKernel::garbage_collection(bool _v, bool _e, bool _f)
 {
   int i, i0, i1, nV(n_vertices()), nE(n_edges()), nH(2*n_edges()), nF(n_faces());
 
+  // all handles may change, single dirty elements make no sense anymore
+  if (dirty_tracking_) mark_all_dirty();
+
   std::vector<VertexHandle>    vh_map;
   std::vector<HalfedgeHandle>  hh_map;
   std::vector<FaceHandle>      fh_map;
@@ -271,6 +277,8 @@ void ArrayKernel::clear()
   faces_.clear();
   FaceContainer().swap( faces_ );
 
+  if (dirty_tracking_) mark_all_dirty();
+
 }
 
 void ArrayKernel::resize( uint _n_vertices, uint _n_edges, uint _n_faces )
@@ -283,6 +291,9 @@ void ArrayKernel::resize( uint _n_vertices, uint _n_edges, uint _n_faces )
   hprops_resize(n_halfedges());
   eprops_resize(n_edges());
   fprops_resize(n_faces());
+
+  // bulk construction (maybe in parallel) follows, don't record elements
+  if (dirty_tracking_) mark_all_dirty();
 }
 
 void ArrayKernel::reserve(uint _n_vertices, uint _n_edges, uint _n_faces )
@@ -297,6 +308,66 @@ void ArrayKernel::reserve(uint _n_vertices, uint _n_edges, uint _n_faces )
   fprops_reserve(_n_faces);
 }
 
+// Dirty tracking API
+void ArrayKernel::mark_dirty(VertexHandle _vh)
+{
+  if (all_dirty_ || !_vh.is_valid())
+    return;
+
+#ifdef USE_OPENMP
+#pragma omp critical (OpenMesh_ArrayKernel_dirty)
+#endif
+  {
+    const size_t idx = _vh.idx();
+    if (idx >= dirty_vertex_flags_.size())
+      dirty_vertex_flags_.resize(std::max(idx+1, size_t(n_vertices())), 0);
+    if (!dirty_vertex_flags_[idx])
+    {
+      dirty_vertex_flags_[idx] = 1;
+      dirty_vertices_.push_back(_vh);
+    }
+  }
+}
+
+void ArrayKernel::mark_dirty(FaceHandle _fh)
+{
+  if (all_dirty_ || !_fh.is_valid())
+    return;
+
+#ifdef USE_OPENMP
+#pragma omp critical (OpenMesh_ArrayKernel_dirty)
+#endif
+  {
+    const size_t idx = _fh.idx();
+    if (idx >= dirty_face_flags_.size())
+      dirty_face_flags_.resize(std::max(idx+1, size_t(n_faces())), 0);
+    if (!dirty_face_flags_[idx])
+    {
+      dirty_face_flags_[idx] = 1;
+      dirty_faces_.push_back(_fh);
+    }
+  }
+}
+
+void ArrayKernel::mark_all_dirty()
+{
+  clear_dirty();
+  all_dirty_ = true;
+}
+
+void ArrayKernel::clear_dirty()
+{
+  // reset the flags of the listed elements only, O(#dirty)
+  for (size_t i = 0; i < dirty_vertices_.size(); ++i)
+    dirty_vertex_flags_[dirty_vertices_[i].idx()] = 0;
+  for (size_t i = 0; i < dirty_faces_.size(); ++i)
+    dirty_face_flags_[dirty_faces_[i].idx()] = 0;
+
+  dirty_vertices_.clear();
+  dirty_faces_.clear();
+  all_dirty_ = false;
+}
+
 // Status Sets API
 void ArrayKernel::init_bit_masks(BitMaskContainer& _bmc)
 {
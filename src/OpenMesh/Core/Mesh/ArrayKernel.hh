@@ -53,6 +53,7 @@
 
 //== INCLUDES =================================================================
 #include <vector>
+#include <algorithm>
 
 #include <OpenMesh/Core/System/config.h>
 #include <OpenMesh/Core/Utils/GenProg.hh>
@@ -223,6 +224,7 @@ public:
     vertices_.push_back(Vertex());
     vprops_resize(n_vertices());//TODO:should it be push_back()?
 
+    if (dirty_tracking_) mark_dirty(handle(vertices_.back()));
     return handle(vertices_.back());
   }
 
@@ -245,6 +247,7 @@ public:
   {
     faces_.push_back(Face());
     fprops_resize(n_faces());
+    if (dirty_tracking_) mark_dirty(handle(faces_.back()));
     return handle(faces_.back());
   }
 
@@ -252,6 +255,7 @@ public:
   {
     faces_.push_back(_f);
     fprops_resize(n_faces());
+    if (dirty_tracking_) mark_dirty(handle(faces_.back()));
     return handle(faces_.back());
   }
 
@@ -284,13 +288,17 @@ public:
   {
 //     assert(is_valid_handle(_heh));
     vertex(_vh).halfedge_handle_ = _heh;
+    if (dirty_tracking_) mark_dirty(_vh);
   }
 
   bool is_isolated(VertexHandle _vh) const
   { return !halfedge_handle(_vh).is_valid(); }
 
   void set_isolated(VertexHandle _vh)
-  { vertex(_vh).halfedge_handle_.invalidate(); }
+  {
+    vertex(_vh).halfedge_handle_.invalidate();
+    if (dirty_tracking_) mark_dirty(_vh);
+  }
 
   uint delete_isolated_vertices();
 
@@ -305,6 +313,7 @@ public:
   {
 //     assert(is_valid_handle(_vh));
     halfedge(_heh).vertex_handle_ = _vh;
+    if (dirty_tracking_) { mark_dirty(_vh); mark_dirty(face_handle(_heh)); }
   }
 
   FaceHandle face_handle(HalfedgeHandle _heh) const
@@ -314,10 +323,14 @@ public:
   {
 //     assert(is_valid_handle(_fh));
     halfedge(_heh).face_handle_ = _fh;
+    if (dirty_tracking_) { mark_dirty(_fh); mark_dirty(to_vertex_handle(_heh)); }
   }
 
   void set_boundary(HalfedgeHandle _heh)
-  { halfedge(_heh).face_handle_.invalidate(); }
+  {
+    halfedge(_heh).face_handle_.invalidate();
+    if (dirty_tracking_) mark_dirty(to_vertex_handle(_heh));
+  }
 
   /// Is halfedge _heh a boundary halfedge (is its face handle invalid) ?
   bool is_boundary(HalfedgeHandle _heh) const
@@ -332,6 +345,8 @@ public:
 //     assert(to_vertex_handle(_heh) == from_vertex_handle(_nheh));
     halfedge(_heh).next_halfedge_handle_ = _nheh;
     set_prev_halfedge_handle(_nheh, _heh);
+    if (dirty_tracking_)
+    { mark_dirty(face_handle(_heh)); mark_dirty(to_vertex_handle(_heh)); }
   }
 
 
@@ -411,6 +426,7 @@ public:
   {
 //     assert(is_valid_handle(_heh));
     face(_fh).halfedge_handle_ = _heh;
+    if (dirty_tracking_) mark_dirty(_fh);
   }
 
   /// Status Query API
@@ -713,7 +729,130 @@ public:
   typedef ExtStatusSetT<VertexHandle>       ExtVertexStatusSet;
   typedef ExtStatusSetT<EdgeHandle>         ExtEdgeStatusSet;
   typedef ExtStatusSetT<HalfedgeHandle>     ExtHalfedgeStatusSet;
-  
+
+  /// --- MarkSet API --- (private marks, e.g. per thread)
+
+  /** A set of handles with the same is_in()/insert()/erase() interface as
+      the status sets. The marks are not stored in the status bits of the
+      mesh but in an array of the set itself, stamped with the current
+      epoch. Hence the mesh is only read and any number of threads can
+      use their own mark sets on the same mesh concurrently.
+
+      clear() just starts a new epoch and has O(1) complexity. The array
+      grows on demand, i.e. elements added to the mesh later on can be
+      inserted as well.
+   */
+  template <class Handle>
+  class MarkSetT
+  {
+  public:
+    MarkSetT(const ArrayKernel& _kernel)
+    : kernel_(_kernel), epoch_(1)
+    {}
+
+    /// Complexity: O(1)
+    inline bool                             is_in(Handle _hnd) const
+    {
+      const size_t idx = _hnd.idx();
+      return idx < stamps_.size() && stamps_[idx] == epoch_;
+    }
+
+    /// Complexity: O(1), amortized if the array has to grow
+    inline void                             insert(Handle _hnd)
+    {
+      assert(_hnd.is_valid());
+      const size_t idx = _hnd.idx();
+      if (idx >= stamps_.size())
+        stamps_.resize(std::max(idx+1, size_t(n_elements(_hnd))), 0);
+      stamps_[idx] = epoch_;
+    }
+
+    /// Complexity: O(1)
+    inline void                             erase(Handle _hnd)
+    {
+      if (is_in(_hnd))
+        stamps_[_hnd.idx()] = 0;
+    }
+
+    /// Complexity: O(1), O(n) once every 2^32 calls
+    void                                    clear()
+    {
+      if (++epoch_ == 0)
+      {
+        std::fill(stamps_.begin(), stamps_.end(), 0);
+        epoch_ = 1;
+      }
+    }
+
+    /// Note: O(n) complexity
+    uint                                    size() const
+    { return (uint)std::count(stamps_.begin(), stamps_.end(), epoch_); }
+
+  private:
+    uint n_elements(VertexHandle) const   { return kernel_.n_vertices(); }
+    uint n_elements(HalfedgeHandle) const { return kernel_.n_halfedges(); }
+    uint n_elements(EdgeHandle) const     { return kernel_.n_edges(); }
+    uint n_elements(FaceHandle) const     { return kernel_.n_faces(); }
+
+  private:
+    const ArrayKernel&                      kernel_;
+    std::vector<uint>                       stamps_;
+    uint                                    epoch_;
+  };
+
+  typedef MarkSetT<VertexHandle>            VertexMarkSet;
+  typedef MarkSetT<EdgeHandle>              EdgeMarkSet;
+  typedef MarkSetT<FaceHandle>              FaceMarkSet;
+  typedef MarkSetT<HalfedgeHandle>          HalfedgeMarkSet;
+
+  /// --- Dirty tracking API --- (see PolyMeshT::update_dirty_normals())
+
+  /** While enabled, the kernel records every vertex and face whose
+      connectivity is changed by one of the set_*() functions above, as
+      well as new vertices and faces. The mesh kernels on top add the
+      vertices passed to set_point(). Writes through the non-const
+      point() reference or to custom properties are not seen, call
+      mark_dirty() for those.
+
+      Operations that touch the whole mesh (resize(), garbage_collection(),
+      clear()) do not record single elements but set all_dirty().
+      Recording is serialized, but it is cheaper to leave tracking off
+      while a mesh is built in parallel.
+   */
+  void request_dirty_tracking()
+  {
+    if (!dirty_tracking_) clear_dirty();
+    dirty_tracking_ = true;
+  }
+
+  void release_dirty_tracking()
+  {
+    dirty_tracking_ = false;
+    clear_dirty();
+  }
+
+  bool has_dirty_tracking() const { return dirty_tracking_; }
+
+  /// Record _vh resp. _fh as modified. Invalid handles are ignored.
+  void mark_dirty(VertexHandle _vh);
+  void mark_dirty(FaceHandle _fh);
+
+  /// Everything is modified, the lists below are cleared
+  void mark_all_dirty();
+
+  /// Forget all recorded elements, e.g. after the normals were updated
+  void clear_dirty();
+
+  bool all_dirty() const { return all_dirty_; }
+
+  /// Recorded vertices, each listed once. May contain deleted vertices.
+  const std::vector<VertexHandle>& dirty_vertices() const
+  { return dirty_vertices_; }
+
+  /// Recorded faces, each listed once. May contain deleted faces.
+  const std::vector<FaceHandle>& dirty_faces() const
+  { return dirty_faces_; }
+
 private:
   // iterators
   typedef std::vector<Vertex>                VertexContainer;
@@ -792,6 +931,13 @@ private:
   BitMaskContainer                          edge_bit_masks_;
   BitMaskContainer                          vertex_bit_masks_;
   BitMaskContainer                          face_bit_masks_;
+
+  bool                                      dirty_tracking_;
+  bool                                      all_dirty_;
+  std::vector<VertexHandle>                 dirty_vertices_;
+  std::vector<FaceHandle>                   dirty_faces_;
+  std::vector<unsigned char>                dirty_vertex_flags_;
+  std::vector<unsigned char>                dirty_face_flags_;
 };
 
 //=============================================================================
@@ -227,7 +227,10 @@ public:
   { return this->property(points_, _vh); }
 
   void set_point(VertexHandle _vh, const Point& _p)
-  { this->property(points_, _vh) = _p; }
+  {
+    this->property(points_, _vh) = _p;
+    if (this->has_dirty_tracking()) this->mark_dirty(_vh);
+  }
 
 
   //------------------------------------------------------------ vertex normals
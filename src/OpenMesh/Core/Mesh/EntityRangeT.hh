@@ -0,0 +1,200 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+#ifndef OPENMESH_ENTITYRANGE_HH
+#define OPENMESH_ENTITYRANGE_HH
+
+//=============================================================================
+//
+//  Splittable index ranges of mesh entities (vertices, halfedges, edges,
+//  faces) for parallel processing, see OpenMesh/Core/Utils/ParallelT.hh
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Mesh/ArrayKernel.hh>
+#include <algorithm>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \brief Random access, splittable range of mesh entities.
+
+    The range covers the handles with indices [begin(), end()) of one entity
+    type (\c Handle is VertexHandle, HalfedgeHandle, EdgeHandle or
+    FaceHandle) of a mesh. It is split into halves by split() as long as it
+    is_divisible(), i.e. larger than the grain size, which is how
+    parallel_for() and parallel_reduce() distribute the work.
+
+    Unlike the mesh iterators the range contains deleted elements.
+    for_each() skips them: it looks up the status array of the mesh once per
+    range and tests the deleted bit by index, instead of checking the status
+    for every increment.
+
+    Ranges of a mesh are obtained from PolyConnectivity::vertex_range(),
+    halfedge_range(), edge_range() and face_range().
+*/
+template <class Handle>
+class EntityRangeT
+{
+public:
+
+  typedef Handle value_type;
+
+  /// default number of elements below which a range is not split
+  enum { DefaultGrainSize = 1024 };
+
+  /// all entities of _kernel
+  explicit EntityRangeT(const ArrayKernel& _kernel,
+                        int _grainsize = DefaultGrainSize)
+    : kernel_(&_kernel), begin_(0), end_(n_elements(_kernel)),
+      grainsize_(std::max(1, _grainsize))
+  {}
+
+  /// entities with indices in [_begin, _end) of _kernel
+  EntityRangeT(const ArrayKernel& _kernel, int _begin, int _end,
+               int _grainsize = DefaultGrainSize)
+    : kernel_(&_kernel), begin_(_begin), end_(_end),
+      grainsize_(std::max(1, _grainsize))
+  {}
+
+
+  /// index of the first entity
+  int begin() const { return begin_; }
+
+  /// index one past the last entity
+  int end() const { return end_; }
+
+  /// number of entities
+  int size() const { return end_ - begin_; }
+
+  bool empty() const { return end_ <= begin_; }
+
+  /// handle of the _i'th entity of the range
+  Handle operator[](int _i) const { return Handle(begin_ + _i); }
+
+  int grainsize() const { return grainsize_; }
+
+
+  /// Can the range be split?
+  bool is_divisible() const { return size() > grainsize_; }
+
+  /// Keep the lower half of the range and return the upper half.
+  EntityRangeT split()
+  {
+    const int mid = begin_ + size()/2;
+    EntityRangeT upper(*kernel_, mid, end_, grainsize_);
+    end_ = mid;
+    return upper;
+  }
+
+
+  /// Is the _i'th entity of the range deleted?
+  bool is_deleted(int _i) const
+  {
+    const Attributes::StatusInfo* status = status_array();
+    return status && status[begin_ + _i].deleted();
+  }
+
+  /// Call _func(handle) for all entities of the range that are not deleted.
+  template <class Func>
+  Func for_each(Func _func) const
+  {
+    const Attributes::StatusInfo* status = status_array();
+
+    if (status)
+    {
+      for (int i=begin_; i<end_; ++i)
+        if (!status[i].deleted())
+          _func(Handle(i));
+    }
+    else
+    {
+      for (int i=begin_; i<end_; ++i)
+        _func(Handle(i));
+    }
+
+    return _func;
+  }
+
+
+private:
+
+  static int n_elements(const ArrayKernel& _kernel)
+  { return n_elements(_kernel, Handle()); }
+
+  static int n_elements(const ArrayKernel& _k, VertexHandle)
+  { return int(_k.n_vertices()); }
+  static int n_elements(const ArrayKernel& _k, HalfedgeHandle)
+  { return int(_k.n_halfedges()); }
+  static int n_elements(const ArrayKernel& _k, EdgeHandle)
+  { return int(_k.n_edges()); }
+  static int n_elements(const ArrayKernel& _k, FaceHandle)
+  { return int(_k.n_faces()); }
+
+  // status array of the entity type, 0 if there is none
+  const Attributes::StatusInfo* status_array() const
+  {
+    return kernel_->status_pph(Handle()).is_valid() ?
+           kernel_->property(kernel_->status_pph(Handle())).data() : 0;
+  }
+
+
+  const ArrayKernel*  kernel_;
+  int                 begin_, end_;
+  int                 grainsize_;
+};
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_ENTITYRANGE_HH defined
+//=============================================================================
@@ -45,6 +45,7 @@
 #include <OpenMesh/Core/Mesh/ArrayKernel.hh>
 #include <OpenMesh/Core/Mesh/IteratorsT.hh>
 #include <OpenMesh/Core/Mesh/CirculatorsT.hh>
+#include <OpenMesh/Core/Mesh/EntityRangeT.hh>
 
 namespace OpenMesh
 {
@@ -87,6 +88,17 @@ public:
   typedef FaceIter ConstFaceIter;
   //@}
 
+  /** \name Mesh Ranges
+      Splittable ranges for parallel_for() and parallel_reduce(), see
+      EntityRangeT.
+  */
+  //@{
+  typedef EntityRangeT<VertexHandle>   VertexRange;
+  typedef EntityRangeT<HalfedgeHandle> HalfedgeRange;
+  typedef EntityRangeT<EdgeHandle>     EdgeRange;
+  typedef EntityRangeT<FaceHandle>     FaceRange;
+  //@}
+
   //--- circulators ---
 
   /** \name Mesh Circulators
@@ -368,6 +380,30 @@ public:
 
   //@}
 
+
+  /** \name Splittable ranges of all mesh items
+      The ranges contain deleted items, see EntityRangeT::for_each().
+  */
+  //@{
+
+  /// Range of all vertices
+  VertexRange vertex_range(int _grainsize = VertexRange::DefaultGrainSize) const
+  { return VertexRange(*this, _grainsize); }
+
+  /// Range of all halfedges
+  HalfedgeRange halfedge_range(int _grainsize = HalfedgeRange::DefaultGrainSize) const
+  { return HalfedgeRange(*this, _grainsize); }
+
+  /// Range of all edges
+  EdgeRange edge_range(int _grainsize = EdgeRange::DefaultGrainSize) const
+  { return EdgeRange(*this, _grainsize); }
+
+  /// Range of all faces
+  FaceRange face_range(int _grainsize = FaceRange::DefaultGrainSize) const
+  { return FaceRange(*this, _grainsize); }
+
+  //@}
+
   //--- circulators ---
 
   /** \name Vertex and Face circulators
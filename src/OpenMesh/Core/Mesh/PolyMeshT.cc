@@ -56,7 +56,9 @@
 #include <OpenMesh/Core/Geometry/LoopSchemeMaskT.hh>
 #include <OpenMesh/Core/Utils/vector_cast.hh>
 #include <OpenMesh/Core/System/omstream.hh>
+#include <OpenMesh/Core/Utils/ParallelT.hh>
 #include <vector>
+#include <algorithm>
 
 
 //== NAMESPACES ===============================================================
@@ -191,6 +193,86 @@ update_normals()
     if (Kernel::has_vertex_normals() ) update_vertex_normals();
     if (Kernel::has_halfedge_normals()) update_halfedge_normals();
   }
+
+  if (Kernel::has_dirty_tracking())
+    Kernel::clear_dirty();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Kernel>
+void
+PolyMeshT<Kernel>::
+update_dirty_normals(const double _feature_angle)
+{
+  if (!Kernel::has_dirty_tracking() || Kernel::all_dirty())
+  {
+    update_normals();
+    return;
+  }
+
+  if (!Kernel::has_face_normals())
+  {
+    Kernel::clear_dirty();
+    return;
+  }
+
+  const std::vector<VertexHandle>& dirty_vertices = Kernel::dirty_vertices();
+  const std::vector<FaceHandle>&   dirty_faces    = Kernel::dirty_faces();
+
+  // duplicates are removed by sorting, a mark set would cost O(V+F) per call
+  std::vector<VertexHandle> vertices;
+  std::vector<FaceHandle>   faces;
+  size_t                    i;
+
+  // faces: the recorded ones and those around recorded vertices
+  for (i=0; i<dirty_faces.size(); ++i)
+  {
+    FaceHandle fh = dirty_faces[i];
+    if (Kernel::has_face_status() && Kernel::status(fh).deleted())
+      continue;
+    faces.push_back(fh);
+  }
+
+  for (i=0; i<dirty_vertices.size(); ++i)
+  {
+    VertexHandle vh = dirty_vertices[i];
+    if (Kernel::has_vertex_status() && Kernel::status(vh).deleted())
+      continue;
+    vertices.push_back(vh);
+
+    for (ConstVertexFaceIter vf_it(*this, vh); vf_it; ++vf_it)
+      faces.push_back(vf_it.handle());
+  }
+
+  std::sort(faces.begin(), faces.end());
+  faces.erase(std::unique(faces.begin(), faces.end()), faces.end());
+
+  for (i=0; i<faces.size(); ++i)
+    this->set_normal(faces[i], calc_face_normal(faces[i]));
+
+  // vertices: the recorded ones and the corners of the faces above
+  for (i=0; i<faces.size(); ++i)
+    for (ConstFaceVertexIter fv_it(*this, faces[i]); fv_it; ++fv_it)
+      vertices.push_back(fv_it.handle());
+
+  std::sort(vertices.begin(), vertices.end());
+  vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+
+  if (Kernel::has_vertex_normals())
+    for (i=0; i<vertices.size(); ++i)
+      this->set_normal(vertices[i], calc_vertex_normal(vertices[i]));
+
+  // a halfedge normal depends on the faces around its to-vertex
+  if (Kernel::has_halfedge_normals())
+    for (i=0; i<vertices.size(); ++i)
+      for (ConstVertexIHalfedgeIter vih_it(*this, vertices[i]); vih_it; ++vih_it)
+        this->set_normal(vih_it.handle(),
+                         calc_halfedge_normal(vih_it.handle(), _feature_angle));
+
+  Kernel::clear_dirty();
 }
 
 
@@ -202,10 +284,20 @@ void
 PolyMeshT<Kernel>::
 update_face_normals()
 {
-  FaceIter f_it(Kernel::faces_begin()), f_end(Kernel::faces_end());
+  parallel_for(Kernel::face_range(), FaceNormalBody(*this));
+}
+
 
-  for (; f_it != f_end; ++f_it)
-    this->set_normal(f_it.handle(), calc_face_normal(f_it.handle()));
+//-----------------------------------------------------------------------------
+
+
+template <class Kernel>
+void
+PolyMeshT<Kernel>::FaceNormalBody::
+operator()(const typename Kernel::FaceRange& _r) const
+{
+  for (int i=_r.begin(); i<_r.end(); ++i)
+    mesh_->set_normal(FaceHandle(i), mesh_->calc_face_normal(FaceHandle(i)));
 }
 
 
@@ -217,10 +309,22 @@ void
 PolyMeshT<Kernel>::
 update_halfedge_normals(const double _feature_angle)
 {
-  HalfedgeIter h_it(Kernel::halfedges_begin()), h_end(Kernel::halfedges_end());
+  parallel_for(Kernel::halfedge_range(),
+               HalfedgeNormalBody(*this, _feature_angle));
+}
 
-  for (; h_it != h_end; ++h_it)
-    this->set_normal(h_it.handle(), calc_halfedge_normal(h_it.handle(), _feature_angle));
+
+//-----------------------------------------------------------------------------
+
+
+template <class Kernel>
+void
+PolyMeshT<Kernel>::HalfedgeNormalBody::
+operator()(const typename Kernel::HalfedgeRange& _r) const
+{
+  for (int i=_r.begin(); i<_r.end(); ++i)
+    mesh_->set_normal(HalfedgeHandle(i),
+                      mesh_->calc_halfedge_normal(HalfedgeHandle(i), feature_angle_));
 }
 
 
@@ -388,10 +492,20 @@ void
 PolyMeshT<Kernel>::
 update_vertex_normals()
 {
-  VertexIter  v_it(Kernel::vertices_begin()), v_end(Kernel::vertices_end());
+  parallel_for(Kernel::vertex_range(), VertexNormalBody(*this));
+}
 
-  for (; v_it!=v_end; ++v_it)
-    this->set_normal(v_it.handle(), calc_vertex_normal(v_it.handle()));
+
+//-----------------------------------------------------------------------------
+
+
+template <class Kernel>
+void
+PolyMeshT<Kernel>::VertexNormalBody::
+operator()(const typename Kernel::VertexRange& _r) const
+{
+  for (int i=_r.begin(); i<_r.end(); ++i)
+    mesh_->set_normal(VertexHandle(i), mesh_->calc_vertex_normal(VertexHandle(i)));
 }
 
 //=============================================================================
@@ -214,11 +214,29 @@ public:
    */
   void update_normals();
 
+  /** \brief Compute normals for the modified part of the mesh only
+   *
+   * Recomputes the face normals of the faces recorded by the dirty
+   * tracking of the kernel (see ArrayKernel::request_dirty_tracking())
+   * and of the faces around recorded vertices. Afterwards the vertex and
+   * halfedge normals (if the properties exist) around these faces are
+   * updated. The cost is proportional to the size of the change, not of
+   * the mesh. The recorded elements are cleared.
+   *
+   * Falls back to update_normals() if tracking is disabled or the whole
+   * mesh is dirty, e.g. after garbage_collection().
+   *
+   * \note Normals are assumed to be valid when tracking is requested.
+   */
+  void update_dirty_normals(const double _feature_angle = 0.8);
+
   /// Update normal for face _fh
   void update_normal(FaceHandle _fh)
   { this->set_normal(_fh, calc_face_normal(_fh)); }
 
   /** \brief Update normal vectors for all faces.
+   *
+   * The faces are processed in parallel, see parallel_for().
    *
    * \attention Needs the Attributes::Normal attribute for faces.
    *            Call request_face_normals() before using it!
@@ -240,7 +258,8 @@ public:
 
   /** \brief Update normal vectors for all halfedges.
    *
-   * Uses the existing face normals to compute halfedge normals
+   * Uses the existing face normals to compute halfedge normals.
+   * The halfedges are processed in parallel, see parallel_for().
    *
    * \note Face normals have to be computed first!
    *
@@ -275,6 +294,7 @@ public:
   /** \brief Update normal vectors for all vertices.
    *
    * Uses existing face normals to calculate new vertex normals.
+   * The vertices are processed in parallel, see parallel_for().
    *
    * \note Face normals have to be computed first!
    *
@@ -491,7 +511,34 @@ public:
 
   inline void split(EdgeHandle _eh, VertexHandle _vh)
   { Kernel::split_edge(_eh, _vh); }
-  
+
+
+private:
+
+  // bodies of the parallel normal updates (see parallel_for())
+
+  struct FaceNormalBody
+  {
+    FaceNormalBody(PolyMeshT& _mesh) : mesh_(&_mesh) {}
+    void operator()(const typename Kernel::FaceRange& _r) const;
+    PolyMeshT* mesh_;
+  };
+
+  struct HalfedgeNormalBody
+  {
+    HalfedgeNormalBody(PolyMeshT& _mesh, double _feature_angle)
+      : mesh_(&_mesh), feature_angle_(_feature_angle) {}
+    void operator()(const typename Kernel::HalfedgeRange& _r) const;
+    PolyMeshT* mesh_;
+    double     feature_angle_;
+  };
+
+  struct VertexNormalBody
+  {
+    VertexNormalBody(PolyMeshT& _mesh) : mesh_(&_mesh) {}
+    void operator()(const typename Kernel::VertexRange& _r) const;
+    PolyMeshT* mesh_;
+  };
 };
 
 
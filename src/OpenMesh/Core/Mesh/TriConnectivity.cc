@@ -462,4 +462,76 @@ void TriConnectivity::split(EdgeHandle _eh, VertexHandle _vh)
     set_halfedge_handle(v2, t1);
 }
 
+
+//-----------------------------------------------------------------------------
+void TriConnectivity::split_preallocated(EdgeHandle _eh, VertexHandle _vh,
+                                         HalfedgeHandle _e0, HalfedgeHandle _e1,
+                                         HalfedgeHandle _e2,
+                                         FaceHandle _f1, FaceHandle _f2)
+{
+  HalfedgeHandle h0 = halfedge_handle(_eh, 0);
+  HalfedgeHandle o0 = halfedge_handle(_eh, 1);
+
+  assert(!is_boundary(h0) && !is_boundary(o0));
+
+  HalfedgeHandle h1 = next_halfedge_handle(h0);
+  HalfedgeHandle h2 = next_halfedge_handle(h1);
+  HalfedgeHandle o1 = next_halfedge_handle(o0);
+  HalfedgeHandle o2 = next_halfedge_handle(o1);
+
+  HalfedgeHandle t0 = opposite_halfedge_handle(_e0);
+  HalfedgeHandle t1 = opposite_halfedge_handle(_e1);
+  HalfedgeHandle t2 = opposite_halfedge_handle(_e2);
+
+  VertexHandle   v2 = to_vertex_handle(o0);
+
+  FaceHandle     f0 = face_handle(h0);
+  FaceHandle     f3 = face_handle(o0);
+
+  set_halfedge_handle(_vh, h0);
+  set_vertex_handle(o0, _vh);
+
+  // same connectivity as split(EdgeHandle, VertexHandle)
+  set_halfedge_handle(f0, h0);
+  set_halfedge_handle(_f1, h2);
+
+  set_face_handle(h1, f0);
+  set_face_handle(t0, f0);
+  set_face_handle(h0, f0);
+
+  set_face_handle(h2, _f1);
+  set_face_handle(t1, _f1);
+  set_face_handle(_e0, _f1);
+
+  set_next_halfedge_handle(h0, h1);
+  set_next_halfedge_handle(h1, t0);
+  set_next_halfedge_handle(t0, h0);
+
+  set_next_halfedge_handle(_e0, h2);
+  set_next_halfedge_handle(h2, t1);
+  set_next_halfedge_handle(t1, _e0);
+
+  set_halfedge_handle(_f2, o1);
+  set_halfedge_handle(f3, o0);
+
+  set_face_handle(o1, _f2);
+  set_face_handle(t2, _f2);
+  set_face_handle(_e1, _f2);
+
+  set_face_handle(o2, f3);
+  set_face_handle(o0, f3);
+  set_face_handle(_e2, f3);
+
+  set_next_halfedge_handle(_e1, o1);
+  set_next_halfedge_handle(o1, t2);
+  set_next_halfedge_handle(t2, _e1);
+
+  set_next_halfedge_handle(o0, _e2);
+  set_next_halfedge_handle(_e2, o2);
+  set_next_halfedge_handle(o2, o0);
+
+  if (halfedge_handle(v2) == h0)
+    set_halfedge_handle(v2, t1);
+}
+
 }// namespace OpenMesh
@@ -129,6 +129,18 @@ public:
   /// Edge split (= 2-to-4 split)
   void split(EdgeHandle _eh, VertexHandle _vh);
 
+  /** Edge split (= 2-to-4 split) of an interior edge into elements
+      created beforehand: \c _e0, \c _e1 and \c _e2 are the halfedges
+      returned by new_edge(_vh, v) for the vertex opposite to halfedge 0
+      of \c _eh, the to-vertex of halfedge 1 and the vertex opposite to
+      halfedge 1, \c _f1 and \c _f2 are returned by new_face().
+      Since nothing is allocated, edges whose incident faces share no
+      vertex can be split concurrently. */
+  void split_preallocated(EdgeHandle _eh, VertexHandle _vh,
+                          HalfedgeHandle _e0, HalfedgeHandle _e1,
+                          HalfedgeHandle _e2,
+                          FaceHandle _f1, FaceHandle _f2);
+
   /// Face split (= 1-to-3 split, calls corresponding PolyMeshT function).
   inline void split(FaceHandle _fh, VertexHandle _vh)
   { PolyConnectivity::split(_fh, _vh); }
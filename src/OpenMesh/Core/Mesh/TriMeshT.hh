@@ -198,6 +198,11 @@ public:
   /** Calculate normal vector for face _fh (specialized for TriMesh). */
   Normal calc_face_normal(FaceHandle _fh) const;
 
+  /** Calculate normal vector for the triangle (_p0, _p1, _p2). */
+  Normal calc_face_normal(const Point& _p0, const Point& _p1,
+                          const Point& _p2) const
+  { return PolyMesh::calc_face_normal(_p0, _p1, _p2); }
+
   //@}
 };
 
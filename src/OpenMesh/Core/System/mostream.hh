@@ -52,6 +52,7 @@
 //== INCLUDES =================================================================
 
 #include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/System/mutex.hh>
 #include <iostream>
 #if defined( OM_CC_GCC ) && OM_CC_VERSION < 30000
 #  include <streambuf.h>
@@ -177,27 +178,23 @@ protected:
   // output what's in buffer_
   virtual int sync() 
   {
-    if (!buffer_.empty())
     {
-      if (enabled_) multiplex();
-#if defined( OM_CC_GCC ) && OM_CC_VERSION < 30000
-      buffer_ = ""; // member clear() not available!
-#else
-      buffer_.clear();
-#endif
+      MutexLocker lock(mutex_);
+      flush_buffer();
     }
     return base_type::sync();
   }
 
 
   // take on char and add it to buffer_
-  // if '\n' is encountered, trigger a sync()
+  // if '\n' is encountered, output the buffer
   virtual 
   int_type overflow(int_type _c = multiplex_streambuf::traits_type::eof())
   {
+    MutexLocker lock(mutex_);
     char c = traits_type::to_char_type(_c);
     buffer_.push_back(c);
-    if (c == '\n') sync();
+    if (c == '\n') flush_buffer();
     return 0;
   }
 
@@ -221,6 +218,21 @@ private:
   }
 
 
+  // output and clear buffer_, mutex_ has to be locked
+  void flush_buffer()
+  {
+    if (!buffer_.empty())
+    {
+      if (enabled_) multiplex();
+#if defined( OM_CC_GCC ) && OM_CC_VERSION < 30000
+      buffer_ = ""; // member clear() not available!
+#else
+      buffer_.clear();
+#endif
+    }
+  }
+
+
   // multiplex output of buffer_ to all targets
   void multiplex()
   {
@@ -236,6 +248,10 @@ private:
   target_map   target_map_;
   std::string  buffer_;
   bool         enabled_;
+
+  // serializes output of concurrent writers, e.g. readers running in
+  // different threads
+  Mutex        mutex_;
 };
 
 #undef STREAMBUF
@@ -0,0 +1,126 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+//=============================================================================
+//
+//  Mutex - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/mutex.hh>
+
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <pthread.h>
+#endif
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+
+
+//== IMPLEMENTATION ========================================================== 
+
+
+#if defined(_WIN32)
+
+Mutex::Mutex()
+{
+  CRITICAL_SECTION* cs = new CRITICAL_SECTION;
+  InitializeCriticalSection(cs);
+  handle_ = cs;
+}
+
+Mutex::~Mutex()
+{
+  CRITICAL_SECTION* cs = static_cast<CRITICAL_SECTION*>(handle_);
+  DeleteCriticalSection(cs);
+  delete cs;
+}
+
+void Mutex::lock()
+{
+  EnterCriticalSection(static_cast<CRITICAL_SECTION*>(handle_));
+}
+
+void Mutex::unlock()
+{
+  LeaveCriticalSection(static_cast<CRITICAL_SECTION*>(handle_));
+}
+
+#else
+
+Mutex::Mutex()
+{
+  pthread_mutex_t* m = new pthread_mutex_t;
+  pthread_mutex_init(m, 0);
+  handle_ = m;
+}
+
+Mutex::~Mutex()
+{
+  pthread_mutex_t* m = static_cast<pthread_mutex_t*>(handle_);
+  pthread_mutex_destroy(m);
+  delete m;
+}
+
+void Mutex::lock()
+{
+  pthread_mutex_lock(static_cast<pthread_mutex_t*>(handle_));
+}
+
+void Mutex::unlock()
+{
+  pthread_mutex_unlock(static_cast<pthread_mutex_t*>(handle_));
+}
+
+#endif
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
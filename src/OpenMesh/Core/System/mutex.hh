@@ -0,0 +1,117 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+//=============================================================================
+//
+//  Mutex and scoped lock
+//
+//=============================================================================
+
+#ifndef OPENMESH_MUTEX_HH
+#define OPENMESH_MUTEX_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.h>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \class Mutex mutex.hh <OpenMesh/Core/System/mutex.hh>
+
+    Minimal platform independent (non-recursive) mutex, implemented by
+    pthreads resp. Windows critical sections. The platform headers are
+    kept out of this header on purpose.
+
+    \see MutexLocker
+*/
+class Mutex
+{
+public:
+
+  Mutex();
+  ~Mutex();
+
+  void lock();
+  void unlock();
+
+private:
+
+  Mutex(const Mutex&);
+  Mutex& operator=(const Mutex&);
+
+  void* handle_;
+};
+
+
+/** \class MutexLocker mutex.hh <OpenMesh/Core/System/mutex.hh>
+
+    Locks the given mutex for the lifetime of the object.
+*/
+class MutexLocker
+{
+public:
+
+  explicit MutexLocker(Mutex& _mutex) : mutex_(_mutex) { mutex_.lock(); }
+  ~MutexLocker() { mutex_.unlock(); }
+
+private:
+
+  MutexLocker(const MutexLocker&);
+  MutexLocker& operator=(const MutexLocker&);
+
+  Mutex& mutex_;
+};
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_MUTEX_HH defined
+//=============================================================================
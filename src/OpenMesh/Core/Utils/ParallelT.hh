@@ -0,0 +1,199 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+#ifndef OPENMESH_PARALLEL_HH
+#define OPENMESH_PARALLEL_HH
+
+//=============================================================================
+//
+//  parallel_for / parallel_reduce over splittable ranges
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.h>
+#include <vector>
+#ifdef USE_OPENMP
+#  include <omp.h>
+#endif
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+
+
+//== FUNCTION DEFINITIONS =====================================================
+
+/** \name Parallel algorithms
+
+    The algorithms work on splittable ranges, i.e. classes with
+    is_divisible() and split() like EntityRangeT. The range is split
+    recursively into blocks that are no longer divisible. The blocks are
+    handed out to the threads dynamically, so threads that finish early
+    take over the remaining blocks. Without OpenMP the blocks are processed
+    sequentially in order.
+
+    \code
+    struct FaceArea
+    {
+      FaceArea(const MyMesh& _mesh) : mesh_(&_mesh), area_(0) {}
+      void operator()(const MyMesh::FaceRange& _r) { ... area_ += ... }
+      void join(const FaceArea& _other) { area_ += _other.area_; }
+      const MyMesh* mesh_;
+      double        area_;
+    };
+
+    FaceArea area(mesh);
+    OpenMesh::parallel_reduce(mesh.face_range(), area);
+    \endcode
+*/
+//@{
+
+
+/// Split _range recursively into indivisible blocks (in range order).
+template <class Range>
+void split_range(const Range& _range, std::vector<Range>& _blocks)
+{
+  _blocks.clear();
+
+  std::vector<Range> stack(1, _range);
+  while (!stack.empty())
+  {
+    Range r = stack.back();
+    stack.pop_back();
+
+    if (r.is_divisible())
+    {
+      Range upper = r.split();
+      stack.push_back(upper);
+      stack.push_back(r);
+    }
+    else if (!r.empty())
+      _blocks.push_back(r);
+  }
+}
+
+
+/** Call _body(block) for all blocks of _range in parallel. The body is
+    shared by all threads, hence a const operator() is used. */
+template <class Range, class Body>
+void parallel_for(const Range& _range, const Body& _body)
+{
+  std::vector<Range> blocks;
+  split_range(_range, blocks);
+
+  const int n_blocks = int(blocks.size());
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(dynamic) if (n_blocks > 1)
+#endif
+  for (int i=0; i<n_blocks; ++i)
+    _body(blocks[i]);
+}
+
+
+namespace Parallel {
+
+// per block adapter of parallel_for_each()
+template <class Func>
+struct ForEachBody
+{
+  explicit ForEachBody(const Func& _func) : func_(_func) {}
+
+  template <class Range>
+  void operator()(const Range& _r) const { _r.for_each(func_); }
+
+  const Func& func_;
+};
+
+} // namespace Parallel
+
+
+/** Call _func(handle) for all elements of _range that are not deleted, in
+    parallel. Each block works on its own copy of _func. */
+template <class Range, class Func>
+void parallel_for_each(const Range& _range, const Func& _func)
+{
+  parallel_for(_range, Parallel::ForEachBody<Func>(_func));
+}
+
+
+/** Parallel reduction over the blocks of _range.
+
+    Every block is processed by a copy of _body taken before the reduction,
+    i.e. _body must be in its initial state (the neutral element of join()).
+    The partial results are joined into _body in range order, so the result
+    does not depend on the number of threads.
+
+    Body needs a copy constructor, void operator()(const Range&) and
+    void join(const Body&).
+*/
+template <class Range, class Body>
+void parallel_reduce(const Range& _range, Body& _body)
+{
+  std::vector<Range> blocks;
+  split_range(_range, blocks);
+
+  const int n_blocks = int(blocks.size());
+
+  std::vector<Body> partial(n_blocks, _body);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(dynamic) if (n_blocks > 1)
+#endif
+  for (int i=0; i<n_blocks; ++i)
+    partial[i](blocks[i]);
+
+  for (int i=0; i<n_blocks; ++i)
+    _body.join(partial[i]);
+}
+
+//@}
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_PARALLEL_HH defined
+//=============================================================================
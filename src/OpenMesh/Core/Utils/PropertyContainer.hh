@@ -48,6 +48,7 @@
 #endif
 
 #include <OpenMesh/Core/Utils/Property.hh>
+#include <typeinfo>
 
 //-----------------------------------------------------------------------------
 namespace OpenMesh
@@ -56,7 +57,14 @@ namespace OpenMesh
   class BaseKernel;
 
 //== CLASS DEFINITION =========================================================
-/// A a container for properties.
+/** A a container for properties.
+
+    Besides the properties the container keeps a hash index of the
+    property names and the type of each property. This way handle() and
+    property(const std::string&) do not scan and compare all names and
+    the type of a property can be checked without a dynamic_cast.
+    The name of a property must not be changed after it has been added.
+*/
 class PropertyContainer
 {
 public:
@@ -88,6 +96,12 @@ public:
     for (; p_it!=p_end; ++p_it)
       if (*p_it)
         *p_it = (*p_it)->clone();
+
+    // clones have the same names and types
+    types_   = _rhs.types_;
+    hashes_  = _rhs.hashes_;
+    next_    = _rhs.next_;
+    buckets_ = _rhs.buckets_;
     return *this;
   }
 
@@ -103,6 +117,7 @@ public:
     for ( ; p_it!=p_end && *p_it!=NULL; ++p_it, ++idx ) {};
     if (p_it==p_end) properties_.push_back(NULL);
     properties_[idx] = new PropertyT<T>(_name);
+    register_property(idx, typeid(PropertyT<T>));
     return BasePropHandleT<T>(idx);
   }
 
@@ -110,34 +125,41 @@ public:
   template <class T>
   BasePropHandleT<T> handle(const T&, const std::string& _name) const
   {
-    Properties::const_iterator p_it = properties_.begin();
-    for (int idx=0; p_it != properties_.end(); ++p_it, ++idx)
-    {
-      if (*p_it != NULL &&
-         (*p_it)->name() == _name  //skip deleted properties
-// Skip type check
-#ifndef OM_FORCE_STATIC_CAST
-          && dynamic_cast<PropertyT<T>*>(properties_[idx]) != NULL //check type
-#endif
-         )
-      {
+    // walk the properties with this name in index order
+    for (int idx = find(_name); idx != -1; idx = find_next(idx, _name))
+      if (is_type<T>(idx))
         return BasePropHandleT<T>(idx);
-      }
-    }
+
     return BasePropHandleT<T>();
   }
 
+  /** Is the property at \c _idx a PropertyT<T> (or derived from it)? The
+      registered type is compared first, only properties of other types
+      are checked with a dynamic_cast.
+  */
+  template <class T> bool is_type(int _idx) const
+  {
+    if (_idx < 0 || _idx >= (int)properties_.size() || properties_[_idx] == NULL)
+      return false;
+    // exact type known from add(), no cast needed
+    if (types_[_idx] != NULL && *types_[_idx] == typeid(PropertyT<T>))
+      return true;
+    // maybe derived from PropertyT<T>
+    return dynamic_cast<const PropertyT<T>*>(properties_[_idx]) != NULL;
+  }
+
+  /// Append the handles of all properties of type T to \c _handles
+  template <class T> void handles(std::vector< BasePropHandleT<T> >& _handles) const
+  {
+    for (int idx = 0; idx < (int)properties_.size(); ++idx)
+      if (is_type<T>(idx))
+        _handles.push_back(BasePropHandleT<T>(idx));
+  }
+
   BaseProperty* property( const std::string& _name ) const
   {
-    Properties::const_iterator p_it = properties_.begin();
-    for (int idx=0; p_it != properties_.end(); ++p_it, ++idx)
-    {
-      if (*p_it != NULL && (*p_it)->name() == _name) //skip deleted properties
-      {
-        return *p_it;
-      }
-    }
-    return NULL;
+    int idx = find(_name);
+    return (idx != -1) ? properties_[idx] : NULL;
   }
 
   template <class T> PropertyT<T>& property(BasePropHandleT<T> _h)
@@ -147,9 +169,8 @@ public:
 #ifdef OM_FORCE_STATIC_CAST
     return *static_cast  <PropertyT<T>*> (properties_[_h.idx()]);
 #else
-    PropertyT<T>* p = dynamic_cast<PropertyT<T>*>(properties_[_h.idx()]);
-    assert(p != NULL);
-    return *p;
+    assert(is_type<T>(_h.idx()));
+    return *static_cast  <PropertyT<T>*> (properties_[_h.idx()]);
 #endif
   }
 
@@ -161,9 +182,8 @@ public:
 #ifdef OM_FORCE_STATIC_CAST
     return *static_cast<PropertyT<T>*>(properties_[_h.idx()]);
 #else
-    PropertyT<T>* p = dynamic_cast<PropertyT<T>*>(properties_[_h.idx()]);
-    assert(p != NULL);
-    return *p;
+    assert(is_type<T>(_h.idx()));
+    return *static_cast<PropertyT<T>*>(properties_[_h.idx()]);
 #endif
   }
 
@@ -173,6 +193,7 @@ public:
     assert(_h.idx() >= 0 && _h.idx() < (int)properties_.size());
     delete properties_[_h.idx()];
     properties_[_h.idx()] = NULL;
+    unregister_property(_h.idx());
   }
 
 
@@ -216,6 +237,7 @@ protected: // generic add/get
     for (; p_it!=p_end && *p_it!=NULL; ++p_it, ++idx) {};
     if (p_it==p_end) properties_.push_back(NULL);
     properties_[idx] = _bp;
+    register_property(int(idx), typeid(*_bp));
     return idx;
   }
 
@@ -249,6 +271,82 @@ protected: // generic add/get
 
 private:
 
+  //------------------------------------------------------ name and type index
+
+  // hash of a property name (FNV-1a)
+  static size_t hash(const std::string& _name)
+  {
+    size_t h = 2166136261u;
+    for (std::string::const_iterator it=_name.begin(); it!=_name.end(); ++it)
+      h = (h ^ (unsigned char)(*it)) * 16777619u;
+    return h;
+  }
+
+  // first property with name _name (lowest index) or -1
+  int find(const std::string& _name) const
+  {
+    if (buckets_.empty())
+      return -1;
+    size_t h = hash(_name);
+    int idx = buckets_[h & (buckets_.size()-1)];
+    for (; idx != -1; idx = next_[idx])
+      if (hashes_[idx] == h && properties_[idx]->name() == _name)
+        return idx;
+    return -1;
+  }
+
+  // next property after _idx with name _name or -1
+  int find_next(int _idx, const std::string& _name) const
+  {
+    size_t h = hashes_[_idx];
+    for (int idx = next_[_idx]; idx != -1; idx = next_[idx])
+      if (hashes_[idx] == h && properties_[idx]->name() == _name)
+        return idx;
+    return -1;
+  }
+
+  void register_property(int _idx, const std::type_info& _type)
+  {
+    if (types_.size() < properties_.size())
+    {
+      types_.resize(properties_.size(), NULL);
+      hashes_.resize(properties_.size(), 0);
+      next_.resize(properties_.size(), -1);
+    }
+    types_[_idx]  = &_type;
+    hashes_[_idx] = hash(properties_[_idx]->name());
+    rebuild_index();
+  }
+
+  void unregister_property(int _idx)
+  {
+    types_[_idx] = NULL;
+    rebuild_index();
+  }
+
+  // Rebuild the hash chains. Chains are sorted by index, such that the
+  // lookup finds the same property as a linear scan. Properties are added
+  // and removed rarely compared to lookups.
+  void rebuild_index()
+  {
+    size_t n_buckets = 8;
+    while (n_buckets < 2*properties_.size())
+      n_buckets *= 2;
+    buckets_.assign(n_buckets, -1);
+
+    for (int idx = int(properties_.size())-1; idx >= 0; --idx)
+    {
+      next_[idx] = -1;
+      if (properties_[idx] != NULL)
+      {
+        int& head  = buckets_[hashes_[idx] & (n_buckets-1)];
+        next_[idx] = head;
+        head       = idx;
+      }
+    }
+  }
+
+
   //-------------------------------------------------- synchronization functors
 
 #ifndef DOXY_IGNORE_THIS
@@ -287,6 +385,14 @@ private:
 #endif
 
   Properties   properties_;
+
+  // per property: exact type, name hash and next property in hash chain
+  std::vector<const std::type_info*>  types_;
+  std::vector<size_t>                 hashes_;
+  std::vector<int>                    next_;
+
+  // first property (lowest index) of each hash bucket, -1 if empty
+  std::vector<int>                    buckets_;
 };
 
 }//namespace OpenMesh
@@ -101,6 +101,44 @@ struct CollapseInfoT {
      */
     typename Mesh::HalfedgeHandle vlv1, v0vl, vrv0, v1vr;
     //@}
+
+    /** \name Virtual collapse
+     *
+     *  Evaluate the geometry as if the collapse was executed, i.e. with
+     *  \c v0 and \c v1 moved to \c p1, without changing the mesh. Modules
+     *  use these instead of temporarily setting the point of \c v0, hence
+     *  computing a collapse priority only reads the mesh and can be done
+     *  for several collapses concurrently.
+     *
+     *  \c p1 is the position of \c v1 for halfedge collapses. With
+     *  DecimaterT::OptimalPlacement it is the position computed for the
+     *  collapsed edge, see moves_v1().
+     */
+    //@{
+
+    /// Position of vertex \c _vh after the collapse
+    const typename Mesh::Point& point_after_collapse(typename Mesh::VertexHandle _vh) const
+    { return (_vh == v0 || _vh == v1) ? p1 : mesh.point(_vh); }
+
+    /// Does the remaining vertex \c v1 change its position?
+    bool moves_v1() const
+    { return p1 != mesh.point(v1); }
+
+    /** Normal of the triangle \c _fh after the collapse, same as
+     *  Mesh::calc_face_normal() on the collapsed mesh.
+     */
+    typename Mesh::Normal face_normal_after_collapse(typename Mesh::FaceHandle _fh) const
+    {
+      typename Mesh::ConstFaceVertexIter fv_it(mesh.cfv_iter(_fh));
+
+      const typename Mesh::Point& q0(point_after_collapse(fv_it.handle()));  ++fv_it;
+      const typename Mesh::Point& q1(point_after_collapse(fv_it.handle()));  ++fv_it;
+      const typename Mesh::Point& q2(point_after_collapse(fv_it.handle()));
+
+      return mesh.calc_face_normal(q0, q1, q2);
+    }
+
+    //@}
 };
 
 //-----------------------------------------------------------------------------
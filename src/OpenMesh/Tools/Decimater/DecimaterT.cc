@@ -54,6 +54,7 @@
 #include <OpenMesh/Tools/Decimater/DecimaterT.hh>
 
 #include <vector>
+#include <algorithm>
 #if defined(OM_CC_MIPS)
 #  include <float.h>
 #else
@@ -69,7 +70,8 @@ namespace Decimater {
 
 template<class Mesh>
 DecimaterT<Mesh>::DecimaterT(Mesh& _mesh) :
-    mesh_(_mesh), heap_(NULL), cmodule_(NULL), initialized_(false) {
+    mesh_(_mesh), heap_(NULL), edge_heap_(NULL), collapse_mode_(HalfedgeCollapse),
+    cmodule_(NULL), initialized_(false) {
   // default properties
   mesh_.request_vertex_status();
   mesh_.request_edge_status();
@@ -341,6 +343,66 @@ void DecimaterT<Mesh>::heap_vertex(VertexHandle _vh) {
 
 //-----------------------------------------------------------------------------
 
+template<class Mesh>
+void DecimaterT<Mesh>::heap_edge(EdgeHandle _eh) {
+  float prio(-1);
+  typename Mesh::HalfedgeHandle collapse;
+  typename Mesh::Point position;
+
+  // first legal direction, both lead to the same position
+  for (int i = 0; i < 2 && !collapse.is_valid(); ++i) {
+    CollapseInfo ci(mesh_, mesh_.halfedge_handle(_eh, i));
+
+    if (!is_collapse_legal(ci))
+      continue;
+
+    // vertices on the boundary, locked and feature vertices stay in place
+    if (!mesh_.is_boundary(ci.v1) && !mesh_.status(ci.v1).locked()
+        && !mesh_.status(ci.v1).feature()) {
+      typename Mesh::Point p;
+      if (cmodule_->collapse_position(ci, p))
+        ci.p1 = p;
+      else {
+        typename ModuleList::iterator m_it, m_end = bmodules_.end();
+        for (m_it = bmodules_.begin(); m_it != m_end; ++m_it)
+          if ((*m_it)->collapse_position(ci, p)) {
+            ci.p1 = p;
+            break;
+          }
+      }
+    }
+
+    prio = collapse_priority(ci);
+    if (prio >= 0.0) {
+      collapse = ci.v0v1;
+      position = ci.p1;
+    }
+  }
+
+  // legal collapse -> put edge on heap
+  if (collapse.is_valid()) {
+    mesh_.property(edge_collapse_, _eh) = collapse;
+    mesh_.property(edge_position_, _eh) = position;
+    mesh_.property(edge_priority_, _eh) = prio;
+
+    if (edge_heap_->is_stored(_eh))
+      edge_heap_->update(_eh);
+    else
+      edge_heap_->insert(_eh);
+  }
+
+  // not valid -> remove from heap
+  else {
+    if (edge_heap_->is_stored(_eh))
+      edge_heap_->remove(_eh);
+
+    mesh_.property(edge_collapse_, _eh) = collapse;
+    mesh_.property(edge_priority_, _eh) = -1;
+  }
+}
+
+//-----------------------------------------------------------------------------
+
 template<class Mesh>
 void DecimaterT<Mesh>::postprocess_collapse(CollapseInfo& _ci) {
   typename ModuleList::iterator m_it, m_end = bmodules_.end();
@@ -386,6 +448,9 @@ size_t DecimaterT<Mesh>::decimate(size_t _n_collapses) {
   if (!_n_collapses)
     _n_collapses = mesh_.n_vertices();
 
+  if (collapse_mode_ == OptimalPlacement)
+    return decimate_edges(_n_collapses, 0, 0);
+
   // initialize heap
   HeapInterface HI(mesh_, priority_, heap_position_);
   heap_ = std::auto_ptr<DeciHeap>(new DeciHeap(HI));
@@ -454,6 +519,9 @@ size_t DecimaterT<Mesh>::decimate_to_faces(size_t _nv, size_t _nf) {
   if (_nv >= mesh_.n_vertices() || _nf >= mesh_.n_faces())
     return 0;
 
+  if (collapse_mode_ == OptimalPlacement)
+    return decimate_edges(mesh_.n_vertices(), _nv, _nf);
+
   typename Mesh::VertexIter v_it, v_end(mesh_.vertices_end());
   typename Mesh::VertexHandle vp;
   typename Mesh::HalfedgeHandle v0v1;
@@ -537,6 +605,129 @@ size_t DecimaterT<Mesh>::decimate_to_faces(size_t _nv, size_t _nf) {
   return n_collapses;
 }
 
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+size_t DecimaterT<Mesh>::decimate_edges(size_t _n_collapses, size_t _nv, size_t _nf) {
+  typename Mesh::EdgeIter e_it, e_end(mesh_.edges_end());
+  typename Mesh::EdgeHandle eh;
+  typename Mesh::HalfedgeHandle v0v1;
+  typename Mesh::VertexVertexIter vv_it;
+  typename Mesh::VertexEdgeIter ve_it;
+  typename Mesh::VertexFaceIter vf_it;
+  size_t nv = mesh_.n_vertices();
+  size_t nf = mesh_.n_faces();
+  size_t n_collapses = 0;
+
+  typedef std::vector<typename Mesh::EdgeHandle> Support;
+  typedef typename Support::iterator SupportIterator;
+
+  Support support;
+  SupportIterator s_it, s_end;
+
+  // per edge cache
+  mesh_.add_property(edge_collapse_);
+  mesh_.add_property(edge_position_);
+  mesh_.add_property(edge_priority_);
+  mesh_.add_property(edge_heap_position_);
+
+  // initialize heap
+  EdgeHeapInterface HI(mesh_, edge_priority_, edge_heap_position_);
+  edge_heap_ = std::auto_ptr<EdgeHeap>(new EdgeHeap(HI));
+  edge_heap_->reserve(mesh_.n_edges());
+
+  for (e_it = mesh_.edges_begin(); e_it != e_end; ++e_it) {
+    edge_heap_->reset_heap_position(e_it.handle());
+    if (!mesh_.status(e_it).deleted())
+      heap_edge(e_it.handle());
+  }
+
+  // process heap
+  while ((!edge_heap_->empty()) && (n_collapses < _n_collapses) && (_nv < nv)
+      && (_nf < nf)) {
+    // get 1st heap entry
+    eh = edge_heap_->front();
+    v0v1 = mesh_.property(edge_collapse_, eh);
+    edge_heap_->pop_front();
+
+    // setup collapse info
+    CollapseInfo ci(mesh_, v0v1);
+    ci.p1 = mesh_.property(edge_position_, eh);
+
+    // The cache of edges near earlier collapses may be stale: check
+    // topology and priority AGAIN, re-insert the edge if they changed
+    if (!is_collapse_legal(ci)
+        || collapse_priority(ci) != mesh_.property(edge_priority_, eh)) {
+      heap_edge(eh);
+      continue;
+    }
+
+    // edges of v0 and v1 are deleted or updated below
+    for (ve_it = mesh_.ve_iter(ci.v0); ve_it; ++ve_it)
+      if (edge_heap_->is_stored(ve_it.handle()))
+        edge_heap_->remove(ve_it.handle());
+    for (ve_it = mesh_.ve_iter(ci.v1); ve_it; ++ve_it)
+      if (edge_heap_->is_stored(ve_it.handle()))
+        edge_heap_->remove(ve_it.handle());
+
+    // adjust complexity in advance (need boundary status)
+    ++n_collapses;
+    --nv;
+    if (mesh_.is_boundary(ci.v0v1) || mesh_.is_boundary(ci.v1v0))
+      --nf;
+    else
+      nf -= 2;
+
+    // pre-processing
+    preprocess_collapse(ci);
+
+    // perform collapse, move the remaining vertex
+    mesh_.collapse(v0v1);
+    mesh_.set_point(ci.v1, ci.p1);
+
+    // update triangle normals
+    vf_it = mesh_.vf_iter(ci.v1);
+    for (; vf_it; ++vf_it)
+      if (!mesh_.status(vf_it).deleted())
+        mesh_.set_normal(vf_it, mesh_.calc_face_normal(vf_it.handle()));
+
+    // post-process collapse
+    postprocess_collapse(ci);
+
+    // update heap: the edges of v1 get new positions and priorities. The
+    // positions of the other edges around the one ring do not change, their
+    // legality is checked when they are popped. Only those currently not
+    // on the heap are updated here, they may have become legal.
+    support.clear();
+    for (ve_it = mesh_.ve_iter(ci.v1); ve_it; ++ve_it)
+      support.push_back(ve_it.handle());
+
+    for (vv_it = mesh_.vv_iter(ci.v1); vv_it; ++vv_it)
+      for (ve_it = mesh_.ve_iter(vv_it.handle()); ve_it; ++ve_it)
+        if (!edge_heap_->is_stored(ve_it.handle()))
+          support.push_back(ve_it.handle());
+
+    std::sort(support.begin(), support.end());
+    support.erase(std::unique(support.begin(), support.end()), support.end());
+
+    for (s_it = support.begin(), s_end = support.end(); s_it != s_end; ++s_it) {
+      assert(!mesh_.status(*s_it).deleted());
+      heap_edge(*s_it);
+    }
+  }
+
+  // delete heap
+  edge_heap_.reset();
+
+  mesh_.remove_property(edge_collapse_);
+  mesh_.remove_property(edge_position_);
+  mesh_.remove_property(edge_priority_);
+  mesh_.remove_property(edge_heap_position_);
+
+  // DON'T do garbage collection here! It's up to the application.
+  return n_collapses;
+}
+
 //=============================================================================
 }// END_NS_DECIMATER
 } // END_NS_OPENMESH
@@ -86,6 +86,22 @@ public: //-------------------------------------------------------- public types
   typedef std::vector< Module* >     ModuleList;
   typedef typename ModuleList::iterator ModuleListIterator;
 
+  /** How collapses are performed
+
+      - \c HalfedgeCollapse: a vertex \c v0 is collapsed into a neighbor
+        \c v1, which keeps its position. Every outgoing halfedge of a
+        vertex is evaluated for the heap (default).
+      - \c OptimalPlacement: edges are collapsed and the remaining vertex
+        is moved to the position computed by the modules, see
+        ModBaseT::collapse_position() (ModQuadricT: minimum of the summed
+        quadric). The position and priority are cached per edge and only
+        recomputed for the edges around the changed one-ring. Vertices on
+        the boundary, locked or feature vertices keep their position.
+        Modules assuming that \c v1 does not move (e.g. ModProgMeshT)
+        can not be used in this mode.
+  */
+  enum CollapseMode { HalfedgeCollapse, OptimalPlacement };
+
 public: //------------------------------------------------------ public methods
 
   /// Constructor
@@ -112,6 +128,13 @@ public: //------------------------------------------------------ public methods
   /// Print information about modules to _os
   void info( std::ostream& _os );
 
+
+  /// Set the collapse mode, see CollapseMode
+  void set_collapse_mode( CollapseMode _mode ) { collapse_mode_ = _mode; }
+
+  /// Get the collapse mode
+  CollapseMode collapse_mode() const { return collapse_mode_; }
+
 public: //--------------------------------------------------- module management
 
   /// access mesh. used in modules.
@@ -235,11 +258,58 @@ public:
   typedef Utils::HeapT<VertexHandle, HeapInterface>  DeciHeap;
 
 
+  typedef typename Mesh::EdgeHandle      EdgeHandle;
+
+  /// Heap interface for the edges (OptimalPlacement)
+  class EdgeHeapInterface
+  {
+  public:
+
+    EdgeHeapInterface(Mesh&               _mesh,
+      EPropHandleT<float> _prio,
+      EPropHandleT<int>   _pos)
+      : mesh_(_mesh), prio_(_prio), pos_(_pos)
+    { }
+
+    inline bool
+    less( EdgeHandle _eh0, EdgeHandle _eh1 )
+    { return mesh_.property(prio_, _eh0) < mesh_.property(prio_, _eh1); }
+
+    inline bool
+    greater( EdgeHandle _eh0, EdgeHandle _eh1 )
+    { return mesh_.property(prio_, _eh0) > mesh_.property(prio_, _eh1); }
+
+    inline int
+    get_heap_position(EdgeHandle _eh)
+    { return mesh_.property(pos_, _eh); }
+
+    inline void
+    set_heap_position(EdgeHandle _eh, int _pos)
+    { mesh_.property(pos_, _eh) = _pos; }
+
+
+  private:
+    Mesh&                mesh_;
+    EPropHandleT<float>  prio_;
+    EPropHandleT<int>    pos_;
+  };
+
+  typedef Utils::HeapT<EdgeHandle, EdgeHeapInterface>  EdgeHeap;
+
+
 private: //---------------------------------------------------- private methods
 
   /// Insert vertex in heap
   void heap_vertex(VertexHandle _vh);
 
+  /// Compute position and priority of an edge collapse and update the edge heap
+  void heap_edge(EdgeHandle _eh);
+
+  /** Collapse edges to optimal positions (OptimalPlacement) until
+      \c _n_collapses collapses are done or the mesh has \c _nv vertices
+      or \c _nf faces. Returns number of performed collapses. */
+  size_t decimate_edges( size_t _n_collapses, size_t _nv, size_t _nf );
+
   /// Is an edge collapse legal?  Performs topological test only.
   /// The method evaluates the status bit Locked, Deleted, and Feature.
   /// \attention The method temporarily sets the bit Tagged. After usage
@@ -272,6 +342,11 @@ private: //------------------------------------------------------- private data
   // heap
   std::auto_ptr<DeciHeap> heap_;
 
+  // heap of the edges (OptimalPlacement)
+  std::auto_ptr<EdgeHeap> edge_heap_;
+
+  CollapseMode collapse_mode_;
+
   // list of binary modules
   ModuleList bmodules_;
 
@@ -289,6 +364,12 @@ private: //------------------------------------------------------- private data
   VPropHandleT<float>           priority_;
   VPropHandleT<int>             heap_position_;
 
+  // edge properties (OptimalPlacement), only present while decimating
+  EPropHandleT<HalfedgeHandle>        edge_collapse_;
+  EPropHandleT<typename Mesh::Point>  edge_position_;
+  EPropHandleT<float>                 edge_priority_;
+  EPropHandleT<int>                   edge_heap_position_;
+
 
 
 private: // Noncopyable
@@ -108,31 +108,30 @@ void ModAspectRatioT<DecimaterT>::initialize() {
 //-----------------------------------------------------------------------------
 
 template<class DecimaterT>
-void ModAspectRatioT<DecimaterT>::preprocess_collapse(const CollapseInfo& _ci) {
-  typename Mesh::FaceHandle fh;
+void ModAspectRatioT<DecimaterT>::postprocess_collapse(const CollapseInfo& _ci) {
   typename Mesh::FVIter fv_it;
 
-  for (typename Mesh::VFIter vf_it = mesh_.vf_iter(_ci.v0); vf_it; ++vf_it) {
-    fh = vf_it.handle();
-    if (fh != _ci.fl && fh != _ci.fr) {
-      typename Mesh::Point& p0 = mesh_.point(fv_it = mesh_.fv_iter(fh));
-      typename Mesh::Point& p1 = mesh_.point(++fv_it);
-      typename Mesh::Point& p2 = mesh_.point(++fv_it);
+  // the faces of v0 are attached to v1 now, v1 may have moved as well
+  for (typename Mesh::VFIter vf_it = mesh_.vf_iter(_ci.v1); vf_it; ++vf_it) {
+    typename Mesh::Point& p0 = mesh_.point(fv_it = mesh_.fv_iter(vf_it));
+    typename Mesh::Point& p1 = mesh_.point(++fv_it);
+    typename Mesh::Point& p2 = mesh_.point(++fv_it);
 
-      mesh_.property(aspect_, fh) = 1.0 / aspectRatio(p0, p1, p2);
-    }
+    mesh_.property(aspect_, vf_it) = 1.0 / aspectRatio(p0, p1, p2);
   }
 }
 
 //-----------------------------------------------------------------------------
 
 template<class DecimaterT>
-float ModAspectRatioT<DecimaterT>::collapse_priority(const CollapseInfo& _ci) {
+void ModAspectRatioT<DecimaterT>::ring_aspects(const CollapseInfo& _ci,
+    typename Mesh::VertexHandle _vh, typename Mesh::VertexHandle _other,
+    Scalar& _r0_min, Scalar& _r1_min) {
   typename Mesh::VertexHandle v2, v3;
   typename Mesh::FaceHandle fh;
   const typename Mesh::Point *p1(&_ci.p1), *p2, *p3;
-  typename Mesh::Scalar r0, r1, r0_min(1.0), r1_min(1.0);
-  typename Mesh::CVVIter vv_it(mesh_, _ci.v0);
+  Scalar r0, r1;
+  typename Mesh::CVVIter vv_it(mesh_, _vh);
 
   v3 = vv_it.handle();
   p3 = &mesh_.point(v3);
@@ -149,15 +148,28 @@ float ModAspectRatioT<DecimaterT>::collapse_priority(const CollapseInfo& _ci) {
     // if not boundary
     if (fh.is_valid()) {
       // aspect before
-      if ((r0 = mesh_.property(aspect_, fh)) < r0_min)
-        r0_min = r0;
+      if ((r0 = mesh_.property(aspect_, fh)) < _r0_min)
+        _r0_min = r0;
 
-      // aspect after
-      if (!(v2 == _ci.v1 || v3 == _ci.v1))
-        if ((r1 = 1.0 / aspectRatio(*p1, *p2, *p3)) < r1_min)
-          r1_min = r1;
+      // aspect after, the faces containing the collapsed edge vanish
+      if (!(v2 == _other || v3 == _other))
+        if ((r1 = 1.0 / aspectRatio(*p1, *p2, *p3)) < _r1_min)
+          _r1_min = r1;
     }
   }
+}
+
+//-----------------------------------------------------------------------------
+
+template<class DecimaterT>
+float ModAspectRatioT<DecimaterT>::collapse_priority(const CollapseInfo& _ci) {
+  Scalar r0_min(1.0), r1_min(1.0);
+
+  ring_aspects(_ci, _ci.v0, _ci.v1, r0_min, r1_min);
+
+  // the faces of v1 change as well, if it is moved (optimal placement)
+  if (_ci.moves_v1())
+    ring_aspects(_ci, _ci.v1, _ci.v0, r0_min, r1_min);
 
   if (Base::is_binary()) {
     return
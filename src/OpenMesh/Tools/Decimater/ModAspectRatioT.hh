@@ -116,10 +116,17 @@ class ModAspectRatioT: public ModBaseT<DecimaterT> {
     float collapse_priority(const CollapseInfo& _ci);
 
     /// update aspect ratio of one-ring
-    void preprocess_collapse(const CollapseInfo& _ci);
+    void postprocess_collapse(const CollapseInfo& _ci);
 
   private:
 
+    /** \brief minimal aspect ratios around \c _vh before and after the
+     *  collapse, if \c _vh is moved to \c _ci.p1. Faces containing
+     *  \c _other are removed by the collapse.
+     */
+    void ring_aspects(const CollapseInfo& _ci, typename Mesh::VertexHandle _vh,
+        typename Mesh::VertexHandle _other, Scalar& _r0_min, Scalar& _r1_min);
+
     /** \brief return aspect ratio (length/height) of triangle
      *
      */
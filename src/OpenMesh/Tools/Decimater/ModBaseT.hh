@@ -242,6 +242,18 @@ public: // common interface
    virtual float collapse_priority(const CollapseInfoT<Mesh>& /* _ci */)
    { return LEGAL_COLLAPSE; }
 
+   /** Compute the position of the vertex remaining after the collapse
+    *  of the edge of \c _ci. Used by DecimaterT::OptimalPlacement, the
+    *  resulting collapse is then evaluated with \c _ci.p1 set to \c _p.
+    *  The position is cached per edge, it may only depend on data of
+    *  \c _ci.v0 and \c _ci.v1.
+    *
+    *  \return \c false if the module does not place vertices.
+    */
+   virtual bool collapse_position(const CollapseInfoT<Mesh>& /* _ci */,
+                                  typename Mesh::Point&      /* _p */)
+   { return false; }
+
    /** Before _from_vh has been collapsed into _to_vh, this method
        will be called.
     */
@@ -71,7 +71,9 @@ ModEdgeLengthT<DecimaterT>::ModEdgeLengthT(DecimaterT &_dec, float _edge_length,
 
 template<class DecimaterT>
 float ModEdgeLengthT<DecimaterT>::collapse_priority(const CollapseInfo& _ci) {
-  typename Mesh::Scalar sqr_length = (_ci.p0 - _ci.p1).sqrnorm();
+  // length of the collapsed edge, p1 is not the position of v1 for
+  // DecimaterT::OptimalPlacement
+  typename Mesh::Scalar sqr_length = (_ci.p0 - mesh_.point(_ci.v1)).sqrnorm();
 
   return ( (sqr_length <= sqr_edge_length_) ? sqr_length : float(Base::ILLEGAL_COLLAPSE));
 }
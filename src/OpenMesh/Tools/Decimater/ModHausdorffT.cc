@@ -211,7 +211,7 @@ float
 ModHausdorffT<DecimaterT>::
 collapse_priority(const CollapseInfo& _ci)
 {
-  static Points                  points;  points.clear();
+  Points                         points;
   std::vector<FaceHandle>        faces;   faces.reserve(20);
   typename Mesh::VertexFaceIter  vf_it;
   typename Mesh::FaceHandle      fh;
@@ -235,6 +235,24 @@ collapse_priority(const CollapseInfo& _ci)
   }
 
 
+  // the faces of v1 change as well, if it is moved (optimal placement),
+  // the points of fl and fr are already collected
+  if (_ci.moves_v1()) {
+    for (vf_it=mesh_.vf_iter(_ci.v1); vf_it; ++vf_it) {
+      fh = vf_it.handle();
+
+      if (fh != _ci.fl && fh != _ci.fr) {
+        faces.push_back(fh);
+
+        Points& pts = mesh_.property(points_, fh);
+        std::copy(pts.begin(), pts.end(), std::back_inserter(points));
+      }
+    }
+
+    points.push_back(mesh_.point(_ci.v1));
+  }
+
+
   // add point to be removed
   points.push_back(_ci.p0);
 
@@ -245,20 +263,16 @@ collapse_priority(const CollapseInfo& _ci)
 
 
 
-  // simulate collapse
-  mesh_.set_point(_ci.v0, _ci.p1);
-
-
-
-  // for each point: try to find a face such that error is < tolerance
+  // for each point: try to find a face such that error is < tolerance,
+  // the faces are evaluated as if the collapse was executed
   ok = true;
   for (p_it=points.begin(); ok && p_it!=p_end; ++p_it) {
     ok = false;
 
     for (fh_it=faces.begin(); !ok && fh_it!=fh_end; ++fh_it) {
-      const Point& p0 = mesh_.point(fv_it=mesh_.cfv_iter(*fh_it));
-      const Point& p1 = mesh_.point(++fv_it);
-      const Point& p2 = mesh_.point(++fv_it);
+      const Point& p0 = _ci.point_after_collapse(fv_it=mesh_.cfv_iter(*fh_it));
+      const Point& p1 = _ci.point_after_collapse(++fv_it);
+      const Point& p2 = _ci.point_after_collapse(++fv_it);
 
       if (  distPointTriangleSquared(*p_it, p0, p1, p2, dummy) <= sqr_tolerace)
         ok = true;
@@ -267,11 +281,6 @@ collapse_priority(const CollapseInfo& _ci)
 
       
 
-  // undo simulation changes
-  mesh_.set_point(_ci.v0, _ci.p0);
-
-
-
   return ( ok ? Base::LEGAL_COLLAPSE : Base::ILLEGAL_COLLAPSE );
 }
 
@@ -155,10 +155,7 @@ public:
    * @return Half of the normal cones size (radius in radians)
    */
   float collapse_priority(const CollapseInfo& _ci) {
-    // simulate collapse
-    mesh_.set_point(_ci.v0, _ci.p1);
-
-
+    // the collapse is simulated by _ci, the mesh is not changed
     typename Mesh::Scalar               max_angle(0.0);
     typename Mesh::ConstVertexFaceIter  vf_it(mesh_, _ci.v0);
     typename Mesh::FaceHandle           fh, fhl, fhr;
@@ -171,7 +168,7 @@ public:
       if (fh != _ci.fl && fh != _ci.fr) {
         NormalCone nc = mesh_.property(normal_cones_, fh);
 
-        nc.merge(NormalCone(mesh_.calc_face_normal(fh)));
+        nc.merge(NormalCone(_ci.face_normal_after_collapse(fh)));
         if (fh == fhl) nc.merge(mesh_.property(normal_cones_, _ci.fl));
         if (fh == fhr) nc.merge(mesh_.property(normal_cones_, _ci.fr));
 
@@ -183,9 +180,23 @@ public:
       }
     }
 
+    // the faces of v1 change as well, if it is moved (optimal placement)
+    if (_ci.moves_v1() && max_angle <= 0.5 * normal_deviation_) {
+      for (vf_it = mesh_.cvf_iter(_ci.v1); vf_it; ++vf_it) {
+        fh = vf_it.handle();
+        if (fh != _ci.fl && fh != _ci.fr) {
+          NormalCone nc = mesh_.property(normal_cones_, fh);
+
+          nc.merge(NormalCone(_ci.face_normal_after_collapse(fh)));
 
-    // undo simulation changes
-    mesh_.set_point(_ci.v0, _ci.p0);
+          if (nc.angle() > max_angle) {
+            max_angle = nc.angle();
+            if (max_angle > 0.5 * normal_deviation_)
+              break;
+          }
+        }
+      }
+    }
 
 
     return (max_angle < 0.5 * normal_deviation_ ? max_angle : float( Base::ILLEGAL_COLLAPSE ));
@@ -100,7 +100,8 @@ public:
    *  before and after a collapse.
    *
    *  -# Compute for each adjacent face of \c _ci.v0 the face
-   *  normal if the collpase would be executed.  
+   *  normal if the collpase would be executed. If \c _ci.v1 is moved
+   *  as well (DecimaterT::OptimalPlacement), also for its faces.
    *
    *  -# Prevent the collapse, if the cosine of the angle between the
    *     original and the new normal is below a given threshold.
@@ -112,33 +113,13 @@ public:
    */
   float collapse_priority(const CollapseInfo& _ci)
   {
-    // simulate collapse
-    Base::mesh().set_point(_ci.v0, _ci.p1);
-    
-    // check for flipping normals
-    typename Mesh::ConstVertexFaceIter vf_it(Base::mesh(), _ci.v0);
-    typename Mesh::FaceHandle          fh;
-    typename Mesh::Scalar              c(1.0);
-    
-    for (; vf_it; ++vf_it) 
-    {
-      fh = vf_it.handle();
-      if (fh != _ci.fl && fh != _ci.fr)
-      {
-        typename Mesh::Normal n1 = Base::mesh().normal(fh);
-        typename Mesh::Normal n2 = Base::mesh().calc_face_normal(fh);
+    // check for flipping normals, the collapse is simulated by _ci
+    bool legal = check_faces(_ci, _ci.v0);
 
-        c = dot(n1, n2);
-        
-        if (c < min_cos_)
-          break;
-      }
-    }
-      
-    // undo simulation changes
-    Base::mesh().set_point(_ci.v0, _ci.p0);
+    if (legal && _ci.moves_v1())
+      legal = check_faces(_ci, _ci.v1);
 
-    return float( (c < min_cos_) ? Base::ILLEGAL_COLLAPSE : Base::LEGAL_COLLAPSE );
+    return float( legal ? Base::LEGAL_COLLAPSE : Base::ILLEGAL_COLLAPSE );
   }
 
 
@@ -162,6 +143,28 @@ private:
 
   // hide this method
   void set_binary(bool _b) {}
+
+  // check the faces of _vh (except fl and fr) for flipping normals
+  bool check_faces(const CollapseInfo& _ci, typename Mesh::VertexHandle _vh)
+  {
+    typename Mesh::ConstVertexFaceIter vf_it(Base::mesh(), _vh);
+    typename Mesh::FaceHandle          fh;
+
+    for (; vf_it; ++vf_it) 
+    {
+      fh = vf_it.handle();
+      if (fh != _ci.fl && fh != _ci.fr)
+      {
+        typename Mesh::Normal n1 = Base::mesh().normal(fh);
+        typename Mesh::Normal n2 = _ci.face_normal_after_collapse(fh);
+
+        if (dot(n1, n2) < min_cos_)
+          return false;
+      }
+    }
+
+    return true;
+  }
    
 private:
 
@@ -55,6 +55,13 @@
 
 #include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
 
+#include <vector>
+#include <algorithm>
+
+#ifdef USE_OPENMP
+#  include <omp.h>
+#endif
+
 
 //== NAMESPACE ===============================================================
 
@@ -75,6 +82,14 @@ initialize()
   if (!quadrics_.is_valid())
     Base::mesh().add_property( quadrics_ );
 
+#ifdef USE_OPENMP
+  if (omp_get_max_threads() > 1)
+  {
+    initialize_parallel();
+    return;
+  }
+#endif
+
   // clear quadrics
   typename Mesh::VertexIter  v_it  = Base::mesh().vertices_begin(),
                              v_end = Base::mesh().vertices_end();
@@ -82,14 +97,12 @@ initialize()
   for (; v_it != v_end; ++v_it)
     Base::mesh().property(quadrics_, v_it).clear();
 
-  // calc (normal weighted) quadric
-  typename Mesh::FaceIter          f_it  = Base::mesh().faces_begin(),
+  // calc (normal weighted) quadric, skip faces deleted by earlier collapses
+  typename Mesh::FaceIter          f_it  = Base::mesh().faces_sbegin(),
                                    f_end = Base::mesh().faces_end();
 
   typename Mesh::FaceVertexIter    fv_it;
   typename Mesh::VertexHandle      vh0, vh1, vh2;
-  typedef Vec3d                    Vec3;
-  double                           a,b,c,d, area;
 
   for (; f_it != f_end; ++f_it)
   {
@@ -98,35 +111,121 @@ initialize()
     vh1 = fv_it.handle();  ++fv_it;
     vh2 = fv_it.handle();
 
-    Vec3 v0, v1, v2;
-    {
-      using namespace OpenMesh;
+    Quadricd q = face_quadric(vh0, vh1, vh2);
+
+    Base::mesh().property(quadrics_, vh0) += q;
+    Base::mesh().property(quadrics_, vh1) += q;
+    Base::mesh().property(quadrics_, vh2) += q;
+  }
+}
 
-      v0 = vector_cast<Vec3>(Base::mesh().point(vh0));
-      v1 = vector_cast<Vec3>(Base::mesh().point(vh1));
-      v2 = vector_cast<Vec3>(Base::mesh().point(vh2));
-    }
 
-    Vec3 n = (v1-v0) % (v2-v0);
-    area = n.norm();
-    if (area > FLT_MIN)
+//-----------------------------------------------------------------------------
+
+
+template<class DecimaterType>
+void
+ModQuadricT<DecimaterType>::
+initialize_parallel()
+{
+  using Geometry::Quadricd;
+
+  const Mesh& mesh = Base::mesh();
+  const int   nf   = int(mesh.n_faces());
+  const int   nv   = int(mesh.n_vertices());
+
+  // quadric per face
+  std::vector<Quadricd> face_quadrics(nf);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int f=0; f<nf; ++f)
+  {
+    if (mesh.status(typename Mesh::FaceHandle(f)).deleted())
+      continue;
+
+    typename Mesh::ConstFaceVertexIter fv_it =
+      mesh.cfv_iter(typename Mesh::FaceHandle(f));
+    typename Mesh::VertexHandle        vh0, vh1, vh2;
+
+    vh0 = fv_it.handle();  ++fv_it;
+    vh1 = fv_it.handle();  ++fv_it;
+    vh2 = fv_it.handle();
+
+    face_quadrics[f] = face_quadric(vh0, vh1, vh2);
+  }
+
+  // Sum up the quadrics of the incident faces per vertex. The faces are
+  // added in the order of their indices, like initialize() does, so the
+  // result does not depend on the number of threads.
+#ifdef USE_OPENMP
+#pragma omp parallel
+#endif
+  {
+    std::vector<int> faces;
+
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (int v=0; v<nv; ++v)
     {
-      n /= area;
-      area *= 0.5;
+      faces.clear();
+      for (typename Mesh::ConstVertexFaceIter vf_it =
+             mesh.cvf_iter(typename Mesh::VertexHandle(v)); vf_it; ++vf_it)
+        faces.push_back(vf_it.handle().idx());
+      std::sort(faces.begin(), faces.end());
+
+      Quadricd q;
+      for (size_t i=0; i<faces.size(); ++i)
+        q += face_quadrics[faces[i]];
+
+      Base::mesh().property(quadrics_, typename Mesh::VertexHandle(v)) = q;
     }
+  }
+}
 
-    a = n[0];
-    b = n[1];
-    c = n[2];
-    d = -(vector_cast<Vec3>(Base::mesh().point(vh0))|n);
 
-    Quadricd q(a, b, c, d);
-    q *= area;
+//-----------------------------------------------------------------------------
 
-    Base::mesh().property(quadrics_, vh0) += q;
-    Base::mesh().property(quadrics_, vh1) += q;
-    Base::mesh().property(quadrics_, vh2) += q;
+
+template<class DecimaterType>
+Geometry::Quadricd
+ModQuadricT<DecimaterType>::
+face_quadric(typename Mesh::VertexHandle _vh0,
+             typename Mesh::VertexHandle _vh1,
+             typename Mesh::VertexHandle _vh2)
+{
+  using Geometry::Quadricd;
+  typedef Vec3d                    Vec3;
+  double                           a,b,c,d, area;
+
+  Vec3 v0, v1, v2;
+  {
+    using namespace OpenMesh;
+
+    v0 = vector_cast<Vec3>(Base::mesh().point(_vh0));
+    v1 = vector_cast<Vec3>(Base::mesh().point(_vh1));
+    v2 = vector_cast<Vec3>(Base::mesh().point(_vh2));
+  }
+
+  Vec3 n = (v1-v0) % (v2-v0);
+  area = n.norm();
+  if (area > FLT_MIN)
+  {
+    n /= area;
+    area *= 0.5;
   }
+
+  a = n[0];
+  b = n[1];
+  c = n[2];
+  d = -(v0|n);
+
+  Quadricd q(a, b, c, d);
+  q *= area;
+
+  return q;
 }
 
 
@@ -103,7 +103,12 @@ public:
 
 public: // inherited
 
-  /// Initalize the module and prepare the mesh for decimation.
+  /** Initalize the module and prepare the mesh for decimation.
+   *
+   *  With OpenMP and more than one thread the face quadrics are computed
+   *  in parallel and gathered per vertex, with the same result as the
+   *  serial loop.
+   */
   virtual void initialize(void);
 
   /** Compute collapse priority based on error quadrics.
@@ -131,6 +136,47 @@ public: // inherited
   }
 
 
+  /** Position minimizing the summed quadric of \c _ci.v0 and \c _ci.v1.
+   *  If it is not well defined, the best of \c p0, \c p1 and the edge
+   *  midpoint is used.
+   */
+  virtual bool collapse_position(const CollapseInfo& _ci,
+                                 typename Mesh::Point& _p)
+  {
+    using namespace OpenMesh;
+
+    typedef Geometry::QuadricT<double> Q;
+
+    Q q = Base::mesh().property(quadrics_, _ci.v0);
+    q += Base::mesh().property(quadrics_, _ci.v1);
+
+    Vec3d p;
+    if (q.minimizer(p))
+    {
+      _p = vector_cast<typename Mesh::Point>(p);
+      return true;
+    }
+
+    // fallback: best candidate on the edge
+    Vec3d  candidates[3];
+    double errors[3];
+
+    candidates[0] = vector_cast<Vec3d>(_ci.p0);
+    candidates[1] = vector_cast<Vec3d>(_ci.p1);
+    candidates[2] = (candidates[0] + candidates[1]) * 0.5;
+
+    q(candidates, 3, errors);
+
+    int best = (errors[1] <= errors[0]) ? 1 : 0;
+    if (errors[2] < errors[best])
+      best = 2;
+
+    _p = (best == 2) ? vector_cast<typename Mesh::Point>(candidates[2])
+                     : (best == 1) ? _ci.p1 : _ci.p0;
+    return true;
+  }
+
+
   /// Post-process halfedge collapse (accumulate quadrics)
   virtual void postprocess_collapse(const CollapseInfo& _ci)
   {
@@ -166,6 +212,16 @@ public: // specific methods
   double max_err() const { return max_err_; }
 
 
+private:
+
+  /// parallel version of initialize()
+  void initialize_parallel();
+
+  /// area weighted quadric of the triangle (_vh0, _vh1, _vh2)
+  Geometry::Quadricd face_quadric(typename Mesh::VertexHandle _vh0,
+                                  typename Mesh::VertexHandle _vh1,
+                                  typename Mesh::VertexHandle _vh2);
+
 private:
 
   // maximum quadric error
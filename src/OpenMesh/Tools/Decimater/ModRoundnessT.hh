@@ -117,11 +117,29 @@ class ModRoundnessT : public ModBaseT<DecimaterType>
    */
   float collapse_priority(const CollapseInfo& _ci)  
   {    
+    double priority = ring_priority(_ci, _ci.v0, 0.0); //==LEGAL_COLLAPSE
+
+    // the faces of v1 change as well, if it is moved (optimal placement)
+    if (_ci.moves_v1() && priority != Base::ILLEGAL_COLLAPSE)
+      priority = ring_priority(_ci, _ci.v1, priority);
+
+    return (float) priority;
+  }
+
+
+
+private:
+
+  /// Update \c _priority by the faces of \c _vh after the collapse
+  double ring_priority(const CollapseInfo&        _ci,
+                       typename Mesh::VertexHandle _vh,
+                       double                      _priority)
+  {
     //     using namespace OpenMesh;
 
-    typename Mesh::ConstVertexOHalfedgeIter voh_it(Base::mesh(), _ci.v0);
+    typename Mesh::ConstVertexOHalfedgeIter voh_it(Base::mesh(), _vh);
     double                                  r;
-    double                                  priority = 0.0; //==LEGAL_COLLAPSE
+    double                                  priority = _priority;
     typename Mesh::FaceHandle               fhC, fhB;
     Vec3f                                   B,C;
 
@@ -140,7 +158,7 @@ class ModRoundnessT : public ModBaseT<DecimaterType>
         if ( fhB == _ci.fl || fhB == _ci.fr )
           continue;
 
-        // simulate collapse using position of v1
+        // simulate collapse using the new position of _vh
         r = roundness( vector_cast<Vec3f>(_ci.p1), B, C );
 
         // return the maximum non-roundness
@@ -168,7 +186,7 @@ class ModRoundnessT : public ModBaseT<DecimaterType>
       }
     }
 
-    return (float) priority;
+    return priority;
   }
 
 
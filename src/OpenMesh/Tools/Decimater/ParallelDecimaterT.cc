@@ -0,0 +1,408 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+ \*===========================================================================*/
+
+/** \file ParallelDecimaterT.cc
+ */
+
+//=============================================================================
+//
+//  CLASS ParallelDecimaterT - IMPLEMENTATION
+//
+//=============================================================================
+#define OPENMESH_DECIMATER_PARALLELDECIMATERT_CC
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Tools/Decimater/ParallelDecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
+#include <OpenMesh/Core/System/omstream.hh>
+
+#include <vector>
+#include <algorithm>
+
+#ifdef USE_OPENMP
+#  include <omp.h>
+#endif
+
+//== NAMESPACE ===============================================================
+
+namespace OpenMesh {
+namespace Decimater {
+
+//== IMPLEMENTATION ==========================================================
+
+template<class Mesh>
+ParallelDecimaterT<Mesh>::ParallelDecimaterT(Mesh& _mesh) :
+    mesh_(_mesh), n_clusters_(1), seam_rings_(2), n_cluster_collapses_(0) {
+#ifdef USE_OPENMP
+  n_clusters_ = size_t(omp_get_max_threads());
+#endif
+
+  // default properties
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+  mesh_.request_face_normals();
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+ParallelDecimaterT<Mesh>::~ParallelDecimaterT() {
+  mesh_.release_vertex_status();
+  mesh_.release_edge_status();
+  mesh_.release_face_status();
+  mesh_.release_face_normals();
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+void ParallelDecimaterT<Mesh>::setup(Decimater& _decimater) {
+  typename ModQuadricT<Decimater>::Handle hModQuadric;
+  _decimater.add(hModQuadric);
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+size_t ParallelDecimaterT<Mesh>::decimate(size_t _n_collapses) {
+  const size_t nv = mesh_.n_vertices();
+  const int n_clusters = int(std::min(n_clusters_, nv));
+
+  n_cluster_collapses_ = 0;
+
+  if (n_clusters <= 1)
+    return decimate_seams(std::vector<char>(), _n_collapses);
+
+  // spatial clusters of the vertices
+  std::vector<int> vertices;
+  vertices.reserve(nv);
+
+  typename Mesh::VertexIter v_it, v_end(mesh_.vertices_end());
+  for (v_it = mesh_.vertices_begin(); v_it != v_end; ++v_it)
+    if (!mesh_.status(v_it).deleted())
+      vertices.push_back(v_it.handle().idx());
+
+  std::vector<int> cluster_of(nv, -1);
+  split(vertices.begin(), vertices.end(), 0, n_clusters, cluster_of);
+  std::vector<int>().swap(vertices);
+
+  // a face belongs to the cluster of its first vertex, the vertices used
+  // by faces of several clusters form the seams. vertex_cluster holds the
+  // cluster of the first face seen at each vertex, -1 for unused vertices
+  std::vector< std::vector<int> > faces(n_clusters);
+  std::vector<int> vertex_cluster(nv, -1);
+  std::vector<char> seam(nv, 0);
+
+  typename Mesh::FaceIter f_it, f_end(mesh_.faces_end());
+  typename Mesh::FaceVertexIter fv_it;
+
+  for (f_it = mesh_.faces_begin(); f_it != f_end; ++f_it) {
+    if (mesh_.status(f_it).deleted())
+      continue;
+
+    fv_it = mesh_.fv_iter(f_it);
+    int c = cluster_of[fv_it.handle().idx()];
+    faces[c].push_back(f_it.handle().idx());
+
+    for (; fv_it; ++fv_it) {
+      int& vc = vertex_cluster[fv_it.handle().idx()];
+      if (vc < 0)
+        vc = c;
+      else if (vc != c)
+        seam[fv_it.handle().idx()] = 1;
+    }
+  }
+
+  // lock the seams and their neighbors, then all one-rings of collapses
+  // in a cluster lie inside the cluster
+  std::vector<char> locked(nv, 0);
+
+  for (v_it = mesh_.vertices_begin(); v_it != v_end; ++v_it) {
+    if (seam[v_it.handle().idx()]) {
+      locked[v_it.handle().idx()] = 1;
+      for (typename Mesh::VertexVertexIter vv_it = mesh_.vv_iter(v_it); vv_it; ++vv_it)
+        locked[vv_it.handle().idx()] = 1;
+    }
+  }
+
+  // share of the collapses per cluster, counted over the vertices used by
+  // faces that are not locked
+  std::vector<size_t> n_free(n_clusters, 0);
+  size_t n_used = 0;
+
+  for (size_t i = 0; i < nv; ++i) {
+    if (vertex_cluster[i] >= 0) {
+      ++n_used;
+      if (!locked[i])
+        ++n_free[vertex_cluster[i]];
+    }
+  }
+
+  // decimate the clusters
+  std::vector<CollapseList> logs(n_clusters);
+  std::vector<char> ok(n_clusters, 1);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (int c = 0; c < n_clusters; ++c) {
+    size_t n = 0;
+    if (_n_collapses) {
+      n = size_t(double(_n_collapses) * double(n_free[c]) / double(n_used) + 0.5);
+      if (!n)
+        continue;
+    }
+    ok[c] = decimate_cluster(faces[c], locked, n, logs[c]);
+  }
+
+  if (std::find(ok.begin(), ok.end(), 0) != ok.end()) {
+    omerr() << "ParallelDecimaterT: cannot initialize decimater\n";
+    return 0;
+  }
+
+  // replay the collapses, the clusters do not interfere
+  size_t n_collapses = 0;
+
+  for (int c = 0; c < n_clusters; ++c) {
+    const CollapseList& log = logs[c];
+
+    for (size_t i = 0; i < log.size(); ++i) {
+      typename Mesh::HalfedgeHandle v0v1 = mesh_.find_halfedge(log[i].v0, log[i].v1);
+      assert(v0v1.is_valid());
+
+      mesh_.collapse(v0v1);
+      mesh_.set_point(log[i].v1, log[i].p1);
+      ++n_collapses;
+
+      // update triangle normals
+      for (typename Mesh::VertexFaceIter vf_it = mesh_.vf_iter(log[i].v1); vf_it; ++vf_it)
+        mesh_.set_normal(vf_it, mesh_.calc_face_normal(vf_it.handle()));
+    }
+
+    CollapseList().swap(logs[c]);
+  }
+
+  n_cluster_collapses_ = n_collapses;
+
+  if (_n_collapses && n_collapses >= _n_collapses)
+    return n_collapses;
+
+  // decimate the seams
+  return n_collapses
+      + decimate_seams(locked, _n_collapses ? _n_collapses - n_collapses : 0);
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+void ParallelDecimaterT<Mesh>::split(std::vector<int>::iterator _begin,
+    std::vector<int>::iterator _end, int _cluster, int _n_clusters,
+    std::vector<int>& _cluster_of) {
+  std::vector<int>::iterator it;
+
+  if (_n_clusters == 1 || _end - _begin < 2) {
+    for (it = _begin; it != _end; ++it)
+      _cluster_of[*it] = _cluster;
+    return;
+  }
+
+  // median split along the longest side of the bounding box
+  typename Mesh::Point bb_min = mesh_.point(VertexHandle(*_begin));
+  typename Mesh::Point bb_max = bb_min;
+
+  for (it = _begin; it != _end; ++it) {
+    bb_min.minimize(mesh_.point(VertexHandle(*it)));
+    bb_max.maximize(mesh_.point(VertexHandle(*it)));
+  }
+
+  typename Mesh::Point extent = bb_max - bb_min;
+  int axis = 0;
+  if (extent[1] > extent[axis])
+    axis = 1;
+  if (extent[2] > extent[axis])
+    axis = 2;
+
+  int n_left = _n_clusters / 2;
+  std::vector<int>::iterator mid = _begin + (_end - _begin) * n_left / _n_clusters;
+  std::nth_element(_begin, mid, _end, CoordinateLess(mesh_, axis));
+
+  split(_begin, mid, _cluster, n_left, _cluster_of);
+  split(mid, _end, _cluster + n_left, _n_clusters - n_left, _cluster_of);
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+bool ParallelDecimaterT<Mesh>::decimate_cluster(const std::vector<int>& _faces,
+    const std::vector<char>& _locked, size_t _n_collapses, CollapseList& _log) {
+  typename Mesh::ConstFaceVertexIter fv_it;
+
+  // vertices of the cluster
+  std::vector<int> ids;
+  ids.reserve(_faces.size());
+  for (size_t i = 0; i < _faces.size(); ++i)
+    for (fv_it = mesh_.cfv_iter(typename Mesh::FaceHandle(_faces[i])); fv_it; ++fv_it)
+      ids.push_back(fv_it.handle().idx());
+
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+  // copy of the cluster
+  Mesh mesh;
+  mesh.request_vertex_status();
+  mesh.request_edge_status();
+  mesh.reserve(ids.size(), ids.size() + _faces.size(), _faces.size());
+
+  for (size_t i = 0; i < ids.size(); ++i) {
+    VertexHandle vh(ids[i]);
+    VertexHandle copy = mesh.add_vertex(mesh_.point(vh));
+
+    mesh.status(copy) = mesh_.status(vh);
+    if (_locked[ids[i]])
+      mesh.status(copy).set_locked(true);
+  }
+
+  std::vector<VertexHandle> vhandles;
+  for (size_t i = 0; i < _faces.size(); ++i) {
+    vhandles.clear();
+    for (fv_it = mesh_.cfv_iter(typename Mesh::FaceHandle(_faces[i])); fv_it; ++fv_it)
+      vhandles.push_back(VertexHandle(int(std::lower_bound(ids.begin(), ids.end(),
+          fv_it.handle().idx()) - ids.begin())));
+    mesh.add_face(vhandles);
+  }
+
+  // feature edges
+  typename Mesh::EdgeIter e_it, e_end(mesh.edges_end());
+  for (e_it = mesh.edges_begin(); e_it != e_end; ++e_it) {
+    typename Mesh::HalfedgeHandle heh = mesh.halfedge_handle(e_it, 0);
+    typename Mesh::HalfedgeHandle original = mesh_.find_halfedge(
+        VertexHandle(ids[mesh.from_vertex_handle(heh).idx()]),
+        VertexHandle(ids[mesh.to_vertex_handle(heh).idx()]));
+
+    if (original.is_valid() && mesh_.status(mesh_.edge_handle(original)).feature())
+      mesh.status(e_it).set_feature(true);
+  }
+
+  // decimate and record the collapses
+  Decimater decimater(mesh);
+  setup(decimater);
+
+  typename ModCollapseLog::Handle hModCollapseLog;
+  decimater.add(hModCollapseLog);
+
+  if (!decimater.initialize())
+    return false;
+
+  mesh.update_face_normals();
+  decimater.decimate(_n_collapses);
+
+  const CollapseList& log = decimater.module(hModCollapseLog).log();
+  _log.resize(log.size());
+
+  for (size_t i = 0; i < log.size(); ++i) {
+    _log[i].v0 = VertexHandle(ids[log[i].v0.idx()]);
+    _log[i].v1 = VertexHandle(ids[log[i].v1.idx()]);
+    _log[i].p1 = log[i].p1;
+  }
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+size_t ParallelDecimaterT<Mesh>::decimate_seams(const std::vector<char>& _locked,
+    size_t _n_collapses) {
+  // only the vertices locked in the clusters and the band around them
+  // may be removed
+  std::vector<char> user_locked;
+
+  if (!_locked.empty()) {
+    std::vector<char> band(_locked);
+    typename Mesh::VertexIter v_it, v_end(mesh_.vertices_end());
+
+    for (int ring = 0; ring < seam_rings_; ++ring) {
+      std::vector<char> next(band);
+      for (v_it = mesh_.vertices_sbegin(); v_it != v_end; ++v_it)
+        if (band[v_it.handle().idx()])
+          for (typename Mesh::VertexVertexIter vv_it = mesh_.vv_iter(v_it); vv_it; ++vv_it)
+            next[vv_it.handle().idx()] = 1;
+      band.swap(next);
+    }
+
+    user_locked.resize(mesh_.n_vertices());
+
+    for (v_it = mesh_.vertices_begin(); v_it != v_end; ++v_it) {
+      user_locked[v_it.handle().idx()] = mesh_.status(v_it).locked();
+      if (!band[v_it.handle().idx()])
+        mesh_.status(v_it).set_locked(true);
+    }
+  }
+
+  size_t n_collapses = 0;
+  {
+    Decimater decimater(mesh_);
+    setup(decimater);
+
+    if (decimater.initialize()) {
+      // update_face_normals() does not skip the deleted faces
+      typename Mesh::FaceIter f_it, f_end(mesh_.faces_end());
+      for (f_it = mesh_.faces_sbegin(); f_it != f_end; ++f_it)
+        mesh_.set_normal(f_it, mesh_.calc_face_normal(f_it.handle()));
+
+      n_collapses = decimater.decimate(_n_collapses);
+    } else
+      omerr() << "ParallelDecimaterT: cannot initialize decimater\n";
+  }
+
+  for (size_t i = 0; i < user_locked.size(); ++i)
+    mesh_.status(VertexHandle(int(i))).set_locked(user_locked[i] != 0);
+
+  return n_collapses;
+}
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
+
@@ -0,0 +1,252 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+/** \file ParallelDecimaterT.hh
+ */
+
+//=============================================================================
+//
+//  CLASS ParallelDecimaterT
+//
+//=============================================================================
+
+#ifndef OPENMESH_DECIMATER_PARALLELDECIMATERT_HH
+#define OPENMESH_DECIMATER_PARALLELDECIMATERT_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Tools/Decimater/DecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/ModBaseT.hh>
+#include <vector>
+
+
+//== NAMESPACE ================================================================
+
+namespace OpenMesh  {
+namespace Decimater {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Binary module recording the performed collapses, used by
+    ParallelDecimaterT to replay the collapses of a cluster.
+ */
+template <class DecimaterType>
+class ModCollapseLogT : public ModBaseT<DecimaterType>
+{
+public:
+
+  DECIMATING_MODULE( ModCollapseLogT, DecimaterType, CollapseLog );
+
+  /// A performed collapse
+  struct Collapse
+  {
+    typename Mesh::VertexHandle v0, v1;  ///< See CollapseInfoT
+    typename Mesh::Point        p1;      ///< position of v1 afterwards
+  };
+
+  typedef std::vector<Collapse> CollapseList;
+
+  /// Constructor
+  ModCollapseLogT( DecimaterType& _dec ) : Base(_dec, true) {}
+
+  /// Stores the collapse
+  void postprocess_collapse(const CollapseInfo& _ci)
+  {
+    Collapse collapse;
+    collapse.v0 = _ci.v0;
+    collapse.v1 = _ci.v1;
+    collapse.p1 = Base::mesh().point(_ci.v1);
+    log_.push_back(collapse);
+  }
+
+  /// The collapses in the order they were performed
+  const CollapseList& log() const { return log_; }
+
+private:
+
+  // hide this method from user
+  void set_binary(bool) {}
+
+  CollapseList log_;
+};
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Parallel decimation of large meshes.
+
+    DecimaterT processes one global heap and therefore can not be
+    parallelized. ParallelDecimaterT splits the mesh into spatial
+    clusters (kd-tree median splits of the vertices) and decimates them
+    concurrently (OpenMP):
+
+    -# Every cluster is copied to a mesh of its own. Vertices used by
+       faces of other clusters and their neighbors are locked, so that
+       the one-rings of all collapses lie inside the cluster.
+    -# Each copy is decimated by a DecimaterT, the performed collapses
+       are recorded and then replayed on the mesh. Hence the mesh is only
+       modified by collapses, like by DecimaterT, its properties are kept.
+    -# A final DecimaterT pass decimates the seams. Only the vertices
+       locked in the clusters and a band of seam_rings() rings around
+       them can be removed in this pass. Its modules are initialized on
+       the decimated mesh, e.g. ModQuadricT recomputes the quadrics.
+
+    The clusters get a share of the collapses proportional to their
+    number of vertices, the locked vertices' share is left for the seam
+    pass. Within a cluster the modules see the same data as in a global
+    decimation, apart from the order of the collapses.
+
+    The modules are added by setup(), which is called concurrently for
+    the clusters. Default is ModQuadricT. Derive and overload setup() to
+    use other modules or the collapse mode DecimaterT::OptimalPlacement.
+    As with DecimaterT, the face normals are requested and the garbage
+    collection is left to the caller.
+*/
+template < typename MeshT >
+class ParallelDecimaterT
+{
+public: //-------------------------------------------------------- public types
+
+  typedef MeshT                            Mesh;
+  typedef DecimaterT< MeshT >              Decimater;
+  typedef ModCollapseLogT< Decimater >     ModCollapseLog;
+
+public: //------------------------------------------------------ public methods
+
+  /// Constructor
+  ParallelDecimaterT( Mesh& _mesh );
+
+  /// Destructor
+  virtual ~ParallelDecimaterT();
+
+
+  /// Set the number of clusters (default: number of OpenMP threads)
+  void set_n_clusters( size_t _n ) { n_clusters_ = _n; }
+
+  /// Get the number of clusters
+  size_t n_clusters() const { return n_clusters_; }
+
+
+  /** Set the width of the band around the seams, in rings of the
+      decimated mesh, which can be decimated by the seam pass (default 2) */
+  void set_seam_rings( int _n ) { seam_rings_ = _n; }
+
+  /// Get the width of the band around the seams
+  int seam_rings() const { return seam_rings_; }
+
+
+  /** Decimate (perform _n_collapses collapses). Return number of
+      performed collapses. If _n_collapses is not given reduce as
+      much as possible */
+  size_t decimate( size_t _n_collapses = 0 );
+
+  /// Decimate to target complexity, returns number of collapses
+  size_t decimate_to( size_t _n_vertices )
+  {
+    return ( (_n_vertices < mesh_.n_vertices()) ?
+             decimate( mesh_.n_vertices() - _n_vertices ) : 0 );
+  }
+
+  /// Number of collapses done in the clusters by the last decimate()
+  size_t n_cluster_collapses() const { return n_cluster_collapses_; }
+
+protected:
+
+  /// Add the modules to a decimater, default: ModQuadricT
+  virtual void setup( Decimater& _decimater );
+
+private: //--------------------------------------------------- private methods
+
+  typedef typename Mesh::VertexHandle   VertexHandle;
+  typedef typename ModCollapseLog::CollapseList CollapseList;
+
+  /// Order of vertex indices by a coordinate
+  struct CoordinateLess
+  {
+    CoordinateLess(const Mesh& _mesh, int _axis) : mesh(_mesh), axis(_axis) {}
+    bool operator()(int _a, int _b) const
+    { return mesh.point(VertexHandle(_a))[axis] < mesh.point(VertexHandle(_b))[axis]; }
+    const Mesh& mesh;
+    int         axis;
+  };
+
+  void split( std::vector<int>::iterator _begin,
+              std::vector<int>::iterator _end,
+              int _cluster, int _n_clusters,
+              std::vector<int>& _cluster_of );
+
+  bool decimate_cluster( const std::vector<int>& _faces,
+                         const std::vector<char>& _locked,
+                         size_t _n_collapses,
+                         CollapseList& _log );
+
+  size_t decimate_seams( const std::vector<char>& _locked,
+                         size_t _n_collapses );
+
+private: //------------------------------------------------ private data
+
+  Mesh&   mesh_;
+  size_t  n_clusters_;
+  int     seam_rings_;
+  size_t  n_cluster_collapses_;
+
+private: // Noncopyable
+
+  ParallelDecimaterT(const ParallelDecimaterT&);
+  ParallelDecimaterT& operator = (const ParallelDecimaterT&);
+};
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_DECIMATER_PARALLELDECIMATERT_CC)
+#define OPENMESH_DECIMATER_PARALLELDECIMATERT_TEMPLATES
+#include "ParallelDecimaterT.cc"
+#endif
+//=============================================================================
+#endif // OPENMESH_DECIMATER_PARALLELDECIMATERT_HH defined
+//=============================================================================
+
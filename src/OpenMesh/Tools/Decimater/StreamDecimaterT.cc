@@ -0,0 +1,487 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+ \*===========================================================================*/
+
+/** \file StreamDecimaterT.cc
+ */
+
+//=============================================================================
+//
+//  CLASS StreamDecimaterT - IMPLEMENTATION
+//
+//=============================================================================
+#define OPENMESH_DECIMATER_STREAMDECIMATERT_CC
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Tools/Decimater/StreamDecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
+#include <OpenMesh/Core/IO/MeshIO.hh>
+#include <OpenMesh/Core/System/omstream.hh>
+
+#include <vector>
+#include <algorithm>
+#include <fstream>
+
+//== NAMESPACE ===============================================================
+
+namespace OpenMesh {
+namespace Decimater {
+
+//== IMPLEMENTATION ==========================================================
+
+template<class Mesh>
+StreamDecimaterT<Mesh>::StreamDecimaterT() :
+    block_faces_(1 << 20), vertex_cache_(1 << 22), n_blocks_(0),
+    vertex_store_(NULL), list_store_(NULL), n_complex_(0) {
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+void StreamDecimaterT<Mesh>::setup(Decimater& _decimater) {
+  typename ModQuadricT<Decimater>::Handle hModQuadric;
+  _decimater.add(hModQuadric);
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+bool StreamDecimaterT<Mesh>::decimate(const std::string& _filename,
+    float _ratio, Mesh& _mesh) {
+  nodes_.clear();
+  n_blocks_ = 0;
+  n_complex_ = 0;
+  _mesh.clear();
+
+  // read the file into temporary storage
+  StreamVertexStore vertices(vertex_cache_);
+  StreamListStore lists;
+
+  if (!vertices.is_open() || !lists.is_open())
+    return false;
+
+  size_t input = lists.add_list();
+  StreamImporter importer(vertices, lists, input);
+  IO::Options options;
+
+  // unindexed triangles (STL) are welded in hash buckets of about
+  // vertex_cache() corners, a corner takes at least 16 bytes of the file
+  std::ifstream file(_filename.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+  size_t file_size = (file ? size_t(file.tellg()) : 0);
+  file.close();
+
+  importer.set_welding(file_size / 16 / std::max(vertex_cache_, size_t(1)) + 1,
+                       vertex_cache_);
+
+  if (!IO::IOManager().read(_filename, importer, options) || !importer.weld()) {
+    omerr() << "StreamDecimaterT: cannot read " << _filename << std::endl;
+    return false;
+  }
+
+  if (importer.n_triangles() == 0)
+    return true;
+
+  // histogram of the vertex positions
+  bb_min_ = importer.bb_min();
+  Vec3f extent = importer.bb_max() - bb_min_;
+  for (int k = 0; k < 3; ++k)
+    inv_cell_[k] = (extent[k] > 0.0f ? float(GridSize) / extent[k] : 0.0f);
+
+  std::vector<unsigned int> histogram(GridSize * GridSize * GridSize, 0);
+  int c[3];
+
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    cell(vertices.get(i).point, c);
+    ++histogram[(c[2] * GridSize + c[1]) * GridSize + c[0]];
+  }
+
+  // split into blocks
+  int lo[3] = { 0, 0, 0 };
+  int hi[3] = { GridSize, GridSize, GridSize };
+  build_tree(lo, hi, histogram);
+  std::vector<unsigned int>().swap(histogram);
+
+  for (size_t i = 0; i < nodes_.size(); ++i)
+    if (nodes_[i].child[0] < 0)
+      nodes_[i].input = lists.add_list();
+
+  // distribute the triangles, record the range of blocks per vertex
+  std::vector<unsigned int> triangles;
+
+  for (size_t chunk = 0; chunk < lists.n_chunks(input); ++chunk) {
+    if (!lists.read_chunk(input, chunk, triangles))
+      return false;
+
+    for (size_t t = 0; t + 2 < triangles.size(); t += 3) {
+      const unsigned int* tri = &triangles[t];
+
+      Vec3f centroid = vertices.get(tri[0]).point;
+      centroid += vertices.get(tri[1]).point;
+      centroid += vertices.get(tri[2]).point;
+      centroid /= 3.0f;
+
+      Node& node = nodes_[leaf(centroid)];
+
+      for (int j = 0; j < 3; ++j) {
+        StreamVertexStore::Record& record = vertices.modify(tri[j]);
+        record.lo = std::min(record.lo, node.leaf_lo);
+        record.hi = std::max(record.hi, node.leaf_lo);
+      }
+
+      lists.append(node.input, tri, 3);
+      ++node.n_faces;
+    }
+  }
+  lists.release(input);
+
+  // decimate and merge the blocks
+  vertex_store_ = &vertices;
+  list_store_ = &lists;
+
+  bool ok = process(0, _ratio, _mesh);
+
+  vertex_store_ = NULL;
+  list_store_ = NULL;
+
+  if (n_complex_)
+    omlog() << "StreamDecimaterT: skipped " << n_complex_ << " complex faces\n";
+
+  return ok;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+int StreamDecimaterT<Mesh>::build_tree(const int _lo[3], const int _hi[3],
+    const std::vector<unsigned int>& _histogram) {
+  size_t count = 0;
+  int x, y, z;
+
+  for (z = _lo[2]; z < _hi[2]; ++z)
+    for (y = _lo[1]; y < _hi[1]; ++y)
+      for (x = _lo[0]; x < _hi[0]; ++x)
+        count += _histogram[(z * GridSize + y) * GridSize + x];
+
+  Node node;
+  node.axis = -1;
+  node.split = 0;
+  node.child[0] = node.child[1] = -1;
+  node.leaf_lo = node.leaf_hi = 0;
+  node.n_faces = node.input = node.vertices = node.faces = 0;
+
+  int idx = int(nodes_.size());
+  nodes_.push_back(node);
+
+  // longest side which can be split
+  int axis = -1;
+  float longest = 0.0f;
+
+  for (int k = 0; k < 3; ++k) {
+    if (_hi[k] - _lo[k] > 1 && inv_cell_[k] > 0.0f) {
+      float length = float(_hi[k] - _lo[k]) / inv_cell_[k];
+      if (length > longest) {
+        longest = length;
+        axis = k;
+      }
+    }
+  }
+
+  // a closed triangle mesh has about twice as many faces as vertices
+  if (2 * count <= block_faces_ || axis < 0) {
+    nodes_[idx].leaf_lo = nodes_[idx].leaf_hi = (unsigned int) (n_blocks_++);
+    return idx;
+  }
+
+  // split at the median of the vertices
+  std::vector<size_t> marginal(_hi[axis] - _lo[axis], 0);
+  int p[3];
+
+  for (p[2] = _lo[2]; p[2] < _hi[2]; ++p[2])
+    for (p[1] = _lo[1]; p[1] < _hi[1]; ++p[1])
+      for (p[0] = _lo[0]; p[0] < _hi[0]; ++p[0])
+        marginal[p[axis] - _lo[axis]] +=
+            _histogram[(p[2] * GridSize + p[1]) * GridSize + p[0]];
+
+  size_t sum = 0;
+  int split = _lo[axis] + 1;
+
+  for (int i = _lo[axis]; i < _hi[axis] - 1; ++i) {
+    sum += marginal[i - _lo[axis]];
+    split = i + 1;
+    if (2 * sum >= count)
+      break;
+  }
+
+  int left_hi[3] = { _hi[0], _hi[1], _hi[2] };
+  int right_lo[3] = { _lo[0], _lo[1], _lo[2] };
+  left_hi[axis] = right_lo[axis] = split;
+
+  int left = build_tree(_lo, left_hi, _histogram);
+  int right = build_tree(right_lo, _hi, _histogram);
+
+  nodes_[idx].axis = axis;
+  nodes_[idx].split = split;
+  nodes_[idx].child[0] = left;
+  nodes_[idx].child[1] = right;
+  nodes_[idx].leaf_lo = nodes_[left].leaf_lo;
+  nodes_[idx].leaf_hi = nodes_[right].leaf_hi;
+
+  return idx;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+void StreamDecimaterT<Mesh>::cell(const Vec3f& _p, int _c[3]) const {
+  for (int k = 0; k < 3; ++k) {
+    int i = int((_p[k] - bb_min_[k]) * inv_cell_[k]);
+    _c[k] = std::max(0, std::min(i, int(GridSize) - 1));
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+int StreamDecimaterT<Mesh>::leaf(const Vec3f& _p) const {
+  int c[3];
+  cell(_p, c);
+
+  int n = 0;
+  while (nodes_[n].child[0] >= 0)
+    n = nodes_[n].child[c[nodes_[n].axis] < nodes_[n].split ? 0 : 1];
+
+  return n;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+bool StreamDecimaterT<Mesh>::process(int _node, float _ratio, Mesh& _result) {
+  Node& node = nodes_[_node];
+
+  std::vector<BlockVertex> vertices;
+  std::vector<unsigned int> faces;
+
+  if (node.child[0] < 0) {
+    // leaf: input triangles, vertices from the vertex file
+    if (!list_store_->read(node.input, faces))
+      return false;
+    list_store_->release(node.input);
+
+    std::vector<unsigned int> ids(faces);
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    vertices.resize(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+      const StreamVertexStore::Record& record = vertex_store_->get(ids[i]);
+      vertices[i].id = ids[i];
+      vertices[i].lo = record.lo;
+      vertices[i].hi = record.hi;
+      vertices[i].point = record.point;
+    }
+
+    for (size_t i = 0; i < faces.size(); ++i)
+      faces[i] = unsigned(std::lower_bound(ids.begin(), ids.end(), faces[i]) - ids.begin());
+  } else {
+    // inner node: merge the decimated children
+    std::vector<BlockVertex> child_vertices;
+    std::vector<unsigned int> child_faces;
+
+    node.n_faces = 0;
+
+    for (int c = 0; c < 2; ++c) {
+      if (!process(node.child[c], _ratio, _result))
+        return false;
+
+      Node& child = nodes_[node.child[c]];
+
+      if (!list_store_->read(child.vertices, child_vertices)
+          || !list_store_->read(child.faces, child_faces))
+        return false;
+      list_store_->release(child.vertices);
+      list_store_->release(child.faces);
+
+      unsigned int offset = unsigned(vertices.size());
+      vertices.insert(vertices.end(), child_vertices.begin(), child_vertices.end());
+      for (size_t i = 0; i < child_faces.size(); ++i)
+        faces.push_back(child_faces[i] + offset);
+
+      node.n_faces += child.n_faces;
+    }
+  }
+
+  // the root block is decimated in the result mesh
+  Mesh block;
+  Mesh& mesh = (_node == 0 ? _result : block);
+
+  VPropHandleT<BlockVertex> block_vertex;
+  mesh.add_property(block_vertex);
+
+  add_block(mesh, block_vertex, vertices, faces);
+  std::vector<BlockVertex>().swap(vertices);
+  std::vector<unsigned int>().swap(faces);
+
+  bool ok = simplify(mesh, block_vertex, node, _ratio);
+
+  if (_node != 0)
+    store(node, mesh, block_vertex);
+
+  mesh.remove_property(block_vertex);
+
+  return ok;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+void StreamDecimaterT<Mesh>::add_block(Mesh& _mesh,
+    VPropHandleT<BlockVertex> _block_vertex,
+    const std::vector<BlockVertex>& _vertices,
+    const std::vector<unsigned int>& _faces) {
+  // seam vertices are contained in both children of a merge
+  std::vector<BlockVertex> unique(_vertices);
+  std::sort(unique.begin(), unique.end(), IdLess());
+
+  size_t n = 0;
+  for (size_t i = 0; i < unique.size(); ++i)
+    if (n == 0 || unique[i].id != unique[n - 1].id)
+      unique[n++] = unique[i];
+  unique.resize(n);
+
+  _mesh.reserve(unique.size(), 3 * _faces.size() / 2, _faces.size() / 3);
+
+  std::vector<typename Mesh::VertexHandle> vhandles(_vertices.size());
+
+  for (size_t i = 0; i < unique.size(); ++i) {
+    typename Mesh::VertexHandle vh =
+        _mesh.add_vertex(vector_cast<typename Mesh::Point>(unique[i].point));
+    _mesh.property(_block_vertex, vh) = unique[i];
+  }
+
+  for (size_t i = 0; i < _vertices.size(); ++i)
+    vhandles[i] = typename Mesh::VertexHandle(int(std::lower_bound(unique.begin(),
+        unique.end(), _vertices[i], IdLess()) - unique.begin()));
+
+  for (size_t i = 0; i + 2 < _faces.size(); i += 3) {
+    typename Mesh::FaceHandle fh = _mesh.add_face(vhandles[_faces[i]],
+        vhandles[_faces[i + 1]], vhandles[_faces[i + 2]]);
+    if (!fh.is_valid())
+      ++n_complex_;
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+bool StreamDecimaterT<Mesh>::simplify(Mesh& _mesh,
+    VPropHandleT<BlockVertex> _block_vertex, const Node& _node, float _ratio) {
+  _mesh.request_vertex_status();
+  _mesh.request_edge_status();
+  _mesh.request_face_status();
+
+  // Lock the vertices used by faces outside of the block. Their neighbors
+  // are locked as well: a collapse could otherwise connect two seam
+  // vertices, and an edge created on both sides of the seam would be
+  // non-manifold after the merge.
+  typename Mesh::VertexIter v_it, v_end(_mesh.vertices_end());
+  for (v_it = _mesh.vertices_begin(); v_it != v_end; ++v_it)
+    _mesh.status(v_it).set_locked(false);
+
+  for (v_it = _mesh.vertices_begin(); v_it != v_end; ++v_it) {
+    const BlockVertex& bv = _mesh.property(_block_vertex, v_it);
+    if (bv.lo < _node.leaf_lo || bv.hi > _node.leaf_hi) {
+      _mesh.status(v_it).set_locked(true);
+      for (typename Mesh::VertexVertexIter vv_it = _mesh.vv_iter(v_it); vv_it; ++vv_it)
+        _mesh.status(vv_it).set_locked(true);
+    }
+  }
+
+  bool ok;
+  {
+    Decimater decimater(_mesh);
+    setup(decimater);
+
+    ok = decimater.initialize();
+    if (ok) {
+      _mesh.update_face_normals();
+      decimater.decimate_to_faces(0, size_t(double(_ratio) * _node.n_faces + 0.5));
+    } else
+      omerr() << "StreamDecimaterT: cannot initialize decimater\n";
+  }
+
+  _mesh.garbage_collection();
+
+  _mesh.release_vertex_status();
+  _mesh.release_edge_status();
+  _mesh.release_face_status();
+
+  return ok;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+void StreamDecimaterT<Mesh>::store(Node& _node, Mesh& _mesh,
+    VPropHandleT<BlockVertex> _block_vertex) {
+  _node.vertices = list_store_->add_list();
+  _node.faces = list_store_->add_list();
+
+  typename Mesh::VertexIter v_it, v_end(_mesh.vertices_end());
+  for (v_it = _mesh.vertices_begin(); v_it != v_end; ++v_it) {
+    BlockVertex bv = _mesh.property(_block_vertex, v_it);
+    bv.point = vector_cast<Vec3f>(_mesh.point(v_it));
+    list_store_->append(_node.vertices, bv);
+  }
+
+  typename Mesh::FaceIter f_it, f_end(_mesh.faces_end());
+  for (f_it = _mesh.faces_begin(); f_it != f_end; ++f_it) {
+    typename Mesh::FaceVertexIter fv_it = _mesh.fv_iter(f_it);
+    for (; fv_it; ++fv_it)
+      list_store_->append(_node.faces, (unsigned int) fv_it.handle().idx());
+  }
+}
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
+
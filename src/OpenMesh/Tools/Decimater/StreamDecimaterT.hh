@@ -0,0 +1,228 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+/** \file StreamDecimaterT.hh
+ */
+
+//=============================================================================
+//
+//  CLASS StreamDecimaterT
+//
+//=============================================================================
+
+#ifndef OPENMESH_DECIMATER_STREAMDECIMATERT_HH
+#define OPENMESH_DECIMATER_STREAMDECIMATERT_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/Utils/Property.hh>
+#include <OpenMesh/Tools/Decimater/DecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/StreamStore.hh>
+#include <string>
+#include <vector>
+
+
+//== NAMESPACE ================================================================
+
+namespace OpenMesh  {
+namespace Decimater {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Out-of-core decimation of meshes which do not fit into main memory.
+
+    decimate() simplifies a mesh file in blocks of bounded size:
+
+    -# The file is read once through a StreamImporter, hence every format
+       with a reader module working on a BaseImporter (OFF, PLY, STL, OBJ)
+       can be used. Vertex positions and triangles are written to
+       temporary files. The corners of STL triangles are merged into
+       vertices through temporary hash buckets as well, see
+       StreamImporter.
+    -# A kd-tree is built from a histogram of the vertex positions. It
+       splits the bounding box until a leaf holds about block_faces()
+       faces. Every triangle belongs to the leaf block containing its
+       centroid.
+    -# The leaf blocks are decimated one by one. Vertices used by faces of
+       other blocks are locked, so the blocks still fit together.
+    -# Sibling blocks are merged bottom-up. Vertices on their common seam
+       are unlocked and the merged block is decimated again, until the
+       root block is reached, which is returned in a mesh.
+
+    Each block is decimated to \c _ratio times the number of input faces
+    it covers. Only one block and the cache of the vertex file are held in
+    memory at a time; the final mesh has to fit into memory. The modules
+    are set up by setup() for every block and thus only see the geometry
+    of the block, e.g. ModQuadricT recomputes its quadrics from the
+    decimated blocks after each merge.
+*/
+template < typename MeshT >
+class StreamDecimaterT
+{
+public: //-------------------------------------------------------- public types
+
+  typedef MeshT                  Mesh;
+  typedef DecimaterT< MeshT >    Decimater;
+
+public: //------------------------------------------------------ public methods
+
+  /// Constructor
+  StreamDecimaterT();
+
+  /// Destructor
+  virtual ~StreamDecimaterT() {}
+
+
+  /// Set the number of input faces per leaf block (default 1M)
+  void set_block_faces( size_t _n ) { block_faces_ = std::max(_n, size_t(2)); }
+
+  /// Get the number of input faces per leaf block
+  size_t block_faces() const { return block_faces_; }
+
+
+  /// Set the number of vertices cached in memory (default 4M)
+  void set_vertex_cache( size_t _n ) { vertex_cache_ = _n; }
+
+  /// Get the number of vertices cached in memory
+  size_t vertex_cache() const { return vertex_cache_; }
+
+
+  /** Decimate the mesh in file \c _filename to \c _ratio times its number
+      of faces (0: as far as the modules allow). The result replaces the
+      contents of \c _mesh. Returns false if the file could not be read
+      or the decimater could not be initialized.
+   */
+  bool decimate( const std::string& _filename, float _ratio, Mesh& _mesh );
+
+
+  /// Number of leaf blocks of the last decimate() call
+  size_t n_blocks() const { return n_blocks_; }
+
+protected:
+
+  /// Add the modules to the decimater of a block, default: ModQuadricT
+  virtual void setup( Decimater& _decimater );
+
+private: //---------------------------------------------------- private types
+
+  /// Cells of the histogram per axis
+  enum { GridSize = 64 };
+
+  /// Node of the kd-tree, leaves are the blocks of the input faces
+  struct Node
+  {
+    int          axis, split;       // split plane (grid cells)
+    int          child[2];          // -1 for leaves
+    unsigned int leaf_lo, leaf_hi;  // range of leaves below the node
+    size_t       n_faces;           // number of input faces
+    size_t       input;             // triangles of a leaf (global indices)
+    size_t       vertices, faces;   // decimated block
+  };
+
+  /// Vertex of a block
+  struct BlockVertex
+  {
+    unsigned int id, lo, hi;
+    Vec3f        point;
+  };
+
+  /// Identification of block vertices by index
+  struct IdLess
+  {
+    bool operator()(const BlockVertex& _a, const BlockVertex& _b) const
+    { return _a.id < _b.id; }
+  };
+
+private: //--------------------------------------------------- private methods
+
+  int  build_tree( const int _lo[3], const int _hi[3],
+                   const std::vector<unsigned int>& _histogram );
+
+  void cell( const Vec3f& _p, int _c[3] ) const;
+
+  int  leaf( const Vec3f& _p ) const;
+
+  bool process( int _node, float _ratio, Mesh& _result );
+
+  void add_block( Mesh& _mesh, VPropHandleT<BlockVertex> _block_vertex,
+                  const std::vector<BlockVertex>& _vertices,
+                  const std::vector<unsigned int>& _faces );
+
+  bool simplify( Mesh& _mesh, VPropHandleT<BlockVertex> _block_vertex,
+                 const Node& _node, float _ratio );
+
+  void store( Node& _node, Mesh& _mesh,
+              VPropHandleT<BlockVertex> _block_vertex );
+
+private: //------------------------------------------------ private data
+
+  size_t              block_faces_;
+  size_t              vertex_cache_;
+  size_t              n_blocks_;
+
+  // state of decimate()
+  std::vector<Node>   nodes_;
+  Vec3f               bb_min_, inv_cell_;
+  StreamVertexStore*  vertex_store_;
+  StreamListStore*    list_store_;
+  size_t              n_complex_;
+
+private: // Noncopyable
+
+  StreamDecimaterT(const StreamDecimaterT&);
+  StreamDecimaterT& operator = (const StreamDecimaterT&);
+};
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_DECIMATER_STREAMDECIMATERT_CC)
+#define OPENMESH_DECIMATER_STREAMDECIMATERT_TEMPLATES
+#include "StreamDecimaterT.cc"
+#endif
+//=============================================================================
+#endif // OPENMESH_DECIMATER_STREAMDECIMATERT_HH defined
+//=============================================================================
+
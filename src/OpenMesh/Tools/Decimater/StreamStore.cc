@@ -0,0 +1,646 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+/** \file StreamStore.cc
+ */
+
+//=============================================================================
+//
+//  CLASS StreamVertexStore, StreamListStore, StreamImporter - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/omstream.hh>
+#include <OpenMesh/Tools/Decimater/StreamStore.hh>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh  {
+namespace Decimater {
+
+
+//== IMPLEMENTATION ==========================================================
+
+
+// seek to an absolute position, also beyond 2GB
+static bool seek(FILE* _file, size_t _offset)
+{
+#if defined(_MSC_VER)
+  return _fseeki64(_file, __int64(_offset), SEEK_SET) == 0;
+#else
+  return fseeko(_file, off_t(_offset), SEEK_SET) == 0;
+#endif
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+static FILE* open_temporary(const char* _name)
+{
+  FILE* file = std::tmpfile();
+  if (!file)
+    omerr() << _name << ": cannot create temporary file\n";
+  return file;
+}
+
+
+//== StreamVertexStore ========================================================
+
+
+StreamVertexStore::
+StreamVertexStore(size_t _cache_records, size_t _page_records)
+  : file_(open_temporary("StreamVertexStore")),
+    size_(0),
+    file_records_(0),
+    page_records_(std::max(_page_records, size_t(1)))
+{
+  size_t n_slots = std::max(_cache_records / page_records_, size_t(1));
+
+  cache_.resize(n_slots * page_records_);
+  pages_.assign(n_slots, size_t(-1));
+  dirty_.assign(n_slots, 0);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+StreamVertexStore::
+~StreamVertexStore()
+{
+  if (file_)
+    fclose(file_);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+StreamVertexStore::
+clear()
+{
+  size_         = 0;
+  file_records_ = 0;
+  std::fill(pages_.begin(), pages_.end(), size_t(-1));
+  std::fill(dirty_.begin(), dirty_.end(), 0);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+size_t
+StreamVertexStore::
+append(const Vec3f& _point)
+{
+  size_t  idx    = size_++;
+  Record& record = slot(idx, true);
+
+  record.point = _point;
+  record.lo    = UINT_MAX;
+  record.hi    = 0;
+
+  return idx;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+StreamVertexStore::Record&
+StreamVertexStore::
+slot(size_t _idx, bool _dirty)
+{
+  size_t page = _idx / page_records_;
+  size_t s    = page % pages_.size();
+
+  if (pages_[s] != page)
+  {
+    write_back(s);
+    load(s, page);
+  }
+
+  if (_dirty)
+    dirty_[s] = 1;
+
+  return cache_[s * page_records_ + _idx % page_records_];
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+StreamVertexStore::
+load(size_t _slot, size_t _page)
+{
+  size_t first = _page * page_records_;
+  size_t n     = (file_records_ > first ?
+                  std::min(page_records_, file_records_ - first) : 0);
+
+  pages_[_slot] = _page;
+  dirty_[_slot] = 0;
+
+  if (n && file_)
+  {
+    if (!seek(file_, first * sizeof(Record)) ||
+        fread(&cache_[_slot * page_records_], sizeof(Record), n, file_) != n)
+      omerr() << "StreamVertexStore: read error\n";
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+StreamVertexStore::
+write_back(size_t _slot)
+{
+  if (!dirty_[_slot] || pages_[_slot] == size_t(-1) || !file_)
+    return;
+
+  size_t first = pages_[_slot] * page_records_;
+  size_t n     = std::min(page_records_, size_ - first);
+
+  if (!seek(file_, first * sizeof(Record)) ||
+      fwrite(&cache_[_slot * page_records_], sizeof(Record), n, file_) != n)
+    omerr() << "StreamVertexStore: write error\n";
+
+  file_records_ = std::max(file_records_, first + n);
+  dirty_[_slot] = 0;
+}
+
+
+//== StreamListStore ==========================================================
+
+
+StreamListStore::
+StreamListStore(size_t _chunk_size)
+  : file_(open_temporary("StreamListStore")),
+    file_size_(0),
+    chunk_size_(std::max(_chunk_size, size_t(1)))
+{
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+StreamListStore::
+~StreamListStore()
+{
+  if (file_)
+    fclose(file_);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+size_t
+StreamListStore::
+add_list()
+{
+  lists_.push_back(List());
+  lists_.back().bytes = 0;
+  return lists_.size() - 1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+StreamListStore::
+append_bytes(size_t _list, const void* _data, size_t _bytes)
+{
+  List&       list = lists_[_list];
+  const char* data = static_cast<const char*>(_data);
+
+  if (list.buffer.size() + _bytes > chunk_size_)
+  {
+    if (!list.buffer.empty())
+    {
+      write_chunk(list, &list.buffer[0], list.buffer.size());
+      list.buffer.clear();
+    }
+
+    // large items bypass the buffer
+    if (_bytes >= chunk_size_)
+    {
+      write_chunk(list, data, _bytes);
+      list.bytes += _bytes;
+      return;
+    }
+  }
+
+  list.buffer.insert(list.buffer.end(), data, data + _bytes);
+  list.bytes += _bytes;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+StreamListStore::
+write_chunk(List& _list, const void* _data, size_t _bytes)
+{
+  if (!file_)
+    return;
+
+  if (!seek(file_, file_size_) || fwrite(_data, 1, _bytes, file_) != _bytes)
+    omerr() << "StreamListStore: write error\n";
+
+  Chunk chunk = { file_size_, _bytes };
+  _list.chunks.push_back(chunk);
+  file_size_ += _bytes;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool
+StreamListStore::
+read_bytes(size_t _list, void* _data)
+{
+  char* data = static_cast<char*>(_data);
+
+  for (size_t i = 0; i < n_chunks(_list); ++i)
+  {
+    if (!read_chunk_bytes(_list, i, data))
+      return false;
+    data += chunk_bytes(_list, i);
+  }
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+size_t
+StreamListStore::
+chunk_bytes(size_t _list, size_t _chunk) const
+{
+  const List& list = lists_[_list];
+
+  return (_chunk < list.chunks.size() ?
+          list.chunks[_chunk].bytes : list.buffer.size());
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool
+StreamListStore::
+read_chunk_bytes(size_t _list, size_t _chunk, void* _data)
+{
+  const List& list = lists_[_list];
+
+  if (_chunk == list.chunks.size())
+  {
+    if (!list.buffer.empty())
+      memcpy(_data, &list.buffer[0], list.buffer.size());
+    return true;
+  }
+
+  const Chunk& chunk = list.chunks[_chunk];
+
+  if (!file_ || !seek(file_, chunk.offset) ||
+      fread(_data, 1, chunk.bytes, file_) != chunk.bytes)
+  {
+    omerr() << "StreamListStore: read error\n";
+    return false;
+  }
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+StreamListStore::
+release(size_t _list)
+{
+  List& list = lists_[_list];
+
+  std::vector<Chunk>().swap(list.chunks);
+  std::vector<char>().swap(list.buffer);
+  list.bytes = 0;
+}
+
+
+//== StreamImporter ===========================================================
+
+
+StreamImporter::
+StreamImporter(StreamVertexStore& _vertices,
+               StreamListStore&   _triangles,
+               size_t             _list)
+  : vertices_(_vertices),
+    triangles_(_triangles),
+    list_(_list),
+    n_faces_(0),
+    n_triangles_(0),
+    bb_min_(0.0f, 0.0f, 0.0f),
+    bb_max_(0.0f, 0.0f, 0.0f),
+    weld_(false),
+    n_buckets_(0),
+    range_corners_(0),
+    n_corners_(0),
+    corner_faces_(0)
+{
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+// bucket of a corner, hash of the bits of its coordinates
+static size_t bucket(const Vec3f& _point, size_t _n_buckets)
+{
+  unsigned int h = 2166136261u, bits;
+
+  for (int k = 0; k < 3; ++k)
+  {
+    memcpy(&bits, &_point[k], sizeof(bits));
+    h = (h ^ bits) * 16777619u;
+  }
+
+  return h % _n_buckets;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+StreamImporter::
+set_welding(size_t _n_buckets, size_t _range_corners)
+{
+  n_buckets_     = _n_buckets;
+  range_corners_ = std::max(_range_corners / 3, size_t(1)) * 3;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool
+StreamImporter::
+weld_vertices()
+{
+  if (!n_buckets_ || vertices_.size() || n_corners_)
+    return false;
+
+  weld_ = true;
+
+  buckets_.resize(n_buckets_);
+  for (size_t b = 0; b < n_buckets_; ++b)
+    buckets_[b] = triangles_.add_list();
+
+  corner_faces_ = triangles_.add_list();
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+StreamImporter::
+update_bounding_box(const Vec3f& _point, bool _first)
+{
+  if (_first)
+    bb_min_ = bb_max_ = _point;
+  else
+  {
+    bb_min_.minimize(_point);
+    bb_max_.maximize(_point);
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+VertexHandle
+StreamImporter::
+add_vertex(const Vec3f& _point)
+{
+  if (weld_)
+  {
+    // -0 and 0 are the same position
+    Corner corner;
+    corner.point = Vec3f(_point[0] + 0.0f, _point[1] + 0.0f, _point[2] + 0.0f);
+    corner.idx   = unsigned(n_corners_);
+
+    update_bounding_box(corner.point, n_corners_ == 0);
+    triangles_.append(buckets_[bucket(corner.point, n_buckets_)], corner);
+
+    return VertexHandle(int(n_corners_++));
+  }
+
+  update_bounding_box(_point, vertices_.size() == 0);
+
+  return VertexHandle(int(vertices_.append(_point)));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+FaceHandle
+StreamImporter::
+add_face(const VHandles& _indices)
+{
+  if (weld_)
+  {
+    // an unindexed triangle uses the three corners added last
+    if (_indices.size() != 3 || n_corners_ % 3 != 0)
+      return FaceHandle();
+
+    for (size_t i = 0; i < 3; ++i)
+      if (size_t(_indices[i].idx()) != n_corners_ - 3 + i)
+        return FaceHandle();
+
+    triangles_.append(corner_faces_, unsigned(n_corners_ - 3));
+
+    return FaceHandle(int(n_faces_++));
+  }
+
+  const size_t n_vertices = vertices_.size();
+
+  for (size_t i = 0; i < _indices.size(); ++i)
+    if (!_indices[i].is_valid() || size_t(_indices[i].idx()) >= n_vertices)
+      return FaceHandle();
+
+  for (size_t i = 2; i < _indices.size(); ++i)
+  {
+    unsigned int t[3] = { unsigned(_indices[0].idx()),
+                          unsigned(_indices[i-1].idx()),
+                          unsigned(_indices[i].idx()) };
+
+    if (t[0] == t[1] || t[1] == t[2] || t[2] == t[0])
+      continue;
+
+    triangles_.append(list_, t, 3);
+    ++n_triangles_;
+  }
+
+  return FaceHandle(int(n_faces_++));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool
+StreamImporter::
+weld()
+{
+  if (!weld_)
+    return true;
+
+  weld_ = false;
+
+  // lists of (corner, vertex) pairs per range of corners
+  const size_t n_ranges = n_corners_ / range_corners_ + 1;
+  std::vector<size_t> ranges(n_ranges);
+
+  for (size_t r = 0; r < n_ranges; ++r)
+    ranges[r] = triangles_.add_list();
+
+
+  // merge the corners of each bucket, equal positions share a bucket
+  std::vector<Corner> corners;
+
+  for (size_t b = 0; b < buckets_.size(); ++b)
+  {
+    if (!triangles_.read(buckets_[b], corners))
+      return false;
+    triangles_.release(buckets_[b]);
+
+    std::sort(corners.begin(), corners.end(), CornerLess());
+
+    unsigned int pair[2] = { 0, 0 };
+
+    for (size_t i = 0; i < corners.size(); ++i)
+    {
+      if (i == 0 || corners[i].point != corners[i-1].point)
+        pair[1] = unsigned(vertices_.append(corners[i].point));
+
+      pair[0] = corners[i].idx;
+      triangles_.append(ranges[pair[0] / range_corners_], pair, 2);
+    }
+  }
+
+  std::vector<Corner>().swap(corners);
+  std::vector<size_t>().swap(buckets_);
+
+
+  // store the triangles, they are ordered by their corners
+  std::vector<unsigned int> ids(range_corners_), pairs, faces;
+  size_t range = size_t(-1), first = 0;
+
+  for (size_t chunk = 0; chunk < triangles_.n_chunks(corner_faces_); ++chunk)
+  {
+    if (!triangles_.read_chunk(corner_faces_, chunk, faces))
+      return false;
+
+    for (size_t f = 0; f < faces.size(); ++f)
+    {
+      if (faces[f] / range_corners_ != range)
+      {
+        range = faces[f] / range_corners_;
+        first = range * range_corners_;
+
+        if (!triangles_.read(ranges[range], pairs))
+          return false;
+        triangles_.release(ranges[range]);
+
+        for (size_t i = 0; i + 1 < pairs.size(); i += 2)
+          ids[pairs[i] - first] = pairs[i+1];
+      }
+
+      const unsigned int* t = &ids[faces[f] - first];
+
+      if (t[0] == t[1] || t[1] == t[2] || t[2] == t[0])
+        continue;
+
+      triangles_.append(list_, t, 3);
+      ++n_triangles_;
+    }
+  }
+
+  triangles_.release(corner_faces_);
+  for (size_t r = 0; r < n_ranges; ++r)
+    triangles_.release(ranges[r]);
+
+  n_corners_ = 0;
+
+  return true;
+}
+
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
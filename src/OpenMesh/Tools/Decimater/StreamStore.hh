@@ -0,0 +1,350 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+/** \file StreamStore.hh
+    Temporary file storage of the out-of-core decimater StreamDecimaterT.
+ */
+
+//=============================================================================
+//
+//  CLASS StreamVertexStore, StreamListStore, StreamImporter
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_DECIMATER_STREAMSTORE_HH
+#define OPENMESH_DECIMATER_STREAMSTORE_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Geometry/VectorT.hh>
+#include <OpenMesh/Core/IO/importer/BaseImporter.hh>
+#include <cstdio>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh  {
+namespace Decimater {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Vertex records of a streamed mesh, kept in a temporary file.
+
+    Records are appended in input order and accessed by index through a
+    direct mapped cache of pages. Modified pages are written back when
+    they are evicted, hence the memory used is bounded by the cache size
+    and independent of the number of vertices.
+ */
+class StreamVertexStore
+{
+public:
+
+  /// A vertex of the input mesh
+  struct Record
+  {
+    /// position
+    Vec3f        point;
+    /// smallest and largest index of the blocks using the vertex
+    unsigned int lo, hi;
+  };
+
+  /** Constructor. The cache holds \c _cache_records records in pages of
+      \c _page_records records. */
+  StreamVertexStore(size_t _cache_records = 1 << 22,
+                    size_t _page_records  = 1 << 12);
+
+  ~StreamVertexStore();
+
+  /// Is the temporary file open?
+  bool is_open() const { return file_ != 0; }
+
+  /// Number of records
+  size_t size() const { return size_; }
+
+  /// Remove all records
+  void clear();
+
+  /// Append a record, returns its index
+  size_t append(const Vec3f& _point);
+
+  /// Read access to record \c _idx
+  const Record& get(size_t _idx) { return slot(_idx, false); }
+
+  /// Write access to record \c _idx
+  Record& modify(size_t _idx) { return slot(_idx, true); }
+
+private:
+
+  Record& slot(size_t _idx, bool _dirty);
+  void    load(size_t _slot, size_t _page);
+  void    write_back(size_t _slot);
+
+private:
+
+  FILE*               file_;
+  size_t              size_;
+  size_t              file_records_;
+  size_t              page_records_;
+  std::vector<Record> cache_;
+  std::vector<size_t> pages_;
+  std::vector<char>   dirty_;
+
+private: // Noncopyable
+
+  StreamVertexStore(const StreamVertexStore&);
+  StreamVertexStore& operator=(const StreamVertexStore&);
+};
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Lists of plain data items, kept in one temporary file.
+
+    Each list buffers one chunk in memory. Full chunks are appended to
+    the file, so many lists can be filled at the same time with bounded
+    memory. Space of released lists is not reused.
+ */
+class StreamListStore
+{
+public:
+
+  /// Constructor, \c _chunk_size is the buffer size per list in bytes.
+  StreamListStore(size_t _chunk_size = 1 << 14);
+
+  ~StreamListStore();
+
+  /// Is the temporary file open?
+  bool is_open() const { return file_ != 0; }
+
+  /// Add an empty list, returns its index
+  size_t add_list();
+
+  /// Size of list \c _list in bytes
+  size_t bytes(size_t _list) const { return lists_[_list].bytes; }
+
+  /// Append \c _n items to list \c _list
+  template <class T>
+  void append(size_t _list, const T* _items, size_t _n)
+  { append_bytes(_list, _items, _n * sizeof(T)); }
+
+  /// Append one item to list \c _list
+  template <class T>
+  void append(size_t _list, const T& _item)
+  { append_bytes(_list, &_item, sizeof(T)); }
+
+  /// Read list \c _list into \c _items
+  template <class T>
+  bool read(size_t _list, std::vector<T>& _items)
+  {
+    _items.resize(bytes(_list) / sizeof(T));
+    return _items.empty() || read_bytes(_list, &_items[0]);
+  }
+
+  /** Number of chunks of list \c _list. The last chunk is the memory
+      buffer. Chunks hold whole items if all items of the list have the
+      same type. */
+  size_t n_chunks(size_t _list) const { return lists_[_list].chunks.size() + 1; }
+
+  /// Read chunk \c _chunk of list \c _list into \c _items
+  template <class T>
+  bool read_chunk(size_t _list, size_t _chunk, std::vector<T>& _items)
+  {
+    _items.resize(chunk_bytes(_list, _chunk) / sizeof(T));
+    return _items.empty() || read_chunk_bytes(_list, _chunk, &_items[0]);
+  }
+
+  /// Free the buffer of list \c _list and empty it.
+  void release(size_t _list);
+
+private:
+
+  struct Chunk
+  {
+    size_t offset, bytes;
+  };
+
+  struct List
+  {
+    std::vector<Chunk> chunks;
+    std::vector<char>  buffer;
+    size_t             bytes;
+  };
+
+  void append_bytes(size_t _list, const void* _data, size_t _bytes);
+  bool read_bytes(size_t _list, void* _data);
+  size_t chunk_bytes(size_t _list, size_t _chunk) const;
+  bool read_chunk_bytes(size_t _list, size_t _chunk, void* _data);
+  void write_chunk(List& _list, const void* _data, size_t _bytes);
+
+private:
+
+  FILE*             file_;
+  size_t            file_size_;
+  size_t            chunk_size_;
+  std::vector<List> lists_;
+
+private: // Noncopyable
+
+  StreamListStore(const StreamListStore&);
+  StreamListStore& operator=(const StreamListStore&);
+};
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Importer writing a mesh to temporary storage instead of a mesh.
+
+    Vertex positions go to a StreamVertexStore. Faces are split into
+    triangle fans and appended as vertex index triples to list
+    \c _list of a StreamListStore. Degenerate triangles and triangles
+    with invalid indices are skipped. All other attributes are ignored.
+
+    Formats of unindexed triangles (STL) are welded out of core if
+    set_welding() was called: the reader adds every corner, the corners
+    are distributed to temporary hash buckets by position. weld() merges
+    the corners of each bucket in memory, writes the corner to vertex map
+    in ranges of corners and then the triangles range by range.
+ */
+class StreamImporter : public IO::BaseImporter
+{
+public:
+
+  StreamImporter(StreamVertexStore& _vertices,
+                 StreamListStore&   _triangles,
+                 size_t             _list);
+
+  /// Bounding box of the vertices read
+  const Vec3f& bb_min() const { return bb_min_; }
+  const Vec3f& bb_max() const { return bb_max_; }
+
+  /// Number of triangles stored
+  size_t n_triangles() const { return n_triangles_; }
+
+  /** Weld unindexed triangles with \c _n_buckets hash buckets, the
+      corner to vertex map is held for \c _range_corners corners at a
+      time. Call before reading. */
+  void set_welding(size_t _n_buckets, size_t _range_corners);
+
+  /** Merge the corners read at equal positions into vertices and store
+      the triangles. Call after reading, does nothing if the reader did
+      not add unindexed triangles. Returns false on read errors. */
+  bool weld();
+
+  virtual bool weld_vertices();
+
+  virtual VertexHandle add_vertex(const Vec3f& _point);
+  virtual FaceHandle add_face(const VHandles& _indices);
+
+  virtual void add_face_texcoords(FaceHandle, VertexHandle, const std::vector<Vec2f>&) {}
+  virtual void set_face_texindex(FaceHandle, int) {}
+  virtual void set_normal(VertexHandle, const Vec3f&) {}
+  virtual void set_color(VertexHandle, const Vec3uc&) {}
+  virtual void set_color(VertexHandle, const Vec4uc&) {}
+  virtual void set_texcoord(VertexHandle, const Vec2f&) {}
+  virtual void set_texcoord(HalfedgeHandle, const Vec2f&) {}
+  virtual void set_color(EdgeHandle, const Vec3uc&) {}
+  virtual void set_color(EdgeHandle, const Vec4uc&) {}
+  virtual void set_normal(FaceHandle, const Vec3f&) {}
+  virtual void set_color(FaceHandle, const Vec3uc&) {}
+  virtual void set_color(FaceHandle, const Vec4uc&) {}
+  virtual void add_texture_information(int, std::string) {}
+
+  virtual size_t n_vertices() const { return vertices_.size(); }
+  virtual size_t n_faces()    const { return n_faces_; }
+  virtual size_t n_edges()    const { return 0; }
+
+private:
+
+  /// Corner of an unindexed triangle
+  struct Corner
+  {
+    Vec3f        point;
+    unsigned int idx;
+  };
+
+  /// Order of the corners in a bucket, equal positions are adjacent
+  struct CornerLess
+  {
+    bool operator()(const Corner& _a, const Corner& _b) const
+    {
+      if (_a.point[0] != _b.point[0]) return _a.point[0] < _b.point[0];
+      if (_a.point[1] != _b.point[1]) return _a.point[1] < _b.point[1];
+      if (_a.point[2] != _b.point[2]) return _a.point[2] < _b.point[2];
+      return _a.idx < _b.idx;
+    }
+  };
+
+  void update_bounding_box(const Vec3f& _point, bool _first);
+
+private:
+
+  StreamVertexStore& vertices_;
+  StreamListStore&   triangles_;
+  size_t             list_;
+  size_t             n_faces_;
+  size_t             n_triangles_;
+  Vec3f              bb_min_, bb_max_;
+
+  // welding of unindexed triangles
+  bool                weld_;
+  size_t              n_buckets_, range_corners_, n_corners_;
+  std::vector<size_t> buckets_;
+  size_t              corner_faces_;
+};
+
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
+#endif // OPENMESH_DECIMATER_STREAMSTORE_HH defined
+//=============================================================================
+
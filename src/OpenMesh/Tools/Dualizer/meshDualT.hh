@@ -79,52 +79,204 @@ namespace Util {
 
 //== Function DEFINITION =========================================================
 
-/** \brief create a dual mesh
+/** Handle correspondences between a primal mesh and its dual, as
+    returned by MeshDual(). Entries of primal elements that have no dual
+    counterpart (deleted faces, boundary or deleted vertices, edges that
+    do not separate two dual faces) hold invalid handles.
+*/
+struct MeshDualMap
+{
+  /// dual vertex of each primal face
+  std::vector<VertexHandle> face_to_vertex;
+  /// dual face of each primal vertex
+  std::vector<FaceHandle>   vertex_to_face;
+  /// dual edge of each primal edge. Halfedge 0 of a dual edge runs from the
+  /// dual vertex of face_handle(halfedge 0) to the one of face_handle(halfedge 1).
+  std::vector<EdgeHandle>   edge_to_edge;
+};
+
+
+/// dual halfedge of primal halfedge \c _h, invalid if there is none
+inline HalfedgeHandle dual_halfedge(const std::vector<EdgeHandle>& _edge_to_edge,
+                                    HalfedgeHandle                 _h)
+{
+  const EdgeHandle eh = _edge_to_edge[_h.idx() >> 1];
+  return eh.is_valid() ? HalfedgeHandle((eh.idx() << 1) | (_h.idx() & 1))
+                       : HalfedgeHandle();
+}
+
+
+/** \brief create a dual mesh in place
 *
-* This function takes a mesh and computes the dual mesh of it. Each face of the original mesh is replaced by a vertex at the center of gravity of the vertices of the face.
-* Each vertex of the original mesh is replaced by a face containing the dual vertices of its primal adjacent faces.
+* Computes the dual of \c _primal into \c _dual (which is cleared first) and
+* fills \c _map with the handle correspondences.
+*
+* Contrary to adding the dual faces one by one, the dual connectivity is
+* assembled directly from the primal halfedge structure: dual elements are
+* numbered in one sequential pass, all adjacency of the dual halfedges,
+* vertices and faces as well as the dual vertex positions are then written
+* independently per element (in parallel if OpenMP is available). The
+* running time is linear in the size of the primal mesh.
+*
+* Dual vertices and faces are numbered like the primal faces and interior
+* vertices they stem from, and each dual face starts at the dual vertex of
+* the first face around its primal vertex, as the add_face() based
+* construction did. Unlike add_face(), non-manifold dual vertices (faces with
+* several boundary vertices separated by interior ones) are supported. The
+* primal mesh is not modified.
 */
 template <typename MeshTraits>
-PolyMesh_ArrayKernelT<MeshTraits>* MeshDual (PolyMesh_ArrayKernelT<MeshTraits> &primal)
+void MeshDual (const PolyMesh_ArrayKernelT<MeshTraits>& _primal,
+               PolyMesh_ArrayKernelT<MeshTraits>&       _dual,
+               MeshDualMap&                             _map)
 {
-  PolyMesh_ArrayKernelT<MeshTraits>* dual = new PolyMesh_ArrayKernelT<MeshTraits>();
+  typedef PolyMesh_ArrayKernelT<MeshTraits> Mesh;
+  typedef typename Mesh::Point              Point;
+
+  const int n_faces    = int(_primal.n_faces());
+  const int n_vertices = int(_primal.n_vertices());
+  const int n_edges    = int(_primal.n_edges());
+
+  _dual.clear();
+  _map.face_to_vertex.assign(n_faces,    VertexHandle());
+  _map.vertex_to_face.assign(n_vertices, FaceHandle());
+  _map.edge_to_edge.assign(n_edges,      EdgeHandle());
+
+  // number the dual elements (sequential, this defines the dual handles)
+  int nv(0), nf(0), ne(0);
+
+  for (int i=0; i<n_faces; ++i)
+  {
+    FaceHandle fh(i);
+    if (!_primal.has_face_status() || !_primal.status(fh).deleted())
+      _map.face_to_vertex[i] = VertexHandle(nv++);
+  }
+
+  for (int i=0; i<n_vertices; ++i)
+  {
+    VertexHandle vh(i);
+    if ((!_primal.has_vertex_status() || !_primal.status(vh).deleted()) &&
+        !_primal.is_boundary(vh))
+      _map.vertex_to_face[i] = FaceHandle(nf++);
+  }
+
+  // a dual edge exists iff the primal edge is part of a dual face
+  for (int i=0; i<n_edges; ++i)
+  {
+    HalfedgeHandle h0 = _primal.halfedge_handle(EdgeHandle(i), 0);
+    HalfedgeHandle h1 = _primal.halfedge_handle(EdgeHandle(i), 1);
+
+    if (_map.vertex_to_face[_primal.to_vertex_handle(h0).idx()].is_valid() ||
+        _map.vertex_to_face[_primal.to_vertex_handle(h1).idx()].is_valid())
+      _map.edge_to_edge[i] = EdgeHandle(ne++);
+  }
+
+  _dual.resize(nv, ne, nf);
 
-  //we will need to reference which vertex in the dual is attached to each face in the primal
-  //and which face of the dual is attached to each vertex in the primal.
+  const std::vector<EdgeHandle>& e2e = _map.edge_to_edge;
 
-  FPropHandleT< typename PolyMesh_ArrayKernelT<MeshTraits>::VertexHandle > primalToDual;
-  primal.add_property(primalToDual);
+  // dual vertices: position and outgoing halfedge (boundary one preferred)
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int i=0; i<n_faces; ++i)
+  {
+    const VertexHandle dvh = _map.face_to_vertex[i];
+    if (!dvh.is_valid())
+      continue;
+
+    Point          cog(0,0,0);
+    unsigned int   degree(0);
+    HalfedgeHandle outgoing;
+
+    const HalfedgeHandle h_begin = _primal.halfedge_handle(FaceHandle(i));
+    HalfedgeHandle       h       = h_begin;
+    do
+    {
+      cog += _primal.point(_primal.to_vertex_handle(h));
+      ++degree;
+
+      const HalfedgeHandle dh = dual_halfedge(e2e, h);
+      if (dh.is_valid() && (!outgoing.is_valid() ||
+          !_map.vertex_to_face[_primal.from_vertex_handle(h).idx()].is_valid()))
+        outgoing = dh;
+
+      h = _primal.next_halfedge_handle(h);
+    }
+    while (h != h_begin);
+
+    assert(degree!=0);
+    _dual.set_point(dvh, cog / degree);
+    _dual.set_halfedge_handle(dvh, outgoing);
+  }
 
-  //for each face in the primal mesh, add a vertex at the center of gravity of the face
-  for(typename PolyMesh_ArrayKernelT<MeshTraits>::ConstFaceIter fit=primal.faces_begin(); fit!=primal.faces_end(); ++fit)
+  // dual halfedges: d(h) runs from the dual vertex of face(h) to the one of
+  // face(opposite(h)) and belongs to the dual face of from_vertex(h). Its
+  // successor is the next dual halfedge of face(opposite(h)) after
+  // opposite(h), which is d(cw_rotated(h)) unless from_vertex(h) is on the
+  // boundary.
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int i=0; i<2*n_edges; ++i)
   {
-      typename PolyMesh_ArrayKernelT<MeshTraits>::Point centerPoint(0,0,0);
-      unsigned int degree= 0;
-      for(typename PolyMesh_ArrayKernelT<MeshTraits>::ConstFaceVertexIter vit=primal.cfv_iter(fit); vit; ++vit, ++degree)
-	  centerPoint += primal.point(vit.handle());
-      assert(degree!=0);
-      centerPoint /= degree;
-      primal.property(primalToDual, fit) = dual->add_vertex(centerPoint);
+    const HalfedgeHandle h(i);
+    const HalfedgeHandle dh = dual_halfedge(e2e, h);
+    if (!dh.is_valid())
+      continue;
+
+    const HalfedgeHandle oh = _primal.opposite_halfedge_handle(h);
+
+    _dual.set_vertex_handle(dh,
+      _map.face_to_vertex[_primal.face_handle(oh).idx()]);
+    _dual.set_face_handle(dh,
+      _map.vertex_to_face[_primal.from_vertex_handle(h).idx()]);
+
+    // terminates at the latest at opposite(h), which has a dual halfedge
+    HalfedgeHandle z = _primal.next_halfedge_handle(oh);
+    while (!dual_halfedge(e2e, z).is_valid())
+      z = _primal.next_halfedge_handle(z);
+
+    _dual.set_next_halfedge_handle(dh, dual_halfedge(e2e, z));
   }
 
-  //for each vertex in the primal, add a face in the dual
-  std::vector< typename PolyMesh_ArrayKernelT<MeshTraits>::VertexHandle >  face_vhandles;
-  for(typename PolyMesh_ArrayKernelT<MeshTraits>::ConstVertexIter vit=primal.vertices_begin(); vit!=primal.vertices_end(); ++vit)
+  // dual faces: start at the dual halfedge that add_face() would have used,
+  // i.e. the one entering the dual vertex of the first face around the vertex
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int i=0; i<n_vertices; ++i)
   {
-      if(!primal.is_boundary(vit.handle()))
-      {
-	  face_vhandles.clear();
-	  for(typename PolyMesh_ArrayKernelT<MeshTraits>::ConstVertexFaceIter fit=primal.cvf_iter(vit); fit; ++fit)
-	      face_vhandles.push_back(primal.property(primalToDual, fit));
-	  dual->add_face(face_vhandles);
-      }
+    const FaceHandle dfh = _map.vertex_to_face[i];
+    if (!dfh.is_valid())
+      continue;
+
+    const HalfedgeHandle h = _primal.halfedge_handle(VertexHandle(i));
+    _dual.set_halfedge_handle(dfh,
+      dual_halfedge(e2e, _primal.ccw_rotated_halfedge_handle(h)));
   }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+/** \brief create a dual mesh
+*
+* This function takes a mesh and computes the dual mesh of it. Each face of the original mesh is replaced by a vertex at the center of gravity of the vertices of the face.
+* Each vertex of the original mesh is replaced by a face containing the dual vertices of its primal adjacent faces.
+*/
+template <typename MeshTraits>
+PolyMesh_ArrayKernelT<MeshTraits>* MeshDual (const PolyMesh_ArrayKernelT<MeshTraits> &primal)
+{
+  PolyMesh_ArrayKernelT<MeshTraits>* dual = new PolyMesh_ArrayKernelT<MeshTraits>();
 
-  primal.remove_property(primalToDual);
+  MeshDualMap map;
+  MeshDual(primal, *dual, map);
 
   return dual;
+}
 
-};
 
 //=============================================================================
 } // namespace Util
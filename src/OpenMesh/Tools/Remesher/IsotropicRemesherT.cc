@@ -0,0 +1,571 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+/** \file IsotropicRemesherT.cc
+
+ */
+
+//=============================================================================
+//
+//  CLASS IsotropicRemesherT - IMPLEMENTATION
+//
+//=============================================================================
+
+#define OPENMESH_REMESHER_ISOTROPICREMESHERT_C
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Tools/Remesher/IsotropicRemesherT.hh>
+#include <algorithm>
+#include <cmath>
+
+#ifdef USE_OPENMP
+#  include <omp.h>
+#endif
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Remesher {
+
+
+//== IMPLEMENTATION ==========================================================
+
+
+template <class Mesh>
+IsotropicRemesherT<Mesh>::
+IsotropicRemesherT(Mesh& _mesh)
+  : mesh_(_mesh),
+    target_length_(0),
+    sqr_high_(0),
+    sqr_low_(0),
+    n_splits_(0),
+    n_collapses_(0),
+    n_flips_(0)
+{
+  // request properties
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+
+  // custom properties
+  mesh_.add_property(queued_);
+  mesh_.add_property(changed_);
+
+  typename Mesh::EdgeIter e_it, e_end(mesh_.edges_end());
+  for (e_it = mesh_.edges_begin(); e_it != e_end; ++e_it)
+    mesh_.property(queued_, e_it) = false;
+
+  typename Mesh::VertexIter v_it, v_end(mesh_.vertices_end());
+  for (v_it = mesh_.vertices_begin(); v_it != v_end; ++v_it)
+    mesh_.property(changed_, v_it) = false;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+IsotropicRemesherT<Mesh>::
+~IsotropicRemesherT()
+{
+  // free properties
+  mesh_.release_vertex_status();
+  mesh_.release_edge_status();
+  mesh_.release_face_status();
+
+  // free custom properties
+  mesh_.remove_property(queued_);
+  mesh_.remove_property(changed_);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+unsigned int
+IsotropicRemesherT<Mesh>::
+remesh(unsigned int _max_iterations)
+{
+  typename Mesh::EdgeIter e_it, e_end(mesh_.edges_end());
+  for (e_it = mesh_.edges_sbegin(); e_it != e_end; ++e_it)
+    push(e_it.handle());
+
+  return iterate(_max_iterations);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+unsigned int
+IsotropicRemesherT<Mesh>::
+remesh(const std::vector<VertexHandle>& _vertices, unsigned int _max_iterations)
+{
+  for (size_t i = 0; i < _vertices.size(); ++i)
+    if (!mesh_.status(_vertices[i]).deleted())
+      push_edges(_vertices[i]);
+
+  return iterate(_max_iterations);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+unsigned int
+IsotropicRemesherT<Mesh>::
+iterate(unsigned int _max_iterations)
+{
+  // default: mean edge length
+  if (target_length_ <= 0)
+  {
+    Scalar sum(0), count(0);
+    typename Mesh::EdgeIter e_it, e_end(mesh_.edges_end());
+    for (e_it = mesh_.edges_sbegin(); e_it != e_end; ++e_it)
+    {
+      sum   += sqrt(sqr_length(e_it.handle()));
+      count += Scalar(1);
+    }
+    if (count > 0)
+      target_length_ = sum / count;
+  }
+
+  // record the changed elements to update the normals locally
+  const bool tracking = mesh_.has_dirty_tracking();
+  if (!tracking)
+    mesh_.request_dirty_tracking();
+
+  sqr_high_ = Scalar(16.0 / 9.0)  * target_length_ * target_length_;
+  sqr_low_  = Scalar(16.0 / 25.0) * target_length_ * target_length_;
+
+  n_splits_ = n_collapses_ = n_flips_ = 0;
+
+  unsigned int iteration = 0;
+
+  while (!work_.empty() && iteration < _max_iterations)
+  {
+    ++iteration;
+
+    split_long_edges();
+    collapse_short_edges();
+    equalize_valences();
+    tangential_relaxation();
+
+    // next work-list: the edges around the changed vertices
+    for (size_t i = 0; i < work_.size(); ++i)
+      mesh_.property(queued_, work_[i]) = false;
+    work_.clear();
+
+    for (size_t i = 0; i < touched_.size(); ++i)
+    {
+      mesh_.property(changed_, touched_[i]) = false;
+      if (!mesh_.status(touched_[i]).deleted())
+        push_edges(touched_[i]);
+    }
+    touched_.clear();
+  }
+
+  for (size_t i = 0; i < work_.size(); ++i)
+    mesh_.property(queued_, work_[i]) = false;
+  work_.clear();
+
+  // DON'T do garbage collection here! It's up to the application.
+  if (mesh_.has_face_normals())
+    mesh_.update_dirty_normals();
+
+  if (!tracking)
+    mesh_.release_dirty_tracking();
+
+  return iteration;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+IsotropicRemesherT<Mesh>::
+split_long_edges()
+{
+  // edges created by splits are appended and split again if necessary
+  for (size_t i = 0; i < work_.size(); ++i)
+  {
+    EdgeHandle eh = work_[i];
+
+    if (mesh_.status(eh).deleted() || sqr_length(eh) <= sqr_high_)
+      continue;
+
+    HalfedgeHandle heh     = mesh_.halfedge_handle(eh, 0);
+    VertexHandle   v0      = mesh_.from_vertex_handle(heh);
+    VertexHandle   v1      = mesh_.to_vertex_handle(heh);
+    bool           feature = mesh_.status(eh).feature();
+
+    VertexHandle vh = mesh_.add_vertex((mesh_.point(v0) + mesh_.point(v1)) * Scalar(0.5));
+    mesh_.property(changed_, vh) = false;
+    mesh_.split(eh, vh);
+    ++n_splits_;
+
+    // the halves of a feature edge are feature edges
+    if (feature)
+    {
+      mesh_.status(vh).set_feature(true);
+      for (typename Mesh::VertexOHalfedgeIter voh_it = mesh_.voh_iter(vh); voh_it; ++voh_it)
+      {
+        VertexHandle to = mesh_.to_vertex_handle(voh_it);
+        if (to == v0 || to == v1)
+          mesh_.status(mesh_.edge_handle(voh_it.handle())).set_feature(true);
+      }
+    }
+
+    touch(vh);
+    push_edges(vh);
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+IsotropicRemesherT<Mesh>::
+collapse_short_edges()
+{
+  for (size_t i = 0; i < work_.size(); ++i)
+  {
+    EdgeHandle eh = work_[i];
+
+    if (mesh_.status(eh).deleted() || sqr_length(eh) >= sqr_low_)
+      continue;
+
+    for (int k = 0; k < 2; ++k)
+    {
+      HalfedgeHandle heh = mesh_.halfedge_handle(eh, k);
+      VertexHandle   v0  = mesh_.from_vertex_handle(heh);
+      VertexHandle   v1  = mesh_.to_vertex_handle(heh);
+
+      if (is_fixed(v0) || !mesh_.is_collapse_ok(heh))
+        continue;
+
+      // the remaining vertex moves to the midpoint if it is free
+      Point p = (is_fixed(v1) ? mesh_.point(v1) :
+                 (mesh_.point(v0) + mesh_.point(v1)) * Scalar(0.5));
+
+      // no long edges, no flipped faces
+      bool ok = true;
+      VertexHandle ends[2] = { v0, v1 };
+
+      for (int j = 0; j < 2 && ok; ++j)
+      {
+        typename Mesh::VertexVertexIter vv_it = mesh_.vv_iter(ends[j]);
+        for (; vv_it && ok; ++vv_it)
+          if (vv_it.handle() != v0 && vv_it.handle() != v1 &&
+              (p - mesh_.point(vv_it)).sqrnorm() > sqr_high_)
+            ok = false;
+
+        typename Mesh::VertexFaceIter vf_it = mesh_.vf_iter(ends[j]);
+        for (; vf_it && ok; ++vf_it)
+        {
+          Point q[3], r[3];
+          int   n = 0, moved = 0;
+
+          for (typename Mesh::FaceVertexIter fv_it = mesh_.fv_iter(vf_it); fv_it; ++fv_it, ++n)
+          {
+            q[n] = r[n] = mesh_.point(fv_it);
+            if (fv_it.handle() == v0 || fv_it.handle() == v1)
+            {
+              r[n] = p;
+              ++moved;
+            }
+          }
+
+          // the faces of the edge vanish
+          if (moved == 2)
+            continue;
+
+          if ((((q[1] - q[0]) % (q[2] - q[0])) | ((r[1] - r[0]) % (r[2] - r[0]))) <= 0)
+            ok = false;
+        }
+      }
+
+      if (!ok)
+        continue;
+
+      mesh_.collapse(heh);
+      mesh_.set_point(v1, p);
+      ++n_collapses_;
+
+      touch(v1);
+      push_edges(v1);
+      break;
+    }
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+IsotropicRemesherT<Mesh>::
+equalize_valences()
+{
+  for (size_t i = 0; i < work_.size(); ++i)
+  {
+    EdgeHandle eh = work_[i];
+
+    if (mesh_.status(eh).deleted() || mesh_.status(eh).feature() ||
+        mesh_.is_boundary(eh))
+      continue;
+
+    // faces (a, b, c) and (b, a, d) become (a, d, c) and (b, c, d)
+    HalfedgeHandle h0 = mesh_.halfedge_handle(eh, 0);
+    HalfedgeHandle h1 = mesh_.halfedge_handle(eh, 1);
+    VertexHandle   a  = mesh_.from_vertex_handle(h0);
+    VertexHandle   b  = mesh_.to_vertex_handle(h0);
+    VertexHandle   c  = mesh_.to_vertex_handle(mesh_.next_halfedge_handle(h0));
+    VertexHandle   d  = mesh_.to_vertex_handle(mesh_.next_halfedge_handle(h1));
+
+    int da = int(mesh_.valence(a)) - target_valence(a);
+    int db = int(mesh_.valence(b)) - target_valence(b);
+    int dc = int(mesh_.valence(c)) - target_valence(c);
+    int dd = int(mesh_.valence(d)) - target_valence(d);
+
+    int before = abs(da) + abs(db) + abs(dc) + abs(dd);
+    int after  = abs(da - 1) + abs(db - 1) + abs(dc + 1) + abs(dd + 1);
+
+    if (after >= before || !mesh_.is_flip_ok(eh))
+      continue;
+
+    // the new faces must not be folded
+    const Point& pa = mesh_.point(a);
+    const Point& pb = mesh_.point(b);
+    const Point& pc = mesh_.point(c);
+    const Point& pd = mesh_.point(d);
+
+    Point n = (pb - pa) % (pc - pa) + (pa - pb) % (pd - pb);
+
+    if ((((pd - pa) % (pc - pa)) | n) <= 0 || (((pc - pb) % (pd - pb)) | n) <= 0)
+      continue;
+
+    mesh_.flip(eh);
+    ++n_flips_;
+
+    touch(a);
+    touch(b);
+    touch(c);
+    touch(d);
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+IsotropicRemesherT<Mesh>::
+tangential_relaxation()
+{
+  // free vertices of the work-list
+  std::vector<int> vertices;
+  vertices.reserve(2 * work_.size());
+
+  for (size_t i = 0; i < work_.size(); ++i)
+  {
+    if (mesh_.status(work_[i]).deleted())
+      continue;
+
+    HalfedgeHandle heh = mesh_.halfedge_handle(work_[i], 0);
+    VertexHandle   v0  = mesh_.from_vertex_handle(heh);
+    VertexHandle   v1  = mesh_.to_vertex_handle(heh);
+
+    if (!is_fixed(v0))
+      vertices.push_back(v0.idx());
+    if (!is_fixed(v1))
+      vertices.push_back(v1.idx());
+  }
+
+  std::sort(vertices.begin(), vertices.end());
+  vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+
+  // move to the centroid of the neighbors in the tangent plane
+  const Mesh&        mesh    = mesh_;
+  const int          n       = int(vertices.size());
+  const Scalar       sqr_eps = Scalar(0.0025) * target_length_ * target_length_;
+  std::vector<Point> positions(n);
+  std::vector<char>  moved(n);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n; ++i)
+  {
+    VertexHandle vh(vertices[i]);
+    const Point& p = mesh.point(vh);
+
+    Point  centroid(0, 0, 0);
+    Scalar count(0);
+
+    for (typename Mesh::ConstVertexVertexIter vv_it = mesh.cvv_iter(vh); vv_it; ++vv_it)
+    {
+      centroid += mesh.point(vv_it);
+      count    += Scalar(1);
+    }
+
+    Point normal(0, 0, 0);
+
+    for (typename Mesh::ConstVertexFaceIter vf_it = mesh.cvf_iter(vh); vf_it; ++vf_it)
+    {
+      typename Mesh::ConstFaceVertexIter fv_it = mesh.cfv_iter(vf_it);
+      const Point& p0 = mesh.point(fv_it);  ++fv_it;
+      const Point& p1 = mesh.point(fv_it);  ++fv_it;
+      const Point& p2 = mesh.point(fv_it);
+      normal += (p1 - p0) % (p2 - p0);
+    }
+
+    Point d = (count > 0 ? centroid / count - p : Point(0, 0, 0));
+
+    Scalar length = normal.norm();
+    if (length > 0)
+    {
+      normal /= length;
+      d -= normal * (normal | d);
+    }
+
+    positions[i] = p + d;
+    moved[i]     = (d.sqrnorm() > sqr_eps);
+  }
+
+  for (int i = 0; i < n; ++i)
+  {
+    VertexHandle vh(vertices[i]);
+    mesh_.set_point(vh, positions[i]);
+    if (moved[i])
+      touch(vh);
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+IsotropicRemesherT<Mesh>::
+push(EdgeHandle _eh)
+{
+  if (!mesh_.property(queued_, _eh))
+  {
+    mesh_.property(queued_, _eh) = true;
+    work_.push_back(_eh);
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+IsotropicRemesherT<Mesh>::
+push_edges(VertexHandle _vh)
+{
+  for (typename Mesh::VertexEdgeIter ve_it = mesh_.ve_iter(_vh); ve_it; ++ve_it)
+    push(ve_it.handle());
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+IsotropicRemesherT<Mesh>::
+touch(VertexHandle _vh)
+{
+  if (!mesh_.property(changed_, _vh))
+  {
+    mesh_.property(changed_, _vh) = true;
+    touched_.push_back(_vh);
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+IsotropicRemesherT<Mesh>::
+is_fixed(VertexHandle _vh) const
+{
+  return (mesh_.is_boundary(_vh) ||
+          mesh_.status(_vh).locked() ||
+          mesh_.status(_vh).feature());
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename IsotropicRemesherT<Mesh>::Scalar
+IsotropicRemesherT<Mesh>::
+sqr_length(EdgeHandle _eh) const
+{
+  HalfedgeHandle heh = mesh_.halfedge_handle(_eh, 0);
+  return (mesh_.point(mesh_.to_vertex_handle(heh)) -
+          mesh_.point(mesh_.from_vertex_handle(heh))).sqrnorm();
+}
+
+
+//=============================================================================
+} // END_NS_REMESHER
+} // END_NS_OPENMESH
+//=============================================================================
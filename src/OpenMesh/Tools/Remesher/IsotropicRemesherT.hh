@@ -0,0 +1,188 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+/** \file IsotropicRemesherT.hh
+
+ */
+
+//=============================================================================
+//
+//  CLASS IsotropicRemesherT
+//
+//=============================================================================
+
+#ifndef OPENMESH_REMESHER_ISOTROPICREMESHERT_HH
+#define OPENMESH_REMESHER_ISOTROPICREMESHERT_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.hh>
+#include <OpenMesh/Core/Utils/Property.hh>
+#include <OpenMesh/Core/Utils/Noncopyable.hh>
+#include <vector>
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace Remesher {
+
+//== CLASS DEFINITION =========================================================
+
+/** Isotropic remeshing to a target edge length (Botsch and Kobbelt 2004,
+    "A remeshing approach to multiresolution modeling").
+
+    Each iteration
+    -# splits the edges longer than 4/3 of the target length at their
+       midpoint,
+    -# collapses the edges shorter than 4/5 of the target length, unless
+       an edge longer than 4/3 of the target length would be created,
+    -# flips edges which reduce the deviation of the valences from 6
+       (4 on the boundary),
+    -# moves the vertices to the centroid of their neighbors in the
+       tangent plane (in parallel, OpenMP).
+
+    The phases only visit a work-list of edges: the first iteration
+    starts with all edges (or the edges around the vertices given to
+    remesh()), edges created by splits are appended. The next iteration
+    only visits the edges around vertices changed by the previous one,
+    hence the iterations get cheaper as the mesh converges and a mesh
+    which is already at the target length is not swept again.
+
+    Boundary, feature and locked vertices are not moved or removed,
+    boundary and feature edges are not flipped. Removed elements are only
+    marked deleted, call Mesh::garbage_collection() before the remesher is
+    destroyed (it releases the status). The face and vertex normals of the
+    changed region are updated with Mesh::update_dirty_normals() if the
+    mesh has them.
+*/
+template <class Mesh>
+class IsotropicRemesherT : private Utils::Noncopyable
+{
+public:
+
+  typedef typename Mesh::Scalar        Scalar;
+  typedef typename Mesh::Point         Point;
+  typedef typename Mesh::VertexHandle  VertexHandle;
+  typedef typename Mesh::EdgeHandle    EdgeHandle;
+  typedef typename Mesh::HalfedgeHandle HalfedgeHandle;
+
+public:
+
+  /// Constructor
+  IsotropicRemesherT( Mesh& _mesh );
+
+  /// Destructor
+  ~IsotropicRemesherT();
+
+
+  /// Set the target edge length, the default is the mean edge length
+  void set_target_length( Scalar _length ) { target_length_ = _length; }
+
+  /// Get the target edge length
+  Scalar target_length() const { return target_length_; }
+
+
+  /** Remesh the whole mesh, stops when no vertex changed or after
+      \c _max_iterations iterations. Returns the number of iterations. */
+  unsigned int remesh( unsigned int _max_iterations = 10 );
+
+  /** Remesh the region around \c _vertices, e.g. after a local edit. The
+      region grows as far as the changes propagate. */
+  unsigned int remesh( const std::vector<VertexHandle>& _vertices,
+                       unsigned int _max_iterations = 10 );
+
+
+  //@{
+  /// Number of operations of the last remesh() call
+  size_t n_splits()    const { return n_splits_; }
+  size_t n_collapses() const { return n_collapses_; }
+  size_t n_flips()     const { return n_flips_; }
+  //@}
+
+private:
+
+  unsigned int iterate( unsigned int _max_iterations );
+
+  void split_long_edges();
+  void collapse_short_edges();
+  void equalize_valences();
+  void tangential_relaxation();
+
+  void push( EdgeHandle _eh );
+  void push_edges( VertexHandle _vh );
+  void touch( VertexHandle _vh );
+
+  bool is_fixed( VertexHandle _vh ) const;
+  int  target_valence( VertexHandle _vh ) const
+  { return mesh_.is_boundary(_vh) ? 4 : 6; }
+
+  Scalar sqr_length( EdgeHandle _eh ) const;
+
+private:
+
+  Mesh&  mesh_;
+  Scalar target_length_;
+  Scalar sqr_high_, sqr_low_;
+
+  // edges of the current iteration
+  std::vector<EdgeHandle>   work_;
+  EPropHandleT<bool>        queued_;
+
+  // vertices changed in the current iteration
+  std::vector<VertexHandle> touched_;
+  VPropHandleT<bool>        changed_;
+
+  size_t n_splits_, n_collapses_, n_flips_;
+};
+
+//=============================================================================
+} // END_NS_REMESHER
+} // END_NS_OPENMESH
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_REMESHER_ISOTROPICREMESHERT_C)
+#define OPENMESH_REMESHER_ISOTROPICREMESHERT_TEMPLATES
+#include "IsotropicRemesherT.cc"
+#endif
+//=============================================================================
+#endif // OPENMESH_REMESHER_ISOTROPICREMESHERT_HH defined
+//=============================================================================
+
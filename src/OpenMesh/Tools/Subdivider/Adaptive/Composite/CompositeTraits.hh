@@ -55,7 +55,7 @@
 
 //== INCLUDES =================================================================
 
-#include <map>
+#include <OpenMesh/Tools/Subdivider/Adaptive/Composite/PositionHistoryT.hh>
 #include <OpenMesh/Core/Mesh/Traits.hh>
 
 //== NAMESPACE ================================================================
@@ -109,12 +109,12 @@ struct CompositeTraits : public OpenMesh::DefaultTraits
     
     typedef typename Refs::Point Point;
     typedef typename Refs::HalfedgeHandle HalfedgeHandle;
-    typedef std::map<state_t, Point> PositionHistory;
+    typedef PositionHistoryT<Point> PositionHistory;
     
     State                state_;
     HalfedgeHandle       red_halfedge_;
     
-    PositionHistory      pos_map_;
+    PositionHistory      pos_hist_;
     
   public:
     
@@ -133,19 +133,8 @@ struct CompositeTraits : public OpenMesh::DefaultTraits
     void  set_red_halfedge(const HalfedgeHandle& _h) { red_halfedge_ = _h; }
     
     // position of face, depending on generation _i. 
-    void set_position(const int& _i, const Point& _p) { pos_map_[_i] = _p; }
-    const Point position(const int& _i) { 
-      if (pos_map_.find(_i) != pos_map_.end())
-	return pos_map_[_i];
-      else {
-	
-	if (_i <= 0) {
-	  return Point(0.0, 0.0, 0.0);
-	}
-        
-	return position(_i - 1);
-      }
-    }
+    void set_position(const int& _i, const Point& _p) { pos_hist_.set_position(_i, _p); }
+    const Point position(const int& _i) const { return pos_hist_.position(_i); }
   }; // end class FaceTraits
   
   
@@ -155,10 +144,10 @@ struct CompositeTraits : public OpenMesh::DefaultTraits
   private:
     
     typedef typename Refs::Point Point;
-    typedef std::map<state_t, Point> PositionHistory;
+    typedef PositionHistoryT<Point> PositionHistory;
     
     State           state_;
-    PositionHistory pos_map_;
+    PositionHistory pos_hist_;
     
   public: 
     
@@ -177,23 +166,9 @@ struct CompositeTraits : public OpenMesh::DefaultTraits
     void    set_not_final() { state_.final = false; }
     
     // position of edge, depending on generation _i. 
-    void set_position(const int& _i, const Point& _p) { pos_map_[_i] = _p; }
+    void set_position(const int& _i, const Point& _p) { pos_hist_.set_position(_i, _p); }
     
-    const Point position(const int& _i) {
-        
-      if (pos_map_.find(_i) != pos_map_.end()) 
-        return pos_map_[_i];
-      else 
-      {
-	if (_i <= 0) 
-	{
-	  const Point zero_point(0.0, 0.0, 0.0);
-	  return zero_point;
-	}
-        
-	return position(_i - 1);
-      }
-    }
+    const Point position(const int& _i) const { return pos_hist_.position(_i); }
   }; // end class EdgeTraits
 
 
@@ -203,10 +178,10 @@ struct CompositeTraits : public OpenMesh::DefaultTraits
   private:
 
     typedef typename Refs::Point Point;
-    typedef std::map<state_t, Point> PositionHistory;
+    typedef PositionHistoryT<Point> PositionHistory;
 
     State           state_;
-    PositionHistory pos_map_;
+    PositionHistory pos_hist_;
 
   public:
 
@@ -222,24 +197,8 @@ struct CompositeTraits : public OpenMesh::DefaultTraits
     void    set_not_final() { state_.final = false; }
 
     // position of vertex, depending on generation _i. (not for display)
-    void set_position(const int& _i, const Point& _p) { pos_map_[_i] = _p; }
-    const Point position(const int& _i) { 
-
-      if (pos_map_.find(_i) != pos_map_.end()) 
-
-	return pos_map_[_i];
-
-      else {
-
-	if (_i <= 0) {
-
-	  const Point zero_point(0.0, 0.0, 0.0);
-	  return zero_point;
-	}
-
-	return position(_i - 1);
-      }
-    }
+    void set_position(const int& _i, const Point& _p) { pos_hist_.set_position(_i, _p); }
+    const Point position(const int& _i) const { return pos_hist_.position(_i); }
   }; // end class VertexTraits
 }; // end class CompositeTraits
 
@@ -0,0 +1,165 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision: 362 $                                                         *
+ *   $Date: 2011-01-26 10:21:12 +0100 (Mi, 26 Jan 2011) $                   *
+ *                                                                           *
+\*===========================================================================*/
+
+/** \file Subdivider/Adaptive/Composite/PositionHistoryT.hh
+    Per-element position history used by the adaptive composite traits.
+ */
+
+//=============================================================================
+//
+//  CLASS PositionHistoryT
+//
+//=============================================================================
+
+#ifndef OPENMESH_SUBDIVIDER_ADAPTIVE_POSITIONHISTORYT_HH
+#define OPENMESH_SUBDIVIDER_ADAPTIVE_POSITIONHISTORYT_HH
+
+
+//== INCLUDES =================================================================
+
+#include <vector>
+#include <cassert>
+
+//== NAMESPACE ================================================================
+
+namespace OpenMesh   { // BEGIN_NS_OPENMESH
+namespace Subdivider { // BEGIN_NS_DECIMATER
+namespace Adaptive   { // BEGIN_NS_ADAPTIVE
+
+
+//== CLASS DEFINITION =========================================================
+
+/** Positions of a mesh entity, indexed by generation (rule state).
+
+    The history is stored in one flat array with a slot for every
+    generation between the first and the last one set. Slots of
+    generations that have not been set explicitly hold the position of the
+    closest earlier generation, hence position() is a single array
+    access. This replaces a std::map per entity, which needed one heap
+    node per generation and a chain of lookups for missing generations.
+
+    Semantics are those of the former map based implementation:
+    position(_i) returns the position of the largest generation <= _i that
+    has been set, or the zero point if there is none.
+ */
+template <typename Point>
+class PositionHistoryT
+{
+public:
+
+  PositionHistoryT() : first_(0) {}
+
+  /// Set the position of generation _i.
+  void set_position(const int& _i, const Point& _p)
+  {
+    assert(_i >= 0);
+    if (_i < 0)
+      return;
+
+    if (slots_.empty())
+    {
+      first_ = _i;
+      slots_.push_back(Slot(_p, true));
+    }
+    else if (_i < first_)
+    {
+      // prepend, generations up to the old first one inherit _p
+      slots_.insert(slots_.begin(), size_t(first_ - _i), Slot(_p, false));
+      slots_.front().set = true;
+      first_ = _i;
+    }
+    else if (size_t(_i - first_) >= slots_.size())
+    {
+      // append, forward fill the gap with the current last position
+      slots_.resize(size_t(_i - first_), Slot(slots_.back().point, false));
+      slots_.push_back(Slot(_p, true));
+    }
+    else
+    {
+      size_t i = size_t(_i - first_);
+      slots_[i] = Slot(_p, true);
+
+      // update the following slots that inherited the old value
+      for (++i; i<slots_.size() && !slots_[i].set; ++i)
+        slots_[i].point = _p;
+    }
+  }
+
+  /// Position of generation _i, falls back to earlier generations.
+  const Point position(const int& _i) const
+  {
+    if (_i < first_ || slots_.empty())
+      return zero();
+
+    const size_t i = size_t(_i - first_);
+    return i < slots_.size() ? slots_[i].point : slots_.back().point;
+  }
+
+  /// Number of slots stored (including forward filled ones).
+  size_t size() const { return slots_.size(); }
+
+  /// Release all stored generations.
+  void clear() { std::vector<Slot>().swap(slots_); first_ = 0; }
+
+private:
+
+  static Point zero() { return Point(0.0, 0.0, 0.0); }
+
+  struct Slot
+  {
+    Slot(const Point& _p, bool _set) : point(_p), set(_set) {}
+
+    Point point;
+    bool  set;   ///< set explicitly, not inherited from an earlier slot
+  };
+
+  std::vector<Slot> slots_;
+  int               first_; ///< generation of slots_[0]
+};
+
+
+//=============================================================================
+} // END_NS_ADAPTIVE
+} // END_NS_SUBDIVIDER
+} // END_NS_OPENMESH
+//=============================================================================
+#endif // OPENMESH_SUBDIVIDER_ADAPTIVE_POSITIONHISTORYT_HH defined
+//=============================================================================
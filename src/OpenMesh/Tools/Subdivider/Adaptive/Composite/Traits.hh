@@ -55,7 +55,7 @@
 
 //== INCLUDES =================================================================
 
-#include <map>
+#include <OpenMesh/Tools/Subdivider/Adaptive/Composite/PositionHistoryT.hh>
 #include <OpenMesh/Core/Mesh/Types/TriMesh_ArrayKernelT.hh>
 
 //== NAMESPACE ================================================================
@@ -102,12 +102,12 @@ struct Traits : public OpenMesh::DefaultTraits
 
     typedef typename Refs::Point Point;
     typedef typename Refs::HalfedgeHandle HalfedgeHandle;
-    typedef std::map<state_t, Point> PositionHistory;
+    typedef PositionHistoryT<Point> PositionHistory;
 
     State                state_;
     HalfedgeHandle       red_halfedge_;
 
-    PositionHistory      pos_map_;
+    PositionHistory      pos_hist_;
     
   public:
 
@@ -126,20 +126,8 @@ struct Traits : public OpenMesh::DefaultTraits
     void  set_red_halfedge(const HalfedgeHandle& _h) { red_halfedge_ = _h; }
 
     // position of face, depending on generation _i. 
-    void set_position(const int& _i, const Point& _p) { pos_map_[_i] = _p; }
-    const Point position(const int& _i) { 
-      if (pos_map_.find(_i) != pos_map_.end())
-	return pos_map_[_i];
-      else {
-	
-	if (_i <= 0) {
-	  const Point zero_point(0.0, 0.0, 0.0);
-	  return zero_point;
-	}
-
-	return position(_i - 1);
-      }
-    }
+    void set_position(const int& _i, const Point& _p) { pos_hist_.set_position(_i, _p); }
+    const Point position(const int& _i) const { return pos_hist_.position(_i); }
   }; // end class FaceTraits
 
 
@@ -149,10 +137,10 @@ struct Traits : public OpenMesh::DefaultTraits
   private:
 
     typedef typename Refs::Point Point;
-    typedef std::map<state_t, Point> PositionHistory;
+    typedef PositionHistoryT<Point> PositionHistory;
 
     State           state_;
-    PositionHistory pos_map_;
+    PositionHistory pos_hist_;
 
   public: 
 
@@ -171,24 +159,8 @@ struct Traits : public OpenMesh::DefaultTraits
     void    set_not_final() { state_.final = false; }
 
     // position of edge, depending on generation _i. 
-    void set_position(const int& _i, const Point& _p) { pos_map_[_i] = _p; }
-    const Point position(const int& _i) {
-
-      if (pos_map_.find(_i) != pos_map_.end()) 
-      {
-	return pos_map_[_i];
-      }
-      else 
-      {
-	if (_i <= 0) 
-	{
-	  const Point zero_point(0.0, 0.0, 0.0);
-	  return zero_point;
-	}
-
-	return position(_i - 1);
-      }
-    }
+    void set_position(const int& _i, const Point& _p) { pos_hist_.set_position(_i, _p); }
+    const Point position(const int& _i) const { return pos_hist_.position(_i); }
   }; // end class EdgeTraits
 
 
@@ -198,11 +170,11 @@ struct Traits : public OpenMesh::DefaultTraits
   private:
 
     typedef typename Refs::Point Point;
-    typedef std::map<state_t, Point> PositionHistory;
+    typedef PositionHistoryT<Point> PositionHistory;
 
     State   state_;
 
-    PositionHistory pos_map_;
+    PositionHistory pos_hist_;
 
   public:
 
@@ -218,24 +190,8 @@ struct Traits : public OpenMesh::DefaultTraits
     void    set_not_final() { state_.final = false; }
 
     // position of vertex, depending on generation _i. (not for display)
-    void set_position(const int& _i, const Point& _p) { pos_map_[_i] = _p; }
-    const Point position(const int& _i) { 
-
-      if (pos_map_.find(_i) != pos_map_.end()) 
-
-	return pos_map_[_i];
-
-      else {
-
-	if (_i <= 0) {
-
-	  const Point zero_point(0.0, 0.0, 0.0);
-	  return zero_point;
-	}
-
-	return position(_i - 1);
-      }
-    }
+    void set_position(const int& _i, const Point& _p) { pos_hist_.set_position(_i, _p); }
+    const Point position(const int& _i) const { return pos_hist_.position(_i); }
   }; // end class VertexTraits
 }; // end class Traits
 
@@ -94,7 +94,6 @@ void CompositeT<MeshType,RealType>::Tvv3()
   typename MeshType::VertexHandle vh;
   typename MeshType::FaceIter     f_it;
   typename MeshType::EdgeIter     e_it;
-  typename MeshType::VertexIter   v_it;
   typename MeshType::Point        zero_point(0.0, 0.0, 0.0);
   size_t                          n_edges, n_faces, n_vertices, j;
 
@@ -107,10 +106,11 @@ void CompositeT<MeshType,RealType>::Tvv3()
   mesh_.reserve(n_vertices + n_faces, n_edges + 3 * n_faces, 3 * n_faces);
 
   // set new positions for vertices
-  v_it = mesh_.vertices_begin();
-  for (j = 0; j < n_vertices; ++j) {
-    mesh_.data(v_it).set_position(mesh_.data(v_it).position() * 3.0);
-    ++v_it;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < int(n_vertices); ++i) {
+    mesh_.data(VertexHandle(i)).set_position(mesh_.data(VertexHandle(i)).position() * 3.0);
   }
 
   // Split each face
@@ -158,7 +158,6 @@ void CompositeT<MeshType,RealType>::Tvv4()
   typename MeshType::VertexHandle     vh;
   typename MeshType::FaceIter         f_it;
   typename MeshType::EdgeIter         e_it;
-  typename MeshType::VertexIter       v_it;
   typename MeshType::Point            zero_point(0.0, 0.0, 0.0);
   unsigned int                    n_edges, n_faces, n_vertices, j;
 
@@ -171,10 +170,11 @@ void CompositeT<MeshType,RealType>::Tvv4()
   mesh_.reserve(n_vertices + n_edges, 2 * n_edges + 3 * n_faces, 4 * n_faces);
 
   // set new positions for vertices
-  v_it = mesh_.vertices_begin();
-  for (j = 0; j < n_vertices; ++j) {
-    mesh_.data(v_it).set_position(mesh_.data(v_it).position() * 4.0);
-    ++v_it;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < int(n_vertices); ++i) {
+    mesh_.data(VertexHandle(i)).set_position(mesh_.data(VertexHandle(i)).position() * 4.0);
   }
 
   // Split each edge
@@ -286,23 +286,15 @@ void CompositeT<MeshType,RealType>::VF()
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                  valence;
-  typename MeshType::Point          cog,
-                                zero_point(0.0, 0.0, 0.0);
-  typename MeshType::FaceVertexIter fv_it;
-  typename MeshType::FaceIter       f_it;
-
-  for (f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it) {
-
-    valence = 0;
-    cog = zero_point;
+  const int n_faces = int(mesh_.n_faces());
 
-    for (fv_it = mesh_.fv_iter(f_it.handle()); fv_it; ++fv_it) {
-      cog += mesh_.data(fv_it).position();
-      ++valence;
-    }
-    cog /= valence;
-    mesh_.data(f_it).set_position(cog);
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_faces; ++i)
+  {
+    const FaceHandle fh(i);
+    mesh_.data(fh).set_position(vf_cog(fh));
   }
 }
 
@@ -312,19 +304,23 @@ void CompositeT<MeshType,RealType>::VFa(Coeff& _coeff)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                        valence[3], i;
-  typename MeshType::Point                cog,
-                                      zero_point(0.0, 0.0, 0.0);
-  typename MeshType::Scalar               alpha;
-  typename MeshType::FaceIter             f_it;
-  typename MeshType::HalfedgeHandle       heh;
-  typename MeshType::VertexHandle         vh[3];
-  typename MeshType::VertexOHalfedgeIter  voh_it;
-  typename MeshType::FaceVertexIter       fv_it;
-
-  for (f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it) {
+  const int n_faces = int(mesh_.n_faces());
 
-    heh = mesh_.halfedge_handle(f_it.handle());
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int j = 0; j < n_faces; ++j)
+  {
+    const FaceHandle                        fh(j);
+    unsigned int                            valence[3], i;
+    typename MeshType::Point                cog(0.0, 0.0, 0.0);
+    typename MeshType::Scalar               alpha;
+    typename MeshType::HalfedgeHandle       heh;
+    typename MeshType::VertexHandle         vh[3];
+    typename MeshType::VertexOHalfedgeIter  voh_it;
+    typename MeshType::FaceVertexIter       fv_it;
+
+    heh = mesh_.halfedge_handle(fh);
     for (i = 0; i <= 2; ++i) {
 
       valence[i] = 0;
@@ -350,9 +346,7 @@ void CompositeT<MeshType,RealType>::VFa(Coeff& _coeff)
 
     alpha = _coeff(valence[i]);
 
-    cog = zero_point;
-
-    for (fv_it = mesh_.fv_iter(f_it.handle()); fv_it; ++fv_it) {
+    for (fv_it = mesh_.fv_iter(fh); fv_it; ++fv_it) {
       if (fv_it.handle() == vh[i]) {
   cog += fv_it->position() * alpha;
       } else {
@@ -360,7 +354,7 @@ void CompositeT<MeshType,RealType>::VFa(Coeff& _coeff)
       }
     }
 
-    f_it->set_position(cog);
+    mesh_.data(fh).set_position(cog);
   }
 }
 
@@ -370,18 +364,22 @@ void CompositeT<MeshType,RealType>::VFa(scalar_t _alpha)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                        valence[3], i;
-  typename MeshType::Point                cog,
-                                      zero_point(0.0, 0.0, 0.0);
-  typename MeshType::FaceIter             f_it;
-  typename MeshType::HalfedgeHandle       heh;
-  typename MeshType::VertexHandle         vh[3];
-  typename MeshType::VertexOHalfedgeIter  voh_it;
-  typename MeshType::FaceVertexIter       fv_it;
+  const int n_faces = int(mesh_.n_faces());
 
-  for (f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it) {
-
-    heh = mesh_.halfedge_handle(f_it.handle());
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int j = 0; j < n_faces; ++j)
+  {
+    const FaceHandle                        fh(j);
+    unsigned int                            valence[3], i;
+    typename MeshType::Point                cog(0.0, 0.0, 0.0);
+    typename MeshType::HalfedgeHandle       heh;
+    typename MeshType::VertexHandle         vh[3];
+    typename MeshType::VertexOHalfedgeIter  voh_it;
+    typename MeshType::FaceVertexIter       fv_it;
+
+    heh = mesh_.halfedge_handle(fh);
     for (i = 0; i <= 2; ++i) {
 
       valence[i] = 0;
@@ -405,9 +403,7 @@ void CompositeT<MeshType,RealType>::VFa(scalar_t _alpha)
       else
   i = 2;
 
-    cog = zero_point;
-
-    for (fv_it = mesh_.fv_iter(f_it.handle()); fv_it; ++fv_it) {
+    for (fv_it = mesh_.fv_iter(fh); fv_it; ++fv_it) {
       if (fv_it.handle() == vh[i]) {
   cog += fv_it->position() * _alpha;
       } else {
@@ -415,7 +411,7 @@ void CompositeT<MeshType,RealType>::VFa(scalar_t _alpha)
       }
     }
 
-    f_it->set_position(cog);
+    mesh_.data(fh).set_position(cog);
   }
 }
 
@@ -425,35 +421,30 @@ void CompositeT<MeshType,RealType>::FF()
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int valence;
-  typename MeshType::Point              cog,
-                                    zero_point(0.0, 0.0, 0.0);
-  typename MeshType::FaceFaceIter       ff_it;
-  typename MeshType::FaceIter           f_it;
-  std::vector<typename MeshType::Point> point_vector;
+  const int n_faces = int(mesh_.n_faces());
 
-  point_vector.clear();
+  // new positions go to the back buffer, neighbors are still read
+  buffer_.resize(n_faces);
 
-  for (f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it)
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_faces; ++i)
   {
-    valence = 0;
-    cog = zero_point;
+    unsigned int                    valence(0);
+    typename MeshType::Point        cog(0.0, 0.0, 0.0);
+    typename MeshType::FaceFaceIter ff_it;
 
-    for (ff_it = mesh_.ff_iter(f_it.handle()); ff_it; ++ff_it)
+    for (ff_it = mesh_.ff_iter(FaceHandle(i)); ff_it; ++ff_it)
     {
       cog += mesh_.data(ff_it).position();
       ++valence;
     }
     cog /= valence;
-    point_vector.push_back(cog);
+    buffer_[i] = cog;
   }
 
-  for (f_it = mesh_.faces_end(); f_it != mesh_.faces_begin(); )
-  {
-    --f_it;
-    mesh_.data(f_it).set_position(point_vector.back());
-    point_vector.pop_back();
-  }
+  flush_face_buffer();
 }
 
 
@@ -462,20 +453,22 @@ void CompositeT<MeshType,RealType>::FFc(Coeff& _coeff)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                   valence;
-  typename MeshType::Point           cog,
-                                 zero_point(0.0, 0.0, 0.0);
-  typename MeshType::FaceFaceIter    ff_it;
-  typename MeshType::FaceIter        f_it;
-  typename MeshType::Scalar          c;
-  std::vector<typename MeshType::Point> point_vector;
+  const int n_faces = int(mesh_.n_faces());
 
-  for (f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it) {
+  buffer_.resize(n_faces);
 
-    valence = 0;
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_faces; ++i)
+  {
+    const FaceHandle                fh(i);
+    unsigned int                    valence(0);
+    typename MeshType::Point        cog(0.0, 0.0, 0.0);
+    typename MeshType::FaceFaceIter ff_it;
+    typename MeshType::Scalar       c;
 
-    for (ff_it = mesh_.ff_iter(f_it.handle()); ff_it; ++ff_it) {
+    for (ff_it = mesh_.ff_iter(fh); ff_it; ++ff_it) {
       cog += ff_it->position();
       ++valence;
     }
@@ -483,18 +476,12 @@ void CompositeT<MeshType,RealType>::FFc(Coeff& _coeff)
 
     c = _coeff(valence);
 
-    cog = cog * (1.0 - c) + f_it->position() * c;
-
-    point_vector.push_back(cog);
+    cog = cog * (1.0 - c) + mesh_.data(fh).position() * c;
 
+    buffer_[i] = cog;
   }
-  for (f_it = mesh_.faces_end(); f_it != mesh_.faces_begin(); ) {
 
-    --f_it;
-    f_it->set_position(point_vector.back());
-    point_vector.pop_back();
-
-  }
+  flush_face_buffer();
 }
 
 
@@ -503,34 +490,62 @@ void CompositeT<MeshType,RealType>::FFc(scalar_t _c)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                   valence;
-  typename MeshType::Point           cog,
-    zero_point(0.0, 0.0, 0.0);
-  typename MeshType::FaceFaceIter    ff_it;
-  typename MeshType::FaceIter        f_it;
-  std::vector<typename MeshType::Point> point_vector;
+  const int n_faces = int(mesh_.n_faces());
 
-  for (f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it) {
+  buffer_.resize(n_faces);
 
-    valence = 0;
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_faces; ++i)
+  {
+    const FaceHandle                fh(i);
+    unsigned int                    valence(0);
+    typename MeshType::Point        cog(0.0, 0.0, 0.0);
+    typename MeshType::FaceFaceIter ff_it;
 
-    for (ff_it = mesh_.ff_iter(f_it.handle()); ff_it; ++ff_it) {
+    for (ff_it = mesh_.ff_iter(fh); ff_it; ++ff_it) {
       cog += ff_it->position();
       ++valence;
     }
     cog /= valence;
 
-    cog = cog * (1.0 - _c) + f_it->position() * _c;
-
-    point_vector.push_back(cog);
+    cog = cog * (1.0 - _c) + mesh_.data(fh).position() * _c;
 
+    buffer_[i] = cog;
   }
-  for (f_it = mesh_.faces_end(); f_it != mesh_.faces_begin(); ) {
 
-    --f_it;
-    f_it->set_position(point_vector.back());
-    point_vector.pop_back();
+  flush_face_buffer();
+}
+
+
+template<typename MeshType, typename RealType>
+void CompositeT<MeshType,RealType>::VFF()
+{
+  assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
+
+  const int n_faces = int(mesh_.n_faces());
+
+  // The VF result of a face is only read by its neighbors, hence it is
+  // recomputed per neighbor instead of being stored by a pass of its own.
+  // The face positions are not read, so they are written directly.
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_faces; ++i)
+  {
+    const FaceHandle                fh(i);
+    unsigned int                    valence(0);
+    typename MeshType::Point        cog(0.0, 0.0, 0.0);
+    typename MeshType::FaceFaceIter ff_it;
+
+    for (ff_it = mesh_.ff_iter(fh); ff_it; ++ff_it)
+    {
+      cog += vf_cog(ff_it.handle());
+      ++valence;
+    }
+    cog /= valence;
+    mesh_.data(fh).set_position(cog);
   }
 }
 
@@ -540,23 +555,24 @@ void CompositeT<MeshType,RealType>::FV()
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                  valence;
-  typename MeshType::Point          cog,
-                                zero_point(0.0, 0.0, 0.0);
-  typename MeshType::VertexFaceIter vf_it;
-  typename MeshType::VertexIter     v_it;
-
-  for (v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
+  const int n_vertices = int(mesh_.n_vertices());
 
-    valence = 0;
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_vertices; ++i)
+  {
+    const VertexHandle                vh(i);
+    unsigned int                      valence(0);
+    typename MeshType::Point          cog(0.0, 0.0, 0.0);
+    typename MeshType::VertexFaceIter vf_it;
 
-    for (vf_it = mesh_.vf_iter(v_it.handle()); vf_it; ++vf_it) {
+    for (vf_it = mesh_.vf_iter(vh); vf_it; ++vf_it) {
       cog += vf_it->position();
       ++valence;
     }
     cog /= valence;
-    v_it->set_position(cog);
+    mesh_.data(vh).set_position(cog);
   }
 }
 
@@ -566,25 +582,26 @@ void CompositeT<MeshType,RealType>::FVc(Coeff& _coeff)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                        valence;
-  typename MeshType::Point                cog,
-                                      zero_point(0.0, 0.0, 0.0);
-  scalar_t               c;
-  typename MeshType::VertexOHalfedgeIter  voh_it;
-  typename MeshType::VertexIter           v_it;
-
-  for (v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
+  const int n_vertices = int(mesh_.n_vertices());
 
-    valence = 0;
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_vertices; ++i)
+  {
+    const VertexHandle                      vh(i);
+    unsigned int                            valence(0);
+    typename MeshType::Point                cog(0.0, 0.0, 0.0);
+    scalar_t                                c;
+    typename MeshType::VertexOHalfedgeIter  voh_it;
 
-    for (voh_it = mesh_.voh_iter(v_it.handle()); voh_it; ++voh_it) {
+    for (voh_it = mesh_.voh_iter(vh); voh_it; ++voh_it) {
       ++valence;
     }
 
     c = _coeff(valence);
 
-    for (voh_it = mesh_.voh_iter(v_it.handle()); voh_it; ++voh_it) {
+    for (voh_it = mesh_.voh_iter(vh); voh_it; ++voh_it) {
 
       if (mesh_.face_handle(voh_it.handle()).is_valid()) {
 
@@ -602,7 +619,7 @@ void CompositeT<MeshType,RealType>::FVc(Coeff& _coeff)
     if (valence > 0)
       cog /= valence;
 
-    mesh_.data(v_it).set_position(cog);
+    mesh_.data(vh).set_position(cog);
   }
 }
 
@@ -612,22 +629,23 @@ void CompositeT<MeshType,RealType>::FVc(scalar_t _c)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                       valence;
-  typename MeshType::Point               cog,
-                                     zero_point(0.0, 0.0, 0.0);
-  typename MeshType::VertexOHalfedgeIter voh_it;
-  typename MeshType::VertexIter          v_it;
+  const int n_vertices = int(mesh_.n_vertices());
 
-  for (v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
-
-    valence = 0;
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_vertices; ++i)
+  {
+    const VertexHandle                     vh(i);
+    unsigned int                           valence(0);
+    typename MeshType::Point               cog(0.0, 0.0, 0.0);
+    typename MeshType::VertexOHalfedgeIter voh_it;
 
-    for (voh_it = mesh_.voh_iter(v_it.handle()); voh_it; ++voh_it) {
+    for (voh_it = mesh_.voh_iter(vh); voh_it; ++voh_it) {
       ++valence;
     }
 
-    for (voh_it = mesh_.voh_iter(v_it.handle()); voh_it; ++voh_it) {
+    for (voh_it = mesh_.voh_iter(vh); voh_it; ++voh_it) {
 
       if (mesh_.face_handle(voh_it.handle()).is_valid()) {
 
@@ -645,7 +663,7 @@ void CompositeT<MeshType,RealType>::FVc(scalar_t _c)
     if (valence > 0)
       cog /= valence;
 
-    v_it->set_position(cog);
+    mesh_.data(vh).set_position(cog);
   }
 }
 
@@ -655,18 +673,19 @@ void CompositeT<MeshType,RealType>::VdE()
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  typename MeshType::EdgeIter             e_it;
-  typename MeshType::Point                cog,
-                                      zero_point(0.0, 0.0, 0.0);
-  typename MeshType::HalfedgeHandle       heh1, heh2;
-  unsigned int                        valence;
+  const int n_edges = int(mesh_.n_edges());
 
-  for (e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it) {
-
-    cog = zero_point;
-    valence = 2;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_edges; ++i)
+  {
+    const EdgeHandle                  eh(i);
+    typename MeshType::Point          cog(0.0, 0.0, 0.0);
+    typename MeshType::HalfedgeHandle heh1, heh2;
+    unsigned int                      valence(2);
 
-    heh1 = mesh_.halfedge_handle(e_it.handle(), 0);
+    heh1 = mesh_.halfedge_handle(eh, 0);
     heh2 = mesh_.opposite_halfedge_handle(heh1);
     cog += mesh_.data(mesh_.to_vertex_handle(heh1)).position();
     cog += mesh_.data(mesh_.to_vertex_handle(heh2)).position();
@@ -683,7 +702,7 @@ void CompositeT<MeshType,RealType>::VdE()
 
     cog /= valence;
 
-    mesh_.data(e_it).set_position(cog);
+    mesh_.data(eh).set_position(cog);
   }
 }
 
@@ -693,18 +712,20 @@ void CompositeT<MeshType,RealType>::VdEc(scalar_t _c)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  typename MeshType::EdgeIter           e_it;
-  typename MeshType::Point              cog,
-                                    zero_point(0.0, 0.0, 0.0);
-  typename MeshType::HalfedgeHandle     heh;
+  const int n_edges = int(mesh_.n_edges());
 
-  for (e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it) {
-
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int j = 0; j < n_edges; ++j)
+  {
+    const EdgeHandle                  eh(j);
+    typename MeshType::Point          cog(0.0, 0.0, 0.0);
+    typename MeshType::HalfedgeHandle heh;
 
     for (int i = 0; i <= 1; ++i) {
 
-      heh = mesh_.halfedge_handle(e_it.handle(), i);
+      heh = mesh_.halfedge_handle(eh, i);
       if (!mesh_.is_boundary(heh))
       {
         cog += mesh_.point(mesh_.to_vertex_handle(mesh_.next_halfedge_handle(heh))) * (0.5 - _c);
@@ -716,7 +737,7 @@ void CompositeT<MeshType,RealType>::VdEc(scalar_t _c)
       }
     }
 
-    mesh_.data(e_it).set_position(cog);
+    mesh_.data(eh).set_position(cog);
   }
 }
 
@@ -726,20 +747,22 @@ void CompositeT<MeshType,RealType>::VdEg(scalar_t _gamma)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  typename MeshType::EdgeIter             e_it;
-  typename MeshType::Point                cog,
-                                      zero_point(0.0, 0.0, 0.0);
-  typename MeshType::HalfedgeHandle       heh;
-  typename MeshType::VertexOHalfedgeIter  voh_it;
-  unsigned int                        valence[2], i;
-
-  for (e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it) {
+  const int n_edges = int(mesh_.n_edges());
 
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int j = 0; j < n_edges; ++j)
+  {
+    const EdgeHandle                        eh(j);
+    typename MeshType::Point                cog(0.0, 0.0, 0.0);
+    typename MeshType::HalfedgeHandle       heh;
+    typename MeshType::VertexOHalfedgeIter  voh_it;
+    unsigned int                            valence[2], i;
 
     for (i = 0; i <= 1; ++i)
     {
-      heh = mesh_.halfedge_handle(e_it.handle(), i);
+      heh = mesh_.halfedge_handle(eh, i);
       valence[i] = 0;
 
       // look for lowest valence vertex
@@ -754,7 +777,7 @@ void CompositeT<MeshType,RealType>::VdEg(scalar_t _gamma)
     else
       i = 1;
 
-    heh = mesh_.halfedge_handle(e_it.handle(), i);
+    heh = mesh_.halfedge_handle(eh, i);
 
     if (!mesh_.is_boundary(heh)) {
       cog += mesh_.point(mesh_.to_vertex_handle(mesh_.next_halfedge_handle(heh))) * (_gamma);
@@ -764,7 +787,7 @@ void CompositeT<MeshType,RealType>::VdEg(scalar_t _gamma)
     }
 
 
-    heh = mesh_.halfedge_handle(e_it.handle(), 1-i);
+    heh = mesh_.halfedge_handle(eh, 1-i);
 
     if (!mesh_.is_boundary(heh))
     {
@@ -776,7 +799,7 @@ void CompositeT<MeshType,RealType>::VdEg(scalar_t _gamma)
       cog += mesh_.data(mesh_.to_vertex_handle(heh)).position() * 2.0 * _gamma;
     }
 
-    mesh_.data(e_it).set_position(cog);
+    mesh_.data(eh).set_position(cog);
   }
 }
 
@@ -786,21 +809,23 @@ void CompositeT<MeshType,RealType>::VdEg(Coeff& _coeff)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  typename MeshType::EdgeIter             e_it;
-  typename MeshType::Point                cog,
-                                      zero_point(0.0, 0.0, 0.0);
-  typename MeshType::HalfedgeHandle       heh;
-  typename MeshType::VertexOHalfedgeIter  voh_it;
-  unsigned int                        valence[2], i;
-  scalar_t               gamma;
+  const int n_edges = int(mesh_.n_edges());
 
-  for (e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it) {
-
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int j = 0; j < n_edges; ++j)
+  {
+    const EdgeHandle                        eh(j);
+    typename MeshType::Point                cog(0.0, 0.0, 0.0);
+    typename MeshType::HalfedgeHandle       heh;
+    typename MeshType::VertexOHalfedgeIter  voh_it;
+    unsigned int                            valence[2], i;
+    scalar_t                                gamma;
 
     for (i = 0; i <= 1; ++i) {
 
-      heh = mesh_.halfedge_handle(e_it.handle(), i);
+      heh = mesh_.halfedge_handle(eh, i);
       valence[i] = 0;
 
       // look for lowest valence vertex
@@ -817,7 +842,7 @@ void CompositeT<MeshType,RealType>::VdEg(Coeff& _coeff)
 
     gamma = _coeff(valence[i]);
 
-    heh = mesh_.halfedge_handle(e_it.handle(), i);
+    heh = mesh_.halfedge_handle(eh, i);
 
     if (!mesh_.is_boundary(heh))
     {
@@ -830,7 +855,7 @@ void CompositeT<MeshType,RealType>::VdEg(Coeff& _coeff)
     }
 
 
-    heh = mesh_.halfedge_handle(e_it.handle(), 1-i);
+    heh = mesh_.halfedge_handle(eh, 1-i);
 
     if (!mesh_.is_boundary(heh)) {
       cog += mesh_.point(mesh_.to_vertex_handle(mesh_.next_halfedge_handle(heh))) * (gamma);
@@ -839,7 +864,7 @@ void CompositeT<MeshType,RealType>::VdEg(Coeff& _coeff)
       cog += mesh_.data(mesh_.to_vertex_handle(heh)).position() * 2.0 * gamma;
     }
 
-    mesh_.data(e_it).set_position(cog);
+    mesh_.data(eh).set_position(cog);
   }
 }
 
@@ -849,25 +874,26 @@ void CompositeT<MeshType,RealType>::EV()
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  typename MeshType::VertexIter       v_it;
-  typename MeshType::Point            cog,
-                                  zero_point(0.0, 0.0, 0.0);
-  unsigned int                    valence;
-  typename MeshType::VertexEdgeIter   ve_it;
+  const int n_vertices = int(mesh_.n_vertices());
 
-  for (v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_vertices; ++i)
   {
-    valence = 0;
-    cog = zero_point;
+    const VertexHandle                vh(i);
+    typename MeshType::Point          cog(0.0, 0.0, 0.0);
+    unsigned int                      valence(0);
+    typename MeshType::VertexEdgeIter ve_it;
 
-    for (ve_it = mesh_.ve_iter(v_it.handle()); ve_it; ++ve_it) {
+    for (ve_it = mesh_.ve_iter(vh); ve_it; ++ve_it) {
       cog += mesh_.data(ve_it).position();
       ++valence;
     }
 
     cog /= valence;
 
-    mesh_.data(v_it).set_position(cog);
+    mesh_.data(vh).set_position(cog);
   }
 }
 
@@ -877,33 +903,34 @@ void CompositeT<MeshType,RealType>::EVc(Coeff& _coeff)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  typename MeshType::VertexIter            v_it;
-  typename MeshType::Point                 cog,
-                                       zero_point(0.0, 0.0, 0.0);
-  unsigned int                         valence;
-  typename MeshType::VertexOHalfedgeIter   voh_it;
-  scalar_t                c;
+  const int n_vertices = int(mesh_.n_vertices());
 
-  for (v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_vertices; ++i)
   {
-    valence = 0;
-    cog = zero_point;
+    const VertexHandle                     vh(i);
+    typename MeshType::Point               cog(0.0, 0.0, 0.0);
+    unsigned int                           valence(0);
+    typename MeshType::VertexOHalfedgeIter voh_it;
+    scalar_t                               c;
 
-    for (voh_it = mesh_.voh_iter(v_it.handle()); voh_it; ++voh_it)
+    for (voh_it = mesh_.voh_iter(vh); voh_it; ++voh_it)
     {
       ++valence;
     }
 
     c = _coeff(valence);
 
-    for (voh_it = mesh_.voh_iter(v_it.handle()); voh_it; ++voh_it) {
+    for (voh_it = mesh_.voh_iter(vh); voh_it; ++voh_it) {
       cog += mesh_.data(mesh_.edge_handle(voh_it.handle())).position() * c;
       cog += mesh_.data(mesh_.edge_handle(mesh_.next_halfedge_handle(voh_it.handle()))).position() * (1.0 - c);
     }
 
     cog /= valence;
 
-    mesh_.data(v_it).set_position(cog);
+    mesh_.data(vh).set_position(cog);
   }
 }
 
@@ -912,28 +939,31 @@ template<typename MeshType, typename RealType>
 void CompositeT<MeshType,RealType>::EVc(scalar_t _c)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
-  typename MeshType::VertexIter           v_it;
-  typename MeshType::Point                cog,
-                                      zero_point(0.0, 0.0, 0.0);
-  unsigned int                        valence;
-  typename MeshType::VertexOHalfedgeIter  voh_it;
 
-  for (v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
-    valence = 0;
-    cog = zero_point;
+  const int n_vertices = int(mesh_.n_vertices());
 
-    for (voh_it = mesh_.voh_iter(v_it.handle()); voh_it; ++voh_it) {
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_vertices; ++i)
+  {
+    const VertexHandle                     vh(i);
+    typename MeshType::Point               cog(0.0, 0.0, 0.0);
+    unsigned int                           valence(0);
+    typename MeshType::VertexOHalfedgeIter voh_it;
+
+    for (voh_it = mesh_.voh_iter(vh); voh_it; ++voh_it) {
       ++valence;
     }
 
-    for (voh_it = mesh_.voh_iter(v_it.handle()); voh_it; ++voh_it) {
+    for (voh_it = mesh_.voh_iter(vh); voh_it; ++voh_it) {
       cog += mesh_.data(mesh_.edge_handle(voh_it.handle())).position() * _c;
       cog += mesh_.data(mesh_.edge_handle(mesh_.next_halfedge_handle(voh_it.handle()))).position() * (1.0 - _c);
     }
 
     cog /= valence;
 
-    mesh_.data(v_it).set_position(cog);
+    mesh_.data(vh).set_position(cog);
   }
 }
 
@@ -943,23 +973,25 @@ void CompositeT<MeshType,RealType>::EF()
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  typename MeshType::FaceIter         f_it;
-  typename MeshType::FaceEdgeIter     fe_it;
-  unsigned int                    valence;
-  typename MeshType::Point            cog,
-                                  zero_point(0.0, 0.0, 0.0);
+  const int n_faces = int(mesh_.n_faces());
 
-  for (f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it) {
-    valence = 0;
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_faces; ++i)
+  {
+    const FaceHandle                fh(i);
+    typename MeshType::FaceEdgeIter fe_it;
+    unsigned int                    valence(0);
+    typename MeshType::Point        cog(0.0, 0.0, 0.0);
 
-    for (fe_it = mesh_.fe_iter(f_it.handle()); fe_it; ++fe_it) {
+    for (fe_it = mesh_.fe_iter(fh); fe_it; ++fe_it) {
       ++valence;
       cog += mesh_.data(fe_it).position();
     }
 
     cog /= valence;
-    mesh_.data(f_it).set_position(cog);
+    mesh_.data(fh).set_position(cog);
   }
 }
 
@@ -969,27 +1001,29 @@ void CompositeT<MeshType,RealType>::FE()
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  typename MeshType::EdgeIter       e_it;
-  unsigned int                  valence;
-  typename MeshType::Point          cog,
-                                zero_point(0.0, 0.0, 0.0);
+  const int n_edges = int(mesh_.n_edges());
 
-  for (e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it) {
-    valence = 0;
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_edges; ++i)
+  {
+    const EdgeHandle         eh(i);
+    unsigned int             valence(0);
+    typename MeshType::Point cog(0.0, 0.0, 0.0);
 
-    if (mesh_.face_handle(mesh_.halfedge_handle(e_it.handle(), 0)).is_valid()) {
-      cog += mesh_.data(mesh_.face_handle(mesh_.halfedge_handle(e_it.handle(), 0))).position();
+    if (mesh_.face_handle(mesh_.halfedge_handle(eh, 0)).is_valid()) {
+      cog += mesh_.data(mesh_.face_handle(mesh_.halfedge_handle(eh, 0))).position();
       ++valence;
     }
 
-    if (mesh_.face_handle(mesh_.halfedge_handle(e_it.handle(), 1)).is_valid()) {
-      cog += mesh_.data(mesh_.face_handle(mesh_.halfedge_handle(e_it.handle(), 1))).position();
+    if (mesh_.face_handle(mesh_.halfedge_handle(eh, 1)).is_valid()) {
+      cog += mesh_.data(mesh_.face_handle(mesh_.halfedge_handle(eh, 1))).position();
       ++valence;
     }
 
     cog /= valence;
-    mesh_.data(e_it).set_position(cog);
+    mesh_.data(eh).set_position(cog);
   }
 }
 
@@ -999,15 +1033,20 @@ void CompositeT<MeshType,RealType>::VE()
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  typename MeshType::EdgeIter      e_it;
-  typename MeshType::Point         cog;
+  const int n_edges = int(mesh_.n_edges());
 
-  for (e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it)
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_edges; ++i)
   {
-    cog = mesh_.data(mesh_.to_vertex_handle(mesh_.halfedge_handle(e_it.handle(), 0))).position();
-    cog += mesh_.data(mesh_.to_vertex_handle(mesh_.halfedge_handle(e_it.handle(), 1))).position();
+    const EdgeHandle         eh(i);
+    typename MeshType::Point cog;
+
+    cog = mesh_.data(mesh_.to_vertex_handle(mesh_.halfedge_handle(eh, 0))).position();
+    cog += mesh_.data(mesh_.to_vertex_handle(mesh_.halfedge_handle(eh, 1))).position();
     cog /= 2.0;
-    mesh_.data(e_it).set_position(cog);
+    mesh_.data(eh).set_position(cog);
   }
 }
 
@@ -1017,34 +1056,28 @@ void CompositeT<MeshType,RealType>::VV()
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                        valence;
-  typename MeshType::Point                cog,
-                                      zero_point(0.0, 0.0, 0.0);
-  typename MeshType::VertexVertexIter     vv_it;
-  typename MeshType::VertexIter           v_it;
-  std::vector<typename MeshType::Point>   point_vector;
+  const int n_vertices = int(mesh_.n_vertices());
 
-  point_vector.clear();
+  buffer_.resize(n_vertices);
 
-  for (v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
-
-    valence = 0;
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_vertices; ++i)
+  {
+    unsigned int                        valence(0);
+    typename MeshType::Point            cog(0.0, 0.0, 0.0);
+    typename MeshType::VertexVertexIter vv_it;
 
-    for (vv_it = mesh_.vv_iter(v_it.handle()); vv_it; ++vv_it) {
+    for (vv_it = mesh_.vv_iter(VertexHandle(i)); vv_it; ++vv_it) {
       cog += vv_it->position();
       ++valence;
     }
     cog /= valence;
-    point_vector.push_back(cog);
+    buffer_[i] = cog;
   }
 
-  for (v_it = mesh_.vertices_end(); v_it != mesh_.vertices_begin(); )
-  {
-    --v_it;
-    mesh_.data(v_it).set_position(point_vector.back());
-    point_vector.pop_back();
-  }
+  flush_vertex_buffer();
 }
 
 
@@ -1053,35 +1086,33 @@ void CompositeT<MeshType,RealType>::VVc(Coeff& _coeff)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                      valence;
-  typename MeshType::Point              cog,
-                                    zero_point(0.0, 0.0, 0.0);
-  typename MeshType::VertexVertexIter   vv_it;
-  typename MeshType::VertexIter         v_it;
-  scalar_t             c;
-  std::vector<typename MeshType::Point> point_vector;
+  const int n_vertices = int(mesh_.n_vertices());
+
+  buffer_.resize(n_vertices);
 
-  for (v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_vertices; ++i)
   {
-    valence = 0;
-    cog = zero_point;
+    const VertexHandle                  vh(i);
+    unsigned int                        valence(0);
+    typename MeshType::Point            cog(0.0, 0.0, 0.0);
+    typename MeshType::VertexVertexIter vv_it;
+    scalar_t                            c;
 
-    for (vv_it = mesh_.vv_iter(v_it.handle()); vv_it; ++vv_it)
+    for (vv_it = mesh_.vv_iter(vh); vv_it; ++vv_it)
     {
       cog += vv_it->position();
       ++valence;
     }
     cog /= valence;
     c = _coeff(valence);
-    cog = cog * (1 - c) + mesh_.data(v_it).position() * c;
-    point_vector.push_back(cog);
-  }
-  for (v_it = mesh_.vertices_end(); v_it != mesh_.vertices_begin(); )
-  {
-    --v_it;
-    mesh_.data(v_it).set_position(point_vector.back());
-    point_vector.pop_back();
+    cog = cog * (1 - c) + mesh_.data(vh).position() * c;
+    buffer_[i] = cog;
   }
+
+  flush_vertex_buffer();
 }
 
 
@@ -1090,36 +1121,32 @@ void CompositeT<MeshType,RealType>::VVc(scalar_t _c)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                      valence;
-  typename MeshType::Point              cog,
-                                    zero_point(0.0, 0.0, 0.0);
-  typename MeshType::VertexVertexIter   vv_it;
-  typename MeshType::VertexIter         v_it;
-  std::vector<typename MeshType::Point> point_vector;
+  const int n_vertices = int(mesh_.n_vertices());
 
-  for (v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
+  buffer_.resize(n_vertices);
 
-    valence = 0;
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_vertices; ++i)
+  {
+    const VertexHandle                  vh(i);
+    unsigned int                        valence(0);
+    typename MeshType::Point            cog(0.0, 0.0, 0.0);
+    typename MeshType::VertexVertexIter vv_it;
 
-    for (vv_it = mesh_.vv_iter(v_it.handle()); vv_it; ++vv_it) {
+    for (vv_it = mesh_.vv_iter(vh); vv_it; ++vv_it) {
       cog += mesh_.data(vv_it).position();
       ++valence;
     }
     cog /= valence;
 
-    cog = cog * (1.0 - _c) + v_it->position() * _c;
-
-    point_vector.push_back(cog);
+    cog = cog * (1.0 - _c) + mesh_.data(vh).position() * _c;
 
+    buffer_[i] = cog;
   }
-  for (v_it = mesh_.vertices_end(); v_it != mesh_.vertices_begin(); ) {
-
-    --v_it;
-    mesh_.data(v_it).set_position(point_vector.back());
-    point_vector.pop_back();
 
-  }
+  flush_vertex_buffer();
 }
 
 
@@ -1128,22 +1155,22 @@ void CompositeT<MeshType,RealType>::EdE()
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                      valence;
-  typename MeshType::Point              cog,
-                                    zero_point(0.0, 0.0, 0.0);
-  typename MeshType::EdgeIter           e_it;
-  typename MeshType::HalfedgeHandle     heh;
-  std::vector<typename MeshType::Point> point_vector;
+  const int n_edges = int(mesh_.n_edges());
 
-  point_vector.clear();
+  buffer_.resize(n_edges);
 
-  for (e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it) {
-
-    valence = 0;
-    cog = zero_point;
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int j = 0; j < n_edges; ++j)
+  {
+    const EdgeHandle                  eh(j);
+    unsigned int                      valence(0);
+    typename MeshType::Point          cog(0.0, 0.0, 0.0);
+    typename MeshType::HalfedgeHandle heh;
 
     for (int i = 0; i <= 1; ++i) {
-      heh = mesh_.halfedge_handle(e_it.handle(), i);
+      heh = mesh_.halfedge_handle(eh, i);
       if (mesh_.face_handle(heh).is_valid())
       {
         cog += mesh_.data(mesh_.edge_handle(mesh_.next_halfedge_handle(heh))).position();
@@ -1154,15 +1181,10 @@ void CompositeT<MeshType,RealType>::EdE()
     }
 
     cog /= valence;
-    point_vector.push_back(cog);
+    buffer_[j] = cog;
   }
 
-  for (e_it = mesh_.edges_end(); e_it != mesh_.edges_begin(); )
-  {
-    --e_it;
-    mesh_.data(e_it).set_position(point_vector.back());
-    point_vector.pop_back();
-  }
+  flush_edge_buffer();
 }
 
 
@@ -1171,22 +1193,22 @@ void CompositeT<MeshType,RealType>::EdEc(scalar_t _c)
 {
   assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
 
-  unsigned int                         valence;
-  typename MeshType::Point                 cog,
-                                       zero_point(0.0, 0.0, 0.0);
-  typename MeshType::EdgeIter              e_it;
-  typename MeshType::HalfedgeHandle        heh;
-  std::vector<typename MeshType::Point>    point_vector;
+  const int n_edges = int(mesh_.n_edges());
 
-  point_vector.clear();
+  buffer_.resize(n_edges);
 
-  for (e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it)
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int j = 0; j < n_edges; ++j)
   {
-    valence = 0;
-    cog = zero_point;
+    const EdgeHandle                  eh(j);
+    unsigned int                      valence(0);
+    typename MeshType::Point          cog(0.0, 0.0, 0.0);
+    typename MeshType::HalfedgeHandle heh;
 
     for (int i = 0; i <= 1; ++i) {
-      heh = mesh_.halfedge_handle(e_it.handle(), i);
+      heh = mesh_.halfedge_handle(eh, i);
       if (mesh_.face_handle(heh).is_valid())
       {
         cog += mesh_.data(mesh_.edge_handle(mesh_.next_halfedge_handle(heh))).position() * (1.0 - _c);
@@ -1197,16 +1219,79 @@ void CompositeT<MeshType,RealType>::EdEc(scalar_t _c)
     }
 
     cog /= valence;
-    cog += mesh_.data(e_it).position() * _c;
-    point_vector.push_back(cog);
+    cog += mesh_.data(eh).position() * _c;
+    buffer_[j] = cog;
   }
 
-  for (e_it = mesh_.edges_end(); e_it != mesh_.edges_begin(); ) {
+  flush_edge_buffer();
+}
+
+
+template<typename MeshType, typename RealType>
+typename MeshType::Point
+CompositeT<MeshType,RealType>::vf_cog(FaceHandle _fh) const
+{
+  assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
+
+  unsigned int                      valence(0);
+  typename MeshType::Point          cog(0.0, 0.0, 0.0);
+  typename MeshType::FaceVertexIter fv_it;
 
-    --e_it;
-    mesh_.data(e_it).set_position(point_vector.back());
-    point_vector.pop_back();
+  for (fv_it = mesh_.fv_iter(_fh); fv_it; ++fv_it) {
+    cog += mesh_.data(fv_it).position();
+    ++valence;
   }
+  cog /= valence;
+
+  return cog;
+}
+
+
+template<typename MeshType, typename RealType>
+void CompositeT<MeshType,RealType>::flush_vertex_buffer()
+{
+  assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
+
+  const int n_vertices = int(mesh_.n_vertices());
+  assert(buffer_.size() == size_t(n_vertices));
+
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_vertices; ++i)
+    mesh_.data(VertexHandle(i)).set_position(buffer_[i]);
+}
+
+
+template<typename MeshType, typename RealType>
+void CompositeT<MeshType,RealType>::flush_edge_buffer()
+{
+  assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
+
+  const int n_edges = int(mesh_.n_edges());
+  assert(buffer_.size() == size_t(n_edges));
+
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_edges; ++i)
+    mesh_.data(EdgeHandle(i)).set_position(buffer_[i]);
+}
+
+
+template<typename MeshType, typename RealType>
+void CompositeT<MeshType,RealType>::flush_face_buffer()
+{
+  assert(p_mesh_); MeshType& mesh_ = *p_mesh_;
+
+  const int n_faces = int(mesh_.n_faces());
+  assert(buffer_.size() == size_t(n_faces));
+
+#ifdef USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i < n_faces; ++i)
+    mesh_.data(FaceHandle(i)).set_position(buffer_[i]);
 }
 
 
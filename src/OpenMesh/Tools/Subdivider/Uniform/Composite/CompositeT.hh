@@ -142,16 +142,20 @@ protected:
   /// to the mesh (called by subdivide()).
   void commit( MeshType &_m)
   {
-    typename MeshType::VertexIter v_it;
+    const int n_vertices = int(_m.n_vertices());
 
-    for (v_it=_m.vertices_begin(); v_it != _m.vertices_end(); ++v_it)
-      _m.set_point(v_it.handle(), _m.data(v_it).position());
+#ifdef USE_OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < n_vertices; ++i)
+      _m.set_point(VertexHandle(i), _m.data(VertexHandle(i)).position());
   }
 
   
 public:
 
-  /// Abstract base class for coefficient functions
+  /// Abstract base class for coefficient functions. The rules run in
+  /// parallel when OpenMP is enabled, operator() may be called concurrently.
   struct Coeff
   {
     virtual ~Coeff() { }
@@ -176,6 +180,7 @@ protected:
   void Tfv();  ///< Split Face, using Face Information
 
   void FF();                 ///< Face to face averaging.
+  void VFF();                ///< VF() followed by FF() in a single pass.
   void FFc(Coeff& _coeff);   ///< Weighted face to face averaging.
   void FFc(scalar_t _c);     ///< Weighted face to face averaging.
 
@@ -222,10 +227,24 @@ protected:
 
   VertexHandle split_edge(HalfedgeHandle _heh);
 
+private:
+
+  /// Result of VF() for a single face
+  typename MeshType::Point vf_cog(FaceHandle _fh) const;
+
+  /// Move the positions computed into buffer_ to the mesh entities
+  void flush_vertex_buffer();
+  void flush_edge_buffer();
+  void flush_face_buffer();
+
 private:
 
   MeshType* p_mesh_;
 
+  /// Back buffer of the rules that read and write the same entity type,
+  /// reused by all rules and subdivision steps.
+  std::vector<typename MeshType::Point> buffer_;
+
 };
 
 
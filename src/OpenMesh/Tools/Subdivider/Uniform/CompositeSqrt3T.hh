@@ -92,8 +92,7 @@ protected: // inherited interface
   void apply_rules(void)  
   {
     Inherited::Tvv3(); 
-    Inherited::VF(); 
-    Inherited::FF(); 
+    Inherited::VFF(); 
     Inherited::FVc(coeffs_); 
   }
 
@@ -54,16 +54,21 @@
 #define LINEAR_H
 
 #include <OpenMesh/Tools/Subdivider/Uniform/SubdividerT.hh>
+#include <OpenMesh/Tools/Utils/HeapT.hh>
 #include <OpenMesh/Core/Utils/vector_cast.hh>
 #include <OpenMesh/Core/Utils/Property.hh>
 // -------------------- STL
 #include <vector>
 #include <queue>
+#include <algorithm>
 #if defined(OM_CC_MIPS)
 #  include <math.h>
 #else
 #  include <cmath>
 #endif
+#ifdef USE_OPENMP
+#  include <omp.h>
+#endif
 
 
 //== NAMESPACE ================================================================
@@ -93,6 +98,17 @@ class CompareLengthFunction {
  * Very simple algorithm splitting all edges which are longer than given via
  * set_max_edge_length(). The split is always performed on the longest
  * edge in the mesh.
+ *
+ * The edges are kept in a heap indexed by an edge property, hence every
+ * edge is stored at most once and its entry is updated when a split
+ * changes its length. Storage for the new elements is reserved from the
+ * area of the faces beforehand.
+ *
+ * With set_batch_tolerance() all edges whose length is within the given
+ * fraction of the longest one are split in one batch. The edges of a
+ * batch have incident faces which share no vertex, the interior ones are
+ * split in parallel (OpenMP). Conflicting edges are deferred to the next
+ * batch.
  */
 template <typename MeshType, typename RealType = float>
 class LongestEdgeT : public SubdividerT<MeshType, RealType>
@@ -111,11 +127,11 @@ public:
 public:
 
 
-  LongestEdgeT() : parent_t()
+  LongestEdgeT() : parent_t(), max_edge_length_squared_(0), batch_tolerance_(0)
   {  }
 
 
-  LongestEdgeT( mesh_t& _m) : parent_t(_m)
+  LongestEdgeT( mesh_t& _m) : parent_t(_m), max_edge_length_squared_(0), batch_tolerance_(0)
   {  }
 
 
@@ -131,6 +147,12 @@ public:
     max_edge_length_squared_ = _value * _value;
   }
 
+  /** Split all edges at least (1 - _value) times as long as the longest
+      edge in one batch. The default 0 splits the longest edges only. */
+  void set_batch_tolerance(double _value) {
+    batch_tolerance_ = _value;
+  }
+
 protected:
 
 
@@ -148,54 +170,176 @@ protected:
 
   bool subdivide( MeshType& _m, size_t _n , const bool _update_points = true)
   {
+    typedef typename mesh_t::VertexHandle   VertexHandle;
+    typedef typename mesh_t::HalfedgeHandle HalfedgeHandle;
+    typedef typename mesh_t::EdgeHandle     EdgeHandle;
+    typedef typename mesh_t::FaceHandle     FaceHandle;
 
-    // Sorted queue containing all edges sorted by their decreasing length
-    std::priority_queue< queueElement, std::vector< queueElement > , CompareLengthFunction< mesh_t, real_t > > queue;
+    // The maximal edge length has not been set
+    if ( max_edge_length_squared_ <= 0 )
+      return false;
 
-    // Build the initial queue
-    // First element should be longest edge
-    typename mesh_t::EdgeIter edgesEnd = _m.edges_end();
-    for ( typename mesh_t::EdgeIter eit  = _m.edges_begin(); eit != edgesEnd; ++eit) {
-      const typename MeshType::Point to   = _m.point(_m.to_vertex_handle(_m.halfedge_handle(eit,0)));
-      const typename MeshType::Point from = _m.point(_m.from_vertex_handle(_m.halfedge_handle(eit,0)));
+    OpenMesh::EPropHandleT<real_t> length;
+    OpenMesh::EPropHandleT<int>    position;
 
-      real_t length = (to - from).sqrnorm();
+    _m.add_property(length);
+    _m.add_property(position);
+
+    // Heap containing the edges to be split, longest edge first
+    EdgeHeap heap( EdgeHeapInterface(_m, length, position) );
+
+    const int n_edges = int(_m.n_edges());
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for ( int i = 0; i < n_edges; ++i ) {
+      EdgeHandle eh(i);
+      _m.property(length, eh)   = sqr_length(_m, eh);
+      _m.property(position, eh) = -1;
+    }
+
+    for ( int i = 0; i < n_edges; ++i ) {
+      EdgeHandle eh(i);
 
       // Only push the edges that need to be split
-      if ( length > max_edge_length_squared_ )
-        queue.push( queueElement(eit.handle(),length) );
+      if ( _m.property(length, eh) > max_edge_length_squared_ &&
+           !(_m.has_edge_status() && _m.status(eh).deleted()) )
+        heap.insert(eh);
+    }
+
+    // Each interior split adds one vertex, three edges and two faces.
+    // Longest edge bisection ends with faces of about a sixth of the
+    // squared maximal edge length.
+    if ( !heap.empty() ) {
+      real_t area = 0;
+      typename mesh_t::FaceIter f_it, f_end(_m.faces_end());
+      for ( f_it = _m.faces_begin(); f_it != f_end; ++f_it ) {
+        typename mesh_t::FaceVertexIter fv_it = _m.fv_iter(f_it);
+        const typename mesh_t::Point& p0 = _m.point(fv_it);  ++fv_it;
+        const typename mesh_t::Point& p1 = _m.point(fv_it);  ++fv_it;
+        const typename mesh_t::Point& p2 = _m.point(fv_it);
+        area += real_t(0.5) * ((p1 - p0) % (p2 - p0)).norm();
+      }
+
+      size_t n_faces  = size_t(6 * area / max_edge_length_squared_);
+      size_t n_splits = (n_faces > _m.n_faces() ? (n_faces - _m.n_faces()) / 2 : 0);
+
+      _m.reserve(_m.n_vertices() + n_splits,
+                 _m.n_edges()    + 3 * n_splits,
+                 _m.n_faces()    + 2 * n_splits);
     }
 
-    bool stop = false;
-    while ( !stop && ! queue.empty() ) {
-      queueElement a = queue.top();
-      queue.pop();
+    const real_t tolerance = std::max(real_t(0), real_t(1) - real_t(batch_tolerance_));
 
-      if ( a.second < max_edge_length_squared_ ) {
-        stop = true;
-        break;
-      } else {
-        const typename MeshType::Point to   = _m.point(_m.to_vertex_handle(_m.halfedge_handle(a.first,0)));
-        const typename MeshType::Point from = _m.point(_m.from_vertex_handle(_m.halfedge_handle(a.first,0)));
-        const typename MeshType::Point midpoint = 0.5 * ( to + from );
+    typename mesh_t::VertexMarkSet marked(_m);
+    std::vector<EdgeHandle>        batch, deferred;
+    std::vector<Split>             splits;
 
-        const typename MeshType::VertexHandle newVertex = _m.add_vertex(midpoint);
-        _m.split(a.first,newVertex);
+    while ( !heap.empty() ) {
 
-        for ( typename MeshType::VertexOHalfedgeIter voh_it(_m,newVertex); voh_it; ++voh_it) {
-          typename MeshType::EdgeHandle eh = _m.edge_handle(voh_it.handle());
-          const typename MeshType::Point to   = _m.point(_m.to_vertex_handle(voh_it));
-          const typename MeshType::Point from = _m.point(_m.from_vertex_handle(voh_it));
-          real_t length = (to - from).sqrnorm();
+      // Longest edges with disjoint faces
+      const real_t threshold = tolerance * tolerance * _m.property(length, heap.front());
 
-          // Only push the edges that need to be split
-          if ( length > max_edge_length_squared_ )
-            queue.push( queueElement(eh,length) );
+      batch.clear();
+      deferred.clear();
+      marked.clear();
+
+      while ( !heap.empty() && _m.property(length, heap.front()) >= threshold ) {
+        EdgeHandle eh = heap.front();
+        heap.pop_front();
+
+        VertexHandle vhs[4];
+        int n = quad_vertices(_m, eh, vhs);
+
+        bool free = true;
+        for ( int j = 0; j < n; ++j )
+          free = free && !marked.is_in(vhs[j]);
+
+        if ( !free ) {
+          deferred.push_back(eh);
+          continue;
+        }
+
+        for ( int j = 0; j < n; ++j )
+          marked.insert(vhs[j]);
+        batch.push_back(eh);
+      }
+
+      for ( size_t i = 0; i < deferred.size(); ++i )
+        heap.insert(deferred[i]);
+
+      // Create the new elements
+      const int n_old_edges = int(_m.n_edges());
+
+      splits.resize(batch.size());
+
+      for ( size_t i = 0; i < batch.size(); ++i ) {
+        Split& split = splits[i];
+        split.eh = batch[i];
+
+        HalfedgeHandle h0 = _m.halfedge_handle(split.eh, 0);
+        HalfedgeHandle o0 = _m.halfedge_handle(split.eh, 1);
+
+        const typename MeshType::Point to   = _m.point(_m.to_vertex_handle(h0));
+        const typename MeshType::Point from = _m.point(_m.from_vertex_handle(h0));
+        const typename MeshType::Point midpoint = ( to + from ) * typename MeshType::Scalar(0.5);
+
+        split.vh = _m.add_vertex(midpoint);
+
+        split.interior = !_m.is_boundary(split.eh);
+        if ( split.interior ) {
+          split.e0 = _m.new_edge(split.vh, _m.to_vertex_handle(_m.next_halfedge_handle(h0)));
+          split.e1 = _m.new_edge(split.vh, _m.to_vertex_handle(o0));
+          split.e2 = _m.new_edge(split.vh, _m.to_vertex_handle(_m.next_halfedge_handle(o0)));
+          split.f1 = _m.new_face();
+          split.f2 = _m.new_face();
+        }
+      }
+
+      // Split
+      const int n_splits = int(splits.size());
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for ( int i = 0; i < n_splits; ++i ) {
+        const Split& split = splits[i];
+        if ( split.interior )
+          _m.split_preallocated(split.eh, split.vh, split.e0, split.e1, split.e2, split.f1, split.f2);
+      }
+
+      for ( int i = 0; i < n_splits; ++i )
+        if ( !splits[i].interior )
+          _m.split(splits[i].eh, splits[i].vh);
+
+      // Update the heap
+      for ( int i = n_old_edges; i < int(_m.n_edges()); ++i )
+        _m.property(position, EdgeHandle(i)) = -1;
+
+      for ( int i = 0; i < n_splits; ++i ) {
+        for ( typename MeshType::VertexEdgeIter ve_it = _m.ve_iter(splits[i].vh); ve_it; ++ve_it) {
+          EdgeHandle eh = ve_it.handle();
+          real_t     l  = sqr_length(_m, eh);
+
+          _m.property(length, eh) = l;
 
+          // Only push the edges that need to be split
+          if ( heap.is_stored(eh) ) {
+            if ( l > max_edge_length_squared_ )
+              heap.update(eh);
+            else
+              heap.remove(eh);
+          }
+          else if ( l > max_edge_length_squared_ )
+            heap.insert(eh);
         }
       }
     }
 
+    _m.remove_property(length);
+    _m.remove_property(position);
+
 #if defined(_DEBUG) || defined(DEBUG)
       // Now we have an consistent mesh!
       assert( OpenMesh::Utils::MeshCheckerT<mesh_t>(_m).check() );
@@ -206,8 +350,84 @@ protected:
   }
 
 
+private: // types
+
+  /// Heap interface for the edges, longest edge first
+  class EdgeHeapInterface
+  {
+  public:
+
+    EdgeHeapInterface(mesh_t&                        _mesh,
+                      OpenMesh::EPropHandleT<real_t> _length,
+                      OpenMesh::EPropHandleT<int>    _pos)
+      : mesh_(_mesh), length_(_length), pos_(_pos)
+    { }
+
+    inline bool
+    less( typename mesh_t::EdgeHandle _eh0, typename mesh_t::EdgeHandle _eh1 )
+    { return mesh_.property(length_, _eh0) > mesh_.property(length_, _eh1); }
+
+    inline bool
+    greater( typename mesh_t::EdgeHandle _eh0, typename mesh_t::EdgeHandle _eh1 )
+    { return mesh_.property(length_, _eh0) < mesh_.property(length_, _eh1); }
+
+    inline int
+    get_heap_position(typename mesh_t::EdgeHandle _eh)
+    { return mesh_.property(pos_, _eh); }
+
+    inline void
+    set_heap_position(typename mesh_t::EdgeHandle _eh, int _pos)
+    { mesh_.property(pos_, _eh) = _pos; }
+
+  private:
+    mesh_t&                         mesh_;
+    OpenMesh::EPropHandleT<real_t>  length_;
+    OpenMesh::EPropHandleT<int>     pos_;
+  };
+
+  typedef Utils::HeapT<typename mesh_t::EdgeHandle, EdgeHeapInterface> EdgeHeap;
+
+  /// Elements of one edge split
+  struct Split
+  {
+    typename mesh_t::EdgeHandle     eh;
+    typename mesh_t::VertexHandle   vh;
+    typename mesh_t::HalfedgeHandle e0, e1, e2;
+    typename mesh_t::FaceHandle     f1, f2;
+    bool                            interior;
+  };
+
+
+private: // helpers
+
+  static real_t sqr_length( const mesh_t& _m, typename mesh_t::EdgeHandle _eh )
+  {
+    const typename MeshType::Point to   = _m.point(_m.to_vertex_handle(_m.halfedge_handle(_eh,0)));
+    const typename MeshType::Point from = _m.point(_m.from_vertex_handle(_m.halfedge_handle(_eh,0)));
+    return (to - from).sqrnorm();
+  }
+
+  /// Vertices of the faces incident to _eh, returns their number
+  static int quad_vertices( const mesh_t& _m, typename mesh_t::EdgeHandle _eh,
+                            typename mesh_t::VertexHandle _vhs[4] )
+  {
+    typename mesh_t::HalfedgeHandle h0 = _m.halfedge_handle(_eh, 0);
+    typename mesh_t::HalfedgeHandle o0 = _m.halfedge_handle(_eh, 1);
+    int n = 0;
+
+    _vhs[n++] = _m.to_vertex_handle(h0);
+    _vhs[n++] = _m.to_vertex_handle(o0);
+    if ( !_m.is_boundary(h0) )
+      _vhs[n++] = _m.to_vertex_handle(_m.next_halfedge_handle(h0));
+    if ( !_m.is_boundary(o0) )
+      _vhs[n++] = _m.to_vertex_handle(_m.next_halfedge_handle(o0));
+    return n;
+  }
+
+
 private: // data
   real_t max_edge_length_squared_;
+  double batch_tolerance_;
 
 };
 
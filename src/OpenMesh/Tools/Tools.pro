@@ -12,7 +12,7 @@ contains( OPENFLIPPER , OpenFlipper ){
         DESTDIR = $${TOPDIR}/lib
 }
 
-DIRECTORIES = . Decimater Smoother Subdivider/Adaptive/Composite \
+DIRECTORIES = . Decimater Remesher Smoother Subdivider/Adaptive/Composite \
         	Subdivider/Uniform/Composite Subdivider/Uniform \
 		Utils
 
@@ -0,0 +1,614 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#define OPENMESH_BATCHEDITOR_C
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Tools/Utils/BatchEditorT.hh>
+
+
+//== NAMESPACES ============================================================== 
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== IMPLEMENTATION ========================================================== 
+
+
+template <class Mesh>
+BatchEditorT<Mesh>::
+BatchEditorT(Mesh& _mesh)
+  : mesh_(_mesh),
+    claimed_(_mesh),
+    adjust_marked_(_mesh)
+{
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+BatchEditorT<Mesh>::
+~BatchEditorT()
+{
+  mesh_.release_vertex_status();
+  mesh_.release_edge_status();
+  mesh_.release_face_status();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+BatchEditorT<Mesh>::
+collapse(HalfedgeHandle _heh)
+{
+  if (!mesh_.is_collapse_ok(_heh))
+    return false;
+
+  VertexHandle v0 = mesh_.from_vertex_handle(_heh);
+  VertexHandle v1 = mesh_.to_vertex_handle(_heh);
+
+  // the faces around v0 and v1 change
+  claim_buffer_.clear();
+  claim_buffer_.push_back(v0);
+  claim_buffer_.push_back(v1);
+
+  typename Mesh::VertexVertexIter vv_it;
+  for (vv_it = mesh_.vv_iter(v0); vv_it; ++vv_it)
+    claim_buffer_.push_back(vv_it.handle());
+  for (vv_it = mesh_.vv_iter(v1); vv_it; ++vv_it)
+    claim_buffer_.push_back(vv_it.handle());
+
+  if (!claim())
+    return false;
+
+  Operation op = { Collapse, _heh.idx(), Point() };
+  operations_.push_back(op);
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+BatchEditorT<Mesh>::
+flip(EdgeHandle _eh)
+{
+  if (mesh_.status(_eh).deleted() || mesh_.is_boundary(_eh) ||
+      !mesh_.is_flip_ok(_eh))
+    return false;
+
+  HalfedgeHandle h0 = mesh_.halfedge_handle(_eh, 0);
+  HalfedgeHandle h1 = mesh_.halfedge_handle(_eh, 1);
+
+  claim_buffer_.clear();
+  claim_buffer_.push_back(mesh_.to_vertex_handle(h0));
+  claim_buffer_.push_back(mesh_.to_vertex_handle(h1));
+  claim_buffer_.push_back(mesh_.to_vertex_handle(mesh_.next_halfedge_handle(h0)));
+  claim_buffer_.push_back(mesh_.to_vertex_handle(mesh_.next_halfedge_handle(h1)));
+
+  if (!claim())
+    return false;
+
+  Operation op = { Flip, _eh.idx(), Point() };
+  operations_.push_back(op);
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+BatchEditorT<Mesh>::
+split(EdgeHandle _eh, const Point& _p)
+{
+  if (mesh_.status(_eh).deleted())
+    return false;
+
+  HalfedgeHandle h0 = mesh_.halfedge_handle(_eh, 0);
+  HalfedgeHandle h1 = mesh_.halfedge_handle(_eh, 1);
+
+  claim_buffer_.clear();
+  claim_buffer_.push_back(mesh_.to_vertex_handle(h0));
+  claim_buffer_.push_back(mesh_.to_vertex_handle(h1));
+  if (!mesh_.is_boundary(h0))
+    claim_buffer_.push_back(mesh_.to_vertex_handle(mesh_.next_halfedge_handle(h0)));
+  if (!mesh_.is_boundary(h1))
+    claim_buffer_.push_back(mesh_.to_vertex_handle(mesh_.next_halfedge_handle(h1)));
+
+  if (!claim())
+    return false;
+
+  Operation op = { Split, _eh.idx(), _p };
+  operations_.push_back(op);
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+BatchEditorT<Mesh>::
+delete_face(FaceHandle _fh)
+{
+  if (mesh_.status(_fh).deleted())
+    return false;
+
+  claim_buffer_.clear();
+  for (typename Mesh::FaceVertexIter fv_it = mesh_.fv_iter(_fh); fv_it; ++fv_it)
+    claim_buffer_.push_back(fv_it.handle());
+
+  if (!claim())
+    return false;
+
+  Operation op = { DeleteFace, _fh.idx(), Point() };
+  operations_.push_back(op);
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+BatchEditorT<Mesh>::
+claim()
+{
+  for (size_t i = 0; i < claim_buffer_.size(); ++i)
+    if (claimed_.is_in(claim_buffer_[i]))
+      return false;
+
+  for (size_t i = 0; i < claim_buffer_.size(); ++i)
+    claimed_.insert(claim_buffer_[i]);
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+size_t
+BatchEditorT<Mesh>::
+commit()
+{
+  split_vertices_.clear();
+
+  for (size_t i = 0; i < operations_.size(); ++i)
+  {
+    const Operation& op = operations_[i];
+
+    switch (op.type)
+    {
+      case Collapse:   apply_collapse(HalfedgeHandle(op.idx));       break;
+      case Flip:       mesh_.flip(EdgeHandle(op.idx));                break;
+      case Split:      apply_split(EdgeHandle(op.idx), op.point);     break;
+      case DeleteFace: apply_delete_face(FaceHandle(op.idx));         break;
+    }
+  }
+
+  // deferred outgoing halfedge fixup
+  for (size_t i = 0; i < adjust_.size(); ++i)
+    if (!mesh_.status(adjust_[i]).deleted())
+      mesh_.adjust_outgoing_halfedge(adjust_[i]);
+
+  size_t n = operations_.size();
+
+  adjust_.clear();
+  adjust_marked_.clear();
+  cancel();
+
+  return n;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BatchEditorT<Mesh>::
+cancel()
+{
+  operations_.clear();
+  claimed_.clear();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BatchEditorT<Mesh>::
+garbage_collection()
+{
+  cancel();
+
+  free_vertices_.clear();
+  free_edges_.clear();
+  free_faces_.clear();
+  split_vertices_.clear();
+
+  mesh_.garbage_collection();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BatchEditorT<Mesh>::
+apply_collapse(HalfedgeHandle _heh)
+{
+  // see PolyConnectivity::collapse()
+  HalfedgeHandle h0 = _heh;
+  HalfedgeHandle h1 = mesh_.next_halfedge_handle(h0);
+  HalfedgeHandle o0 = mesh_.opposite_halfedge_handle(h0);
+  HalfedgeHandle o1 = mesh_.next_halfedge_handle(o0);
+
+  // remove edge
+  collapse_edge(h0);
+
+  // remove loops
+  if (mesh_.next_halfedge_handle(mesh_.next_halfedge_handle(h1)) == h1)
+    collapse_loop(mesh_.next_halfedge_handle(h1));
+  if (mesh_.next_halfedge_handle(mesh_.next_halfedge_handle(o1)) == o1)
+    collapse_loop(o1);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BatchEditorT<Mesh>::
+collapse_edge(HalfedgeHandle _heh)
+{
+  // see PolyConnectivity::collapse_edge()
+  HalfedgeHandle  h  = _heh;
+  HalfedgeHandle  hn = mesh_.next_halfedge_handle(h);
+  HalfedgeHandle  hp = mesh_.prev_halfedge_handle(h);
+
+  HalfedgeHandle  o  = mesh_.opposite_halfedge_handle(h);
+  HalfedgeHandle  on = mesh_.next_halfedge_handle(o);
+  HalfedgeHandle  op = mesh_.prev_halfedge_handle(o);
+
+  FaceHandle      fh = mesh_.face_handle(h);
+  FaceHandle      fo = mesh_.face_handle(o);
+
+  VertexHandle    vh = mesh_.to_vertex_handle(h);
+  VertexHandle    vo = mesh_.to_vertex_handle(o);
+
+  // halfedge -> vertex
+  for (typename Mesh::VertexIHalfedgeIter vih_it = mesh_.vih_iter(vo); vih_it; ++vih_it)
+    mesh_.set_vertex_handle(vih_it.handle(), vh);
+
+  // halfedge -> halfedge
+  mesh_.set_next_halfedge_handle(hp, hn);
+  mesh_.set_next_halfedge_handle(op, on);
+
+  // face -> halfedge
+  if (fh.is_valid())  mesh_.set_halfedge_handle(fh, hn);
+  if (fo.is_valid())  mesh_.set_halfedge_handle(fo, on);
+
+  // vertex -> halfedge
+  if (mesh_.halfedge_handle(vh) == o)  mesh_.set_halfedge_handle(vh, hn);
+  defer_adjust(vh);
+  mesh_.set_isolated(vo);
+
+  // delete stuff
+  mesh_.status(mesh_.edge_handle(h)).set_deleted(true);
+  mesh_.status(vo).set_deleted(true);
+
+  free_edges_.push_back(mesh_.edge_handle(h));
+  free_vertices_.push_back(vo);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BatchEditorT<Mesh>::
+collapse_loop(HalfedgeHandle _heh)
+{
+  // see PolyConnectivity::collapse_loop()
+  HalfedgeHandle  h0 = _heh;
+  HalfedgeHandle  h1 = mesh_.next_halfedge_handle(h0);
+
+  HalfedgeHandle  o0 = mesh_.opposite_halfedge_handle(h0);
+  HalfedgeHandle  o1 = mesh_.opposite_halfedge_handle(h1);
+
+  VertexHandle    v0 = mesh_.to_vertex_handle(h0);
+  VertexHandle    v1 = mesh_.to_vertex_handle(h1);
+
+  FaceHandle      fh = mesh_.face_handle(h0);
+  FaceHandle      fo = mesh_.face_handle(o0);
+
+  // is it a loop ?
+  assert ((mesh_.next_halfedge_handle(h1) == h0) && (h1 != o0));
+
+  // halfedge -> halfedge
+  mesh_.set_next_halfedge_handle(h1, mesh_.next_halfedge_handle(o0));
+  mesh_.set_next_halfedge_handle(mesh_.prev_halfedge_handle(o0), h1);
+
+  // halfedge -> face
+  mesh_.set_face_handle(h1, fo);
+
+  // vertex -> halfedge
+  mesh_.set_halfedge_handle(v0, h1);  defer_adjust(v0);
+  mesh_.set_halfedge_handle(v1, o1);  defer_adjust(v1);
+
+  // face -> halfedge
+  if (fo.is_valid() && mesh_.halfedge_handle(fo) == o0)
+    mesh_.set_halfedge_handle(fo, h1);
+
+  // delete stuff
+  if (fh.is_valid())
+  {
+    mesh_.set_halfedge_handle(fh, Mesh::InvalidHalfedgeHandle);
+    mesh_.status(fh).set_deleted(true);
+    free_faces_.push_back(fh);
+  }
+  mesh_.status(mesh_.edge_handle(h0)).set_deleted(true);
+  free_edges_.push_back(mesh_.edge_handle(h0));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BatchEditorT<Mesh>::
+apply_split(EdgeHandle _eh, const Point& _p)
+{
+  VertexHandle vh = new_vertex(_p);
+  split_vertices_.push_back(vh);
+
+  // boundary edges are split by the mesh, with new elements
+  if (mesh_.is_boundary(_eh))
+  {
+    mesh_.split(_eh, vh);
+    return;
+  }
+
+  HalfedgeHandle h0 = mesh_.halfedge_handle(_eh, 0);
+  HalfedgeHandle o0 = mesh_.halfedge_handle(_eh, 1);
+
+  HalfedgeHandle e0 = new_edge(vh, mesh_.to_vertex_handle(mesh_.next_halfedge_handle(h0)));
+  HalfedgeHandle e1 = new_edge(vh, mesh_.to_vertex_handle(o0));
+  HalfedgeHandle e2 = new_edge(vh, mesh_.to_vertex_handle(mesh_.next_halfedge_handle(o0)));
+  FaceHandle     f1 = new_face();
+  FaceHandle     f2 = new_face();
+
+  mesh_.split_preallocated(_eh, vh, e0, e1, e2, f1, f2);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BatchEditorT<Mesh>::
+apply_delete_face(FaceHandle _fh)
+{
+  // see PolyConnectivity::delete_face(), isolated vertices are deleted
+  mesh_.status(_fh).set_deleted(true);
+  free_faces_.push_back(_fh);
+
+  HalfedgeHandle hhs[3];
+  int            n = 0;
+
+  for (typename Mesh::FaceHalfedgeIter fh_it = mesh_.fh_iter(_fh); fh_it && n < 3; ++fh_it)
+    hhs[n++] = fh_it.handle();
+
+  for (int i = 0; i < n; ++i)
+  {
+    mesh_.set_boundary(hhs[i]);
+    defer_adjust(mesh_.to_vertex_handle(hhs[i]));
+  }
+
+  // delete the edges which are boundary on both sides now
+  for (int i = 0; i < n; ++i)
+  {
+    if (!mesh_.is_boundary(mesh_.opposite_halfedge_handle(hhs[i])))
+      continue;
+
+    EdgeHandle     eh    = mesh_.edge_handle(hhs[i]);
+    HalfedgeHandle h0    = mesh_.halfedge_handle(eh, 0);
+    VertexHandle   v0    = mesh_.to_vertex_handle(h0);
+    HalfedgeHandle next0 = mesh_.next_halfedge_handle(h0);
+    HalfedgeHandle prev0 = mesh_.prev_halfedge_handle(h0);
+
+    HalfedgeHandle h1    = mesh_.halfedge_handle(eh, 1);
+    VertexHandle   v1    = mesh_.to_vertex_handle(h1);
+    HalfedgeHandle next1 = mesh_.next_halfedge_handle(h1);
+    HalfedgeHandle prev1 = mesh_.prev_halfedge_handle(h1);
+
+    // adjust next and prev handles
+    mesh_.set_next_halfedge_handle(prev0, next1);
+    mesh_.set_next_halfedge_handle(prev1, next0);
+
+    mesh_.status(eh).set_deleted(true);
+    free_edges_.push_back(eh);
+
+    // update v0
+    if (mesh_.halfedge_handle(v0) == h1)
+    {
+      if (next0 == h1)
+      {
+        mesh_.status(v0).set_deleted(true);
+        mesh_.set_isolated(v0);
+        free_vertices_.push_back(v0);
+      }
+      else mesh_.set_halfedge_handle(v0, next0);
+    }
+
+    // update v1
+    if (mesh_.halfedge_handle(v1) == h0)
+    {
+      if (next1 == h0)
+      {
+        mesh_.status(v1).set_deleted(true);
+        mesh_.set_isolated(v1);
+        free_vertices_.push_back(v1);
+      }
+      else mesh_.set_halfedge_handle(v1, next1);
+    }
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename BatchEditorT<Mesh>::VertexHandle
+BatchEditorT<Mesh>::
+new_vertex(const Point& _p)
+{
+  if (free_vertices_.empty())
+    return mesh_.add_vertex(_p);
+
+  VertexHandle vh = free_vertices_.back();
+  free_vertices_.pop_back();
+
+  mesh_.status(vh).set_bits(0);
+  mesh_.set_point(vh, _p);
+  return vh;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename BatchEditorT<Mesh>::HalfedgeHandle
+BatchEditorT<Mesh>::
+new_edge(VertexHandle _from, VertexHandle _to)
+{
+  if (free_edges_.empty())
+    return mesh_.new_edge(_from, _to);
+
+  EdgeHandle eh = free_edges_.back();
+  free_edges_.pop_back();
+
+  HalfedgeHandle heh0 = mesh_.halfedge_handle(eh, 0);
+  HalfedgeHandle heh1 = mesh_.halfedge_handle(eh, 1);
+
+  mesh_.status(eh).set_bits(0);
+  if (mesh_.has_halfedge_status())
+  {
+    mesh_.status(heh0).set_bits(0);
+    mesh_.status(heh1).set_bits(0);
+  }
+
+  mesh_.set_vertex_handle(heh0, _to);
+  mesh_.set_vertex_handle(heh1, _from);
+  return heh0;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename BatchEditorT<Mesh>::FaceHandle
+BatchEditorT<Mesh>::
+new_face()
+{
+  if (free_faces_.empty())
+    return mesh_.new_face();
+
+  FaceHandle fh = free_faces_.back();
+  free_faces_.pop_back();
+
+  mesh_.status(fh).set_bits(0);
+  return fh;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BatchEditorT<Mesh>::
+defer_adjust(VertexHandle _vh)
+{
+  if (!adjust_marked_.is_in(_vh))
+  {
+    adjust_marked_.insert(_vh);
+    adjust_.push_back(_vh);
+  }
+}
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
@@ -0,0 +1,215 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#ifndef OPENMESH_BATCHEDITOR_HH
+#define OPENMESH_BATCHEDITOR_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Utils/Noncopyable.hh>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Transaction style editing of a triangle mesh.
+ *
+ *  Edge collapses, edge flips, edge splits and face deletions are queued
+ *  and applied together by commit(). An operation is checked when it is
+ *  queued: it is rejected if it is not valid on the current mesh
+ *  (is_collapse_ok(), is_flip_ok(), deleted elements) or if one of the
+ *  faces it changes shares a vertex with a face changed by an operation
+ *  already queued. Hence the queued operations do not interfere and all
+ *  of them can be applied.
+ *
+ *  commit() applies the operations in the order they were queued.
+ *  Collapses and face deletions fix the outgoing halfedges of the
+ *  vertices they change once at the end of commit() instead of after
+ *  every single operation. The elements deleted by the editor are kept in
+ *  free lists and reused by later splits, even in the same commit(), so
+ *  a loop of collapses and splits does not grow the mesh arrays. Reused
+ *  elements get cleared status bits, their custom properties keep the
+ *  values of the deleted element.
+ *
+ *  The editor requests the vertex, edge and face status on construction
+ *  and releases it when it is destroyed. Use garbage_collection() of the
+ *  editor rather than the one of the mesh while the editor exists, since
+ *  the free lists refer to the deleted elements.
+ *
+ *  \code
+ *  Utils::BatchEditorT<MyMesh> editor(mesh);
+ *
+ *  for (MyMesh::EdgeIter e_it = mesh.edges_begin(); e_it != mesh.edges_end(); ++e_it)
+ *    if (mesh.calc_edge_length(e_it) < min_length)
+ *      editor.collapse(mesh.halfedge_handle(e_it, 0)); // conflicting ones are skipped
+ *
+ *  editor.commit();
+ *  \endcode
+ */
+template <class Mesh>
+class BatchEditorT : private Utils::Noncopyable
+{
+public:
+
+  typedef typename Mesh::Point          Point;
+  typedef typename Mesh::VertexHandle   VertexHandle;
+  typedef typename Mesh::HalfedgeHandle HalfedgeHandle;
+  typedef typename Mesh::EdgeHandle     EdgeHandle;
+  typedef typename Mesh::FaceHandle     FaceHandle;
+
+public:
+
+  /// Constructor
+  BatchEditorT( Mesh& _mesh );
+
+  /// Destructor, queued operations are discarded
+  ~BatchEditorT();
+
+
+  /// \name Queue operations, false if the operation was rejected
+  //@{
+
+  /// Collapse _heh, the from vertex is removed.
+  bool collapse( HalfedgeHandle _heh );
+
+  /// Flip the interior edge _eh.
+  bool flip( EdgeHandle _eh );
+
+  /// Split _eh (2-to-4 split) at a new vertex at _p.
+  bool split( EdgeHandle _eh, const Point& _p );
+
+  /// Delete _fh and the edges and vertices left isolated.
+  bool delete_face( FaceHandle _fh );
+
+  //@}
+
+
+  /// Apply all queued operations. Returns their number.
+  size_t commit();
+
+  /// Discard all queued operations.
+  void cancel();
+
+  /// Number of queued operations
+  size_t n_queued() const { return operations_.size(); }
+
+  /// Vertices created by the splits of the last commit(), in queue order
+  const std::vector<VertexHandle>& split_vertices() const
+  { return split_vertices_; }
+
+
+  /// Number of deleted elements available for reuse
+  size_t n_free() const
+  { return free_vertices_.size() + free_edges_.size() + free_faces_.size(); }
+
+  /// Clear the free lists and remove all deleted elements from the mesh.
+  void garbage_collection();
+
+private:
+
+  enum Type { Collapse, Flip, Split, DeleteFace };
+
+  struct Operation
+  {
+    Type  type;
+    int   idx;
+    Point point;
+  };
+
+  typedef typename Mesh::VertexMarkSet VertexMarkSet;
+
+  /// Mark the vertices in claim_buffer_, false if one is already marked
+  bool claim();
+
+  void apply_collapse( HalfedgeHandle _heh );
+  void collapse_edge( HalfedgeHandle _heh );
+  void collapse_loop( HalfedgeHandle _heh );
+  void apply_split( EdgeHandle _eh, const Point& _p );
+  void apply_delete_face( FaceHandle _fh );
+
+  VertexHandle   new_vertex( const Point& _p );
+  HalfedgeHandle new_edge( VertexHandle _from, VertexHandle _to );
+  FaceHandle     new_face();
+
+  void defer_adjust( VertexHandle _vh );
+
+private:
+
+  Mesh&                      mesh_;
+
+  std::vector<Operation>     operations_;
+  VertexMarkSet              claimed_;
+  std::vector<VertexHandle>  claim_buffer_;
+
+  std::vector<VertexHandle>  adjust_;
+  VertexMarkSet              adjust_marked_;
+
+  std::vector<VertexHandle>  split_vertices_;
+
+  std::vector<VertexHandle>  free_vertices_;
+  std::vector<EdgeHandle>    free_edges_;
+  std::vector<FaceHandle>    free_faces_;
+};
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_BATCHEDITOR_C)
+#define OPENMESH_BATCHEDITOR_TEMPLATES
+#include "BatchEditorT.cc"
+#endif
+//=============================================================================
+#endif // OPENMESH_BATCHEDITOR_HH defined
+//=============================================================================
+
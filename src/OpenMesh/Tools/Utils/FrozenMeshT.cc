@@ -0,0 +1,274 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#define OPENMESH_FROZENMESH_C
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Tools/Utils/FrozenMeshT.hh>
+#ifdef USE_OPENMP
+#  include <omp.h>
+#endif
+
+
+//== NAMESPACES ============================================================== 
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== IMPLEMENTATION ========================================================== 
+
+
+template <class Mesh>
+const typename FrozenMeshT<Mesh>::Index FrozenMeshT<Mesh>::InvalidIndex;
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+FrozenMeshT<Mesh>::
+FrozenMeshT(const Mesh& _mesh)
+{
+  const int n_src_vertices  = int(_mesh.n_vertices());
+  const int n_src_faces     = int(_mesh.n_faces());
+  const int n_src_halfedges = int(_mesh.n_halfedges());
+
+
+  // number the remaining vertices and faces
+
+  vertex_.assign(n_src_vertices, InvalidIndex);
+  source_vertex_.reserve(n_src_vertices);
+  for (int i=0; i<n_src_vertices; ++i)
+    if (!_mesh.has_vertex_status() ||
+        !_mesh.status(VertexHandle(i)).deleted())
+    {
+      vertex_[i] = Index(source_vertex_.size());
+      source_vertex_.push_back(i);
+    }
+
+  face_.assign(n_src_faces, InvalidIndex);
+  source_face_.reserve(n_src_faces);
+  for (int i=0; i<n_src_faces; ++i)
+    if (!_mesh.has_face_status() ||
+        !_mesh.status(FaceHandle(i)).deleted())
+    {
+      face_[i] = Index(source_face_.size());
+      source_face_.push_back(i);
+    }
+
+  const int nv = int(source_vertex_.size());
+  const int nf = int(source_face_.size());
+
+
+  // count face corners and vertex one-rings
+
+  face_corners_.assign(nf+1, 0);
+  vertex_neighbors_.assign(nv+1, 0);
+  vertex_corners_.assign(nv+1, 0);
+  boundary_.resize(nv);
+  points_.resize(nv);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int f=0; f<nf; ++f)
+  {
+    Index n(0);
+    for (typename Mesh::ConstFaceHalfedgeIter fh_it =
+           _mesh.cfh_iter(FaceHandle(source_face_[f])); fh_it; ++fh_it)
+      ++n;
+    face_corners_[f+1] = n;
+  }
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int v=0; v<nv; ++v)
+  {
+    const VertexHandle vh(source_vertex_[v]);
+    Index n_neighbors(0), n_corners(0);
+    for (typename Mesh::ConstVertexOHalfedgeIter voh_it = _mesh.cvoh_iter(vh);
+         voh_it; ++voh_it)
+    {
+      ++n_neighbors;
+      if (_mesh.face_handle(voh_it.handle()).is_valid())
+        ++n_corners;
+    }
+    vertex_neighbors_[v+1] = n_neighbors;
+    vertex_corners_[v+1]   = n_corners;
+    boundary_[v]           = _mesh.is_boundary(vh);
+    points_[v]             = _mesh.point(vh);
+  }
+
+  prefix_sum(face_corners_);
+  prefix_sum(vertex_neighbors_);
+  prefix_sum(vertex_corners_);
+
+
+  // corners, remembering which halfedge each corner refers to
+
+  const Index nc = face_corners_[nf];
+
+  corner_vertex_.resize(nc);
+  corner_face_.resize(nc);
+  opposite_corner_.resize(nc);
+
+  std::vector<Index> halfedge_corner(n_src_halfedges, InvalidIndex);
+  std::vector<int>   corner_halfedge(nc);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int f=0; f<nf; ++f)
+  {
+    Index c = face_corners_[f];
+    for (typename Mesh::ConstFaceHalfedgeIter fh_it =
+           _mesh.cfh_iter(FaceHandle(source_face_[f])); fh_it; ++fh_it, ++c)
+    {
+      const typename Mesh::HalfedgeHandle hh = fh_it.handle();
+      corner_vertex_[c]   = vertex_[_mesh.to_vertex_handle(hh).idx()];
+      corner_face_[c]     = Index(f);
+      corner_halfedge[c]  = hh.idx();
+      halfedge_corner[hh.idx()] = c;
+    }
+  }
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int c=0; c<int(nc); ++c)
+    opposite_corner_[c] = halfedge_corner[
+      _mesh.opposite_halfedge_handle(
+        typename Mesh::HalfedgeHandle(corner_halfedge[c])).idx()];
+
+
+  // one-rings
+
+  neighbors_.resize(vertex_neighbors_[nv]);
+  corners_.resize(vertex_corners_[nv]);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int v=0; v<nv; ++v)
+  {
+    Index n = vertex_neighbors_[v];
+    Index c = vertex_corners_[v];
+    for (typename Mesh::ConstVertexOHalfedgeIter voh_it =
+           _mesh.cvoh_iter(VertexHandle(source_vertex_[v])); voh_it; ++voh_it)
+    {
+      const typename Mesh::HalfedgeHandle hh = voh_it.handle();
+      neighbors_[n++] = vertex_[_mesh.to_vertex_handle(hh).idx()];
+
+      // the corner of v in face(hh) refers to the halfedge entering v
+      if (_mesh.face_handle(hh).is_valid())
+        corners_[c++] = halfedge_corner[_mesh.prev_halfedge_handle(hh).idx()];
+    }
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+FrozenMeshT<Mesh>::
+prefix_sum(std::vector<Index>& _offsets)
+{
+  for (size_t i=1; i<_offsets.size(); ++i)
+    _offsets[i] += _offsets[i-1];
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+template <typename T>
+void
+FrozenMeshT<Mesh>::
+copy_vertex_property(const Mesh& _mesh, VPropHandleT<T> _ph,
+                     std::vector<T>& _column) const
+{
+  const int nv = int(n_vertices());
+
+  _column.resize(nv);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int v=0; v<nv; ++v)
+    _column[v] = _mesh.property(_ph, VertexHandle(source_vertex_[v]));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+template <typename T>
+void
+FrozenMeshT<Mesh>::
+copy_face_property(const Mesh& _mesh, FPropHandleT<T> _ph,
+                   std::vector<T>& _column) const
+{
+  const int nf = int(n_faces());
+
+  _column.resize(nf);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int f=0; f<nf; ++f)
+    _column[f] = _mesh.property(_ph, FaceHandle(source_face_[f]));
+}
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
@@ -0,0 +1,290 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#ifndef OPENMESH_FROZENMESH_HH
+#define OPENMESH_FROZENMESH_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Mesh/Handles.hh>
+#include <OpenMesh/Core/Utils/Property.hh>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Immutable, compact snapshot of the connectivity and geometry of a mesh.
+ *
+ *  The snapshot is taken from any PolyMeshT or TriMeshT on construction and
+ *  does not change afterwards. Deleted elements of the source mesh are
+ *  skipped, the remaining vertices and faces are numbered contiguously by
+ *  32 bit indices (Index). There are no status bits, no deleted checks in
+ *  the iteration and no dynamic properties, which makes read-only queries
+ *  (smoothing weights, curvature, quality metrics) cheap and safe to run
+ *  from several threads.
+ *
+ *  Connectivity is stored in compressed row (CSR) form:
+ *  - Faces are lists of corners. Corner \c c of face \c f refers to the
+ *    halfedge of \c f entering corner_vertex(c); the corners of a face are
+ *    in the order of the FaceVertexIter of the source mesh.
+ *    opposite_corner() gives the corner of the opposite halfedge
+ *    (InvalidIndex at the boundary).
+ *  - The one-ring of each vertex is stored as the list of neighbor vertices
+ *    (order of VertexVertexIter) and the list of its corners in the
+ *    incident faces (order of VertexFaceIter).
+ *
+ *  Attributes are kept in typed columns, i.e. \c std::vector<T> indexed by
+ *  the vertex or face index of the snapshot. copy_vertex_property() and
+ *  copy_face_property() fill a column from a property of the source mesh.
+ *
+ *  source_vertex() / source_face() and vertex() / face() map between the
+ *  handles of the source mesh and the indices of the snapshot in O(1).
+ *
+ *  The construction runs in parallel if OpenMesh has been built with
+ *  OpenMP.
+ */
+template <class Mesh>
+class FrozenMeshT
+{
+public:
+
+  /// index of vertices, faces and corners
+  typedef unsigned int                 Index;
+
+  /// iterator over a list of indices (face corners, one-rings)
+  typedef const Index*                 ConstIndexIter;
+
+  typedef typename Mesh::Point         Point;
+  typedef typename Mesh::VertexHandle  VertexHandle;
+  typedef typename Mesh::FaceHandle    FaceHandle;
+
+  /// index of a missing element, e.g. the opposite corner at the boundary
+  static const Index InvalidIndex = Index(-1);
+
+
+  /// take a snapshot of _mesh
+  explicit FrozenMeshT(const Mesh& _mesh);
+
+  /// destructor
+  ~FrozenMeshT() {}
+
+
+  /** \name Sizes */
+  //@{
+  Index n_vertices() const { return Index(points_.size()); }
+  Index n_faces()    const { return Index(face_corners_.size()) - 1; }
+  Index n_corners()  const { return Index(corner_vertex_.size()); }
+  //@}
+
+
+  /** \name Mapping to and from the source mesh */
+  //@{
+
+  /// handle of vertex _v in the source mesh
+  VertexHandle source_vertex(Index _v) const
+  { return VertexHandle(source_vertex_[_v]); }
+
+  /// handle of face _f in the source mesh
+  FaceHandle source_face(Index _f) const
+  { return FaceHandle(source_face_[_f]); }
+
+  /// index of source vertex _vh, InvalidIndex if it was deleted
+  Index vertex(VertexHandle _vh) const { return vertex_[_vh.idx()]; }
+
+  /// index of source face _fh, InvalidIndex if it was deleted
+  Index face(FaceHandle _fh) const { return face_[_fh.idx()]; }
+
+  //@}
+
+
+  /** \name Geometry */
+  //@{
+
+  const Point& point(Index _v) const { return points_[_v]; }
+
+  /// all points, indexed by vertex
+  const std::vector<Point>& points() const { return points_; }
+
+  //@}
+
+
+  /** \name Faces and corners */
+  //@{
+
+  /// number of corners of face _f
+  Index face_valence(Index _f) const
+  { return face_corners_[_f+1] - face_corners_[_f]; }
+
+  /// first corner of face _f
+  Index corner_begin(Index _f) const { return face_corners_[_f]; }
+
+  /// one past the last corner of face _f
+  Index corner_end(Index _f) const { return face_corners_[_f+1]; }
+
+  /// vertex of corner _c
+  Index corner_vertex(Index _c) const { return corner_vertex_[_c]; }
+
+  /// face of corner _c
+  Index corner_face(Index _c) const { return corner_face_[_c]; }
+
+  /// next corner in the face of _c
+  Index next_corner(Index _c) const
+  {
+    const Index f = corner_face_[_c];
+    return (_c+1 == face_corners_[f+1]) ? face_corners_[f] : _c+1;
+  }
+
+  /// previous corner in the face of _c
+  Index prev_corner(Index _c) const
+  {
+    const Index f = corner_face_[_c];
+    return (_c == face_corners_[f]) ? face_corners_[f+1]-1 : _c-1;
+  }
+
+  /// corner of the opposite halfedge, InvalidIndex at the boundary
+  Index opposite_corner(Index _c) const { return opposite_corner_[_c]; }
+
+  /// vertices of face _f
+  ConstIndexIter fv_begin(Index _f) const
+  { return begin(corner_vertex_, face_corners_[_f]); }
+
+  ConstIndexIter fv_end(Index _f) const
+  { return begin(corner_vertex_, face_corners_[_f+1]); }
+
+  //@}
+
+
+  /** \name Vertex one-rings */
+  //@{
+
+  /// number of neighbors of vertex _v
+  Index valence(Index _v) const
+  { return vertex_neighbors_[_v+1] - vertex_neighbors_[_v]; }
+
+  /// is _v a boundary vertex of the source mesh?
+  bool is_boundary(Index _v) const { return boundary_[_v] != 0; }
+
+  /// neighbor vertices of _v
+  ConstIndexIter vv_begin(Index _v) const
+  { return begin(neighbors_, vertex_neighbors_[_v]); }
+
+  ConstIndexIter vv_end(Index _v) const
+  { return begin(neighbors_, vertex_neighbors_[_v+1]); }
+
+  /// corners of _v in its incident faces, see corner_face()
+  ConstIndexIter vc_begin(Index _v) const
+  { return begin(corners_, vertex_corners_[_v]); }
+
+  ConstIndexIter vc_end(Index _v) const
+  { return begin(corners_, vertex_corners_[_v+1]); }
+
+  //@}
+
+
+  /** \name Attribute columns */
+  //@{
+
+  /** Copy vertex property _ph of _mesh to _column (indexed by vertex).
+      The column is filled in parallel, so T must not be bool with OpenMP
+      (std::vector<bool> is not thread safe for concurrent writes). */
+  template <typename T>
+  void copy_vertex_property(const Mesh& _mesh, VPropHandleT<T> _ph,
+                            std::vector<T>& _column) const;
+
+  /// copy face property _ph of _mesh to _column (indexed by face), see above
+  template <typename T>
+  void copy_face_property(const Mesh& _mesh, FPropHandleT<T> _ph,
+                          std::vector<T>& _column) const;
+
+  //@}
+
+
+private:
+
+  // pointer to _list[_offset], valid for empty lists as well
+  static ConstIndexIter begin(const std::vector<Index>& _list, Index _offset)
+  { return _list.empty() ? 0 : &_list[0] + _offset; }
+
+  // convert counts in _offsets[1..n] to offsets
+  static void prefix_sum(std::vector<Index>& _offsets);
+
+
+  // mapping
+  std::vector<int>    source_vertex_, source_face_;
+  std::vector<Index>  vertex_, face_;
+
+  // geometry
+  std::vector<Point>  points_;
+
+  // faces
+  std::vector<Index>  face_corners_;
+  std::vector<Index>  corner_vertex_, corner_face_, opposite_corner_;
+
+  // one-rings
+  std::vector<Index>          vertex_neighbors_, neighbors_;
+  std::vector<Index>          vertex_corners_,   corners_;
+  std::vector<unsigned char>  boundary_;
+};
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_FROZENMESH_C)
+#define OPENMESH_FROZENMESH_TEMPLATES
+#include "FrozenMeshT.cc"
+#endif
+//=============================================================================
+#endif // OPENMESH_FROZENMESH_HH defined
+//=============================================================================
+
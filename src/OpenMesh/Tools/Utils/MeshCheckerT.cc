@@ -47,6 +47,9 @@
 
 
 #include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
+#ifdef USE_OPENMP
+#  include <omp.h>
+#endif
 
 
 //== NAMESPACES ============================================================== 
@@ -61,169 +64,363 @@ namespace Utils {
 template <class Mesh>
 bool 
 MeshCheckerT<Mesh>::
-check(unsigned int _targets, std::ostream& _os)
+check(unsigned int _targets, std::ostream& _os) const
 {
-  bool  ok(true);
+  Errors errors;
 
+  bool ok = check(_targets, errors);
 
+  for (typename Errors::const_iterator e_it=errors.begin();
+       e_it!=errors.end(); ++e_it)
+    print(*e_it, _os);
+
+  return ok;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool 
+MeshCheckerT<Mesh>::
+check(unsigned int _targets, Errors& _errors) const
+{
+  const size_t n_errors = _errors.size();
+
+  if (_targets & CHECK_VERTICES)
+    check_range<typename Mesh::VertexHandle>(0, _errors);
+
+  if (_targets & CHECK_EDGES)
+    check_range<typename Mesh::HalfedgeHandle>(0, _errors);
+
+  if (_targets & CHECK_FACES)
+    check_range<typename Mesh::FaceHandle>(0, _errors);
+
+  return _errors.size() == n_errors;
+}
 
-  //--- vertex checks ---
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool 
+MeshCheckerT<Mesh>::
+check(unsigned int _targets, Errors& _errors, const Mark& _since) const
+{
+  const size_t n_errors = _errors.size();
+
+  std::vector<unsigned char> vertices, halfedges, faces;
+  changed_since(_since, vertices, halfedges, faces);
 
   if (_targets & CHECK_VERTICES)
+    check_range<typename Mesh::VertexHandle>(&vertices, _errors);
+
+  if (_targets & CHECK_EDGES)
+    check_range<typename Mesh::HalfedgeHandle>(&halfedges, _errors);
+
+  if (_targets & CHECK_FACES)
+    check_range<typename Mesh::FaceHandle>(&faces, _errors);
+
+  return _errors.size() == n_errors;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename MeshCheckerT<Mesh>::Mark
+MeshCheckerT<Mesh>::
+mark() const
+{
+  const int nv(mesh_.n_vertices()), nh(mesh_.n_halfedges()), nf(mesh_.n_faces());
+  Mark m;
+
+  m.vertex_halfedge_.resize(nv);
+  for (int i=0; i<nv; ++i)
+    m.vertex_halfedge_[i] = mesh_.halfedge_handle(typename Mesh::VertexHandle(i)).idx();
+
+  m.halfedge_next_.resize(nh);
+  m.halfedge_vertex_.resize(nh);
+  m.halfedge_face_.resize(nh);
+  for (int i=0; i<nh; ++i)
+  {
+    typename Mesh::HalfedgeHandle hh(i);
+    m.halfedge_next_[i]   = mesh_.next_halfedge_handle(hh).idx();
+    m.halfedge_vertex_[i] = mesh_.to_vertex_handle(hh).idx();
+    m.halfedge_face_[i]   = mesh_.face_handle(hh).idx();
+  }
+
+  m.face_halfedge_.resize(nf);
+  for (int i=0; i<nf; ++i)
+    m.face_halfedge_[i] = mesh_.halfedge_handle(typename Mesh::FaceHandle(i)).idx();
+
+  return m;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+MeshCheckerT<Mesh>::
+changed_since(const Mark& _since,
+              std::vector<unsigned char>& _vertices,
+              std::vector<unsigned char>& _halfedges,
+              std::vector<unsigned char>& _faces) const
+{
+  const int nv(mesh_.n_vertices()), nh(mesh_.n_halfedges()), nf(mesh_.n_faces());
+
+  _vertices.assign(nv, 0);
+  _halfedges.assign(nh, 0);
+  _faces.assign(nf, 0);
+
+  // vertices and faces with a new or changed halfedge
+  for (int i=0; i<nv; ++i)
+    if (i >= int(_since.vertex_halfedge_.size()) ||
+        _since.vertex_halfedge_[i] !=
+        mesh_.halfedge_handle(typename Mesh::VertexHandle(i)).idx())
+      _vertices[i] = 1;
+
+  for (int i=0; i<nf; ++i)
+    if (i >= int(_since.face_halfedge_.size()) ||
+        _since.face_halfedge_[i] !=
+        mesh_.halfedge_handle(typename Mesh::FaceHandle(i)).idx())
+      _faces[i] = 1;
+
+  // new or changed halfedges, their neighbors and their vertices and faces,
+  // before and after the change
+  for (int i=0; i<nh; ++i)
   {
-    typename Mesh::ConstVertexIter v_it(mesh_.vertices_begin()), 
-                                   v_end(mesh_.vertices_end());
-    typename Mesh::VertexHandle    vh;
-    typename Mesh::ConstVertexVertexIter vv_it;
-    typename Mesh::HalfedgeHandle  heh;
-    unsigned int                   count;
-    const unsigned int             max_valence(10000);
+    typename Mesh::HalfedgeHandle hh(i);
+
+    const int next   = mesh_.next_halfedge_handle(hh).idx();
+    const int vertex = mesh_.to_vertex_handle(hh).idx();
+    const int face   = mesh_.face_handle(hh).idx();
+
+    const bool is_new = (i >= int(_since.halfedge_next_.size()));
+
+    if (!is_new &&
+        _since.halfedge_next_[i]   == next   &&
+        _since.halfedge_vertex_[i] == vertex &&
+        _since.halfedge_face_[i]   == face)
+      continue;
 
+    const int opposite = mesh_.opposite_halfedge_handle(hh).idx();
+    const int from     = mesh_.to_vertex_handle(
+                           typename Mesh::HalfedgeHandle(opposite)).idx();
 
-    for (; v_it != v_end; ++v_it)
+    _halfedges[i]        = 1;
+    _halfedges[opposite] = 1;
+    if (next >= 0)   _halfedges[next] = 1;
+    if (vertex >= 0) _vertices[vertex] = 1;
+    if (from >= 0)   _vertices[from] = 1;
+    if (face >= 0)   _faces[face] = 1;
+
+    if (!is_new)
     {
-      if (!is_deleted(v_it))
-      {
-	vh = v_it.handle();
-
-
-      /* The outgoing halfedge of a boundary vertex has to be a 
-	 boundary halfedge */
-	heh = mesh_.halfedge_handle(vh);
-	if (heh.is_valid() && !mesh_.is_boundary(heh))
-	{
-	  for (typename Mesh::ConstVertexOHalfedgeIter vh_it(mesh_, vh);
-	       vh_it; ++vh_it)
-	  {
-	    if (mesh_.is_boundary(vh_it.handle()))
-	    {
-	      _os << "MeshChecker: vertex " << vh
-		  << ": outgoing halfedge not on boundary error\n";
-	      ok = false;
-	    }
-	  }
-	}
-
-      
-      
-	// outgoing halfedge has to refer back to vertex
-	if (mesh_.halfedge_handle(vh).is_valid() &&
-	    mesh_.from_vertex_handle(mesh_.halfedge_handle(vh)) != vh)
-	{
-	  _os << "MeshChecker: vertex " << vh
-	      << ": outgoing halfedge does not reference vertex\n";
-	  ok = false;
-	}
-
-
-	// check whether circulators are still in order
-	vv_it = mesh_.cvv_iter(vh);
-	for (count=0; vv_it && (count < max_valence); ++vv_it, ++count) {};
-	if (count == max_valence)
-	{
-	  _os << "MeshChecker: vertex " << vh
-	      << ": ++circulator problem, one ring corrupt\n";
-	  ok = false;
-	}
-	vv_it = mesh_.cvv_iter(vh);
-	for (count=0; vv_it && (count < max_valence); --vv_it, ++count) {};
-	if (count == max_valence)
-	{
-	  _os << "MeshChecker: vertex " << vh
-	      << ": --circulator problem, one ring corrupt\n";
-	  ok = false;
-	}
-      }
+      const int old_next   = _since.halfedge_next_[i];
+      const int old_vertex = _since.halfedge_vertex_[i];
+      const int old_face   = _since.halfedge_face_[i];
+
+      if (old_next >= 0 && old_next < nh)     _halfedges[old_next] = 1;
+      if (old_vertex >= 0 && old_vertex < nv) _vertices[old_vertex] = 1;
+      if (old_face >= 0 && old_face < nf)     _faces[old_face] = 1;
     }
   }
+}
 
 
+//-----------------------------------------------------------------------------
 
-  //--- halfedge checks ---
 
-  if (_targets & CHECK_EDGES)
+template <class Mesh>
+template <class Handle>
+void
+MeshCheckerT<Mesh>::
+check_range(const std::vector<unsigned char>* _dirty, Errors& _errors) const
+{
+  const int n = n_elements(Handle());
+
+#ifdef USE_OPENMP
+  // With a static schedule thread t gets the t-th block of indices, so
+  // concatenating the per thread results keeps the index order.
+  std::vector<Errors> errors(omp_get_max_threads());
+
+  #pragma omp parallel for schedule(static)
+  for (int i=0; i<n; ++i)
   {
-    typename Mesh::ConstHalfedgeIter  h_it(mesh_.halfedges_begin()), 
-                                      h_end(mesh_.halfedges_end());
-    typename Mesh::HalfedgeHandle     hh, hstart, hhh;
-    unsigned int                      count, n_halfedges = 2*mesh_.n_edges();
+    if ((!_dirty || (*_dirty)[i]) && !is_deleted(Handle(i)))
+      check_element(Handle(i), errors[omp_get_thread_num()]);
+  }
 
-    for (; h_it != h_end; ++h_it)
-    {
-      if (!is_deleted(mesh_.edge_handle(h_it.handle())))
-      {
-	hh = h_it.handle();
-
-
-	// degenerated halfedge ?
-	if (mesh_.from_vertex_handle(hh) == mesh_.to_vertex_handle(hh))
-	{
-	  _os << "MeshChecker: halfedge " << hh
-	      << ": to-vertex == from-vertex\n";
-	  ok = false;
-	}
-
-
-	// next <-> prev check
-	if (mesh_.next_halfedge_handle(mesh_.prev_halfedge_handle(hh)) != hh)
-	{
-	  _os << "MeshChecker: halfedge " << hh
-	      << ": prev->next != this\n";
-	  ok = false;
-	}
-
-
-	// halfedges should form a cycle
-	count=0; hstart=hhh=hh;
-	do 
-	{
-	  hhh = mesh_.next_halfedge_handle(hhh);
-	  ++count;
-	} while (hhh != hstart && count < n_halfedges);
-
-	if (count == n_halfedges)
-	{
-	  _os << "MeshChecker: halfedges starting from " << hh
-	      << " do not form a cycle\n";
-	  ok = false;
-	}
-      }
-    }
+  for (size_t t=0; t<errors.size(); ++t)
+    _errors.insert(_errors.end(), errors[t].begin(), errors[t].end());
+#else
+  for (int i=0; i<n; ++i)
+  {
+    if ((!_dirty || (*_dirty)[i]) && !is_deleted(Handle(i)))
+      check_element(Handle(i), _errors);
   }
+#endif
+}
 
 
+//-----------------------------------------------------------------------------
 
-  //--- face checks ---
 
-  if (_targets & CHECK_FACES)
+template <class Mesh>
+void
+MeshCheckerT<Mesh>::
+check_element(typename Mesh::VertexHandle _vh, Errors& _errors) const
+{
+  typename Mesh::ConstVertexVertexIter vv_it;
+  typename Mesh::HalfedgeHandle        heh;
+  unsigned int                         count;
+  const unsigned int                   max_valence(10000);
+
+
+  /* The outgoing halfedge of a boundary vertex has to be a 
+     boundary halfedge */
+  heh = mesh_.halfedge_handle(_vh);
+  if (heh.is_valid() && !mesh_.is_boundary(heh))
   {
-    typename Mesh::ConstFaceIter          f_it(mesh_.faces_begin()), 
-                                          f_end(mesh_.faces_end());
-    typename Mesh::FaceHandle             fh;
-    typename Mesh::ConstFaceHalfedgeIter  fh_it;
-    
-    for (; f_it != f_end; ++f_it)
+    for (typename Mesh::ConstVertexOHalfedgeIter vh_it(mesh_, _vh);
+         vh_it; ++vh_it)
     {
-      if (!is_deleted(f_it))
-      {
-	fh = f_it.handle();
-
-	for (fh_it=mesh_.cfh_iter(fh); fh_it; ++fh_it)
-	{
-	  if (mesh_.face_handle(fh_it.handle()) != fh)
-	  {
-	    _os << "MeshChecker: face " << fh
-		<< ": its halfedge does not reference face\n";
-	    ok = false;
-	  }
-	}
-      }
+      if (mesh_.is_boundary(vh_it.handle()))
+        _errors.push_back(Error(VERTEX_OUTGOING_NOT_BOUNDARY, _vh));
     }
   }
 
 
+  // outgoing halfedge has to refer back to vertex
+  if (mesh_.halfedge_handle(_vh).is_valid() &&
+      mesh_.from_vertex_handle(mesh_.halfedge_handle(_vh)) != _vh)
+  {
+    _errors.push_back(Error(VERTEX_OUTGOING_REFERENCE, _vh));
+  }
+
+
+  // check whether circulators are still in order
+  vv_it = mesh_.cvv_iter(_vh);
+  for (count=0; vv_it && (count < max_valence); ++vv_it, ++count) {};
+  if (count == max_valence)
+    _errors.push_back(Error(VERTEX_CIRCULATOR_FORWARD, _vh));
 
-  return ok;
+  vv_it = mesh_.cvv_iter(_vh);
+  for (count=0; vv_it && (count < max_valence); --vv_it, ++count) {};
+  if (count == max_valence)
+    _errors.push_back(Error(VERTEX_CIRCULATOR_BACKWARD, _vh));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+MeshCheckerT<Mesh>::
+check_element(typename Mesh::HalfedgeHandle _hh, Errors& _errors) const
+{
+  typename Mesh::HalfedgeHandle hstart, hhh;
+  unsigned int                  count, n_halfedges = 2*mesh_.n_edges();
+
+
+  // degenerated halfedge ?
+  if (mesh_.from_vertex_handle(_hh) == mesh_.to_vertex_handle(_hh))
+    _errors.push_back(Error(HALFEDGE_DEGENERATED, _hh));
+
+
+  // next <-> prev check
+  if (mesh_.next_halfedge_handle(mesh_.prev_halfedge_handle(_hh)) != _hh)
+    _errors.push_back(Error(HALFEDGE_PREV_NEXT, _hh));
+
+
+  // halfedges should form a cycle
+  count=0; hstart=hhh=_hh;
+  do 
+  {
+    hhh = mesh_.next_halfedge_handle(hhh);
+    ++count;
+  } while (hhh != hstart && count < n_halfedges);
+
+  if (count == n_halfedges)
+    _errors.push_back(Error(HALFEDGE_NO_CYCLE, _hh));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+MeshCheckerT<Mesh>::
+check_element(typename Mesh::FaceHandle _fh, Errors& _errors) const
+{
+  typename Mesh::ConstFaceHalfedgeIter fh_it;
+
+  for (fh_it=mesh_.cfh_iter(_fh); fh_it; ++fh_it)
+  {
+    if (mesh_.face_handle(fh_it.handle()) != _fh)
+      _errors.push_back(Error(FACE_HALFEDGE_REFERENCE, _fh));
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+MeshCheckerT<Mesh>::
+print(const Error& _error, std::ostream& _os)
+{
+  switch (_error.type)
+  {
+    case VERTEX_OUTGOING_NOT_BOUNDARY:
+      _os << "MeshChecker: vertex " << _error.vh
+          << ": outgoing halfedge not on boundary error\n";
+      break;
+
+    case VERTEX_OUTGOING_REFERENCE:
+      _os << "MeshChecker: vertex " << _error.vh
+          << ": outgoing halfedge does not reference vertex\n";
+      break;
+
+    case VERTEX_CIRCULATOR_FORWARD:
+      _os << "MeshChecker: vertex " << _error.vh
+          << ": ++circulator problem, one ring corrupt\n";
+      break;
+
+    case VERTEX_CIRCULATOR_BACKWARD:
+      _os << "MeshChecker: vertex " << _error.vh
+          << ": --circulator problem, one ring corrupt\n";
+      break;
+
+    case HALFEDGE_DEGENERATED:
+      _os << "MeshChecker: halfedge " << _error.hh
+          << ": to-vertex == from-vertex\n";
+      break;
+
+    case HALFEDGE_PREV_NEXT:
+      _os << "MeshChecker: halfedge " << _error.hh
+          << ": prev->next != this\n";
+      break;
+
+    case HALFEDGE_NO_CYCLE:
+      _os << "MeshChecker: halfedges starting from " << _error.hh
+          << " do not form a cycle\n";
+      break;
+
+    case FACE_HALFEDGE_REFERENCE:
+      _os << "MeshChecker: face " << _error.fh
+          << ": its halfedge does not reference face\n";
+      break;
+  }
 }
 
 
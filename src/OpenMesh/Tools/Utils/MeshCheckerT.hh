@@ -51,7 +51,9 @@
 #include <OpenMesh/Core/System/omstream.hh>
 #include <OpenMesh/Core/Utils/GenProg.hh>
 #include <OpenMesh/Core/Mesh/Attributes.hh>
+#include <OpenMesh/Core/Mesh/Handles.hh>
 #include <iostream>
+#include <vector>
 
 
 //== NAMESPACES ===============================================================
@@ -66,6 +68,16 @@ namespace Utils {
 /** Check integrity of mesh.
  *
  *  This class provides several functions to check the integrity of a mesh.
+ *
+ *  The elements are checked in parallel if OpenMesh has been built with
+ *  OpenMP. All violations are collected, check(unsigned int, Errors&)
+ *  returns them as a list of Error records in the order of the element
+ *  indices.
+ *
+ *  For incremental validation, take a Mark of a valid mesh with mark().
+ *  check(unsigned int, Errors&, const Mark&) then only checks the elements
+ *  whose connectivity changed or that were added since the mark, plus
+ *  their direct neighbors.
  */
 template <class Mesh>
 class MeshCheckerT
@@ -88,23 +100,119 @@ public:
     CHECK_ALL       = 255,
   };
 
+
+  /// kinds of violations
+  enum ErrorType
+  {
+    VERTEX_OUTGOING_NOT_BOUNDARY, ///< outgoing halfedge of boundary vertex is not a boundary halfedge
+    VERTEX_OUTGOING_REFERENCE,    ///< outgoing halfedge does not reference vertex
+    VERTEX_CIRCULATOR_FORWARD,    ///< ++circulator does not terminate, one ring corrupt
+    VERTEX_CIRCULATOR_BACKWARD,   ///< --circulator does not terminate, one ring corrupt
+    HALFEDGE_DEGENERATED,         ///< to-vertex == from-vertex
+    HALFEDGE_PREV_NEXT,           ///< prev->next != this
+    HALFEDGE_NO_CYCLE,            ///< next halfedges do not form a cycle
+    FACE_HALFEDGE_REFERENCE       ///< halfedge of face does not reference face
+  };
+
+
+  /// A single violation. Only the handle of the checked element is valid.
+  struct Error
+  {
+    Error(ErrorType _type, typename Mesh::VertexHandle _vh)
+      : type(_type), vh(_vh) {}
+    Error(ErrorType _type, typename Mesh::HalfedgeHandle _hh)
+      : type(_type), hh(_hh) {}
+    Error(ErrorType _type, typename Mesh::FaceHandle _fh)
+      : type(_type), fh(_fh) {}
+
+    ErrorType                     type;
+    typename Mesh::VertexHandle   vh;
+    typename Mesh::HalfedgeHandle hh;
+    typename Mesh::FaceHandle     fh;
+  };
+
+  typedef std::vector<Error> Errors;
+
+
+  /** Connectivity of the mesh at the time mark() was called.
+   *  It stores one index per vertex and face and three per halfedge.
+   */
+  class Mark
+  {
+  public:
+    Mark() {}
+
+  private:
+    friend class MeshCheckerT<Mesh>;
+
+    std::vector<int> vertex_halfedge_;
+    std::vector<int> halfedge_next_;
+    std::vector<int> halfedge_vertex_;
+    std::vector<int> halfedge_face_;
+    std::vector<int> face_halfedge_;
+  };
+
   
-  /// check it, return true iff ok
+  /// check it, return true iff ok. Violations are written to _os.
   bool check( unsigned int _targets=CHECK_ALL,
-	      std::ostream&  _os= omerr());
+	      std::ostream&  _os= omerr()) const;
+
+  /// check it, return true iff ok. Violations are appended to _errors.
+  bool check( unsigned int _targets, Errors& _errors ) const;
+
+  /** Check only elements changed or added since _since (and their direct
+      neighbors), return true iff ok. Violations are appended to _errors.
+  */
+  bool check( unsigned int _targets, Errors& _errors,
+              const Mark& _since ) const;
+
+  /// Remember the current connectivity for check(unsigned int, Errors&, const Mark&)
+  Mark mark() const;
+
+  /// Write a violation in the format used by check(unsigned int, std::ostream&)
+  static void print( const Error& _error, std::ostream& _os );
 
 
 private:
 
-  bool is_deleted(typename Mesh::VertexHandle _vh) 
+  bool is_deleted(typename Mesh::VertexHandle _vh) const
   { return (mesh_.has_vertex_status() ? mesh_.status(_vh).deleted() : false); }
 
-  bool is_deleted(typename Mesh::EdgeHandle _eh) 
+  bool is_deleted(typename Mesh::EdgeHandle _eh) const
   { return (mesh_.has_edge_status() ? mesh_.status(_eh).deleted() : false); }
 
-  bool is_deleted(typename Mesh::FaceHandle _fh) 
+  bool is_deleted(typename Mesh::FaceHandle _fh) const
   { return (mesh_.has_face_status() ? mesh_.status(_fh).deleted() : false); }
 
+  bool is_deleted(typename Mesh::HalfedgeHandle _hh) const
+  { return ((mesh_.has_halfedge_status() && mesh_.status(_hh).deleted()) ||
+            is_deleted(mesh_.edge_handle(_hh))); }
+
+  int n_elements(typename Mesh::VertexHandle) const
+  { return int(mesh_.n_vertices()); }
+
+  int n_elements(typename Mesh::HalfedgeHandle) const
+  { return int(mesh_.n_halfedges()); }
+
+  int n_elements(typename Mesh::FaceHandle) const
+  { return int(mesh_.n_faces()); }
+
+  // checks of a single element, append violations to _errors
+  void check_element(typename Mesh::VertexHandle _vh, Errors& _errors) const;
+  void check_element(typename Mesh::HalfedgeHandle _hh, Errors& _errors) const;
+  void check_element(typename Mesh::FaceHandle _fh, Errors& _errors) const;
+
+  // check all elements of type Handle (or those with _dirty set) in parallel
+  template <class Handle>
+  void check_range(const std::vector<unsigned char>* _dirty,
+                   Errors& _errors) const;
+
+  // flag elements changed since _since and their neighbors
+  void changed_since(const Mark& _since,
+                     std::vector<unsigned char>& _vertices,
+                     std::vector<unsigned char>& _halfedges,
+                     std::vector<unsigned char>& _faces) const;
+
 
   // ref to mesh
   const Mesh&  mesh_;
@@ -0,0 +1,379 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#define OPENMESH_RENDERBUFFER_C
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Tools/Utils/RenderBufferT.hh>
+#include <OpenMesh/Core/Utils/color_cast.hh>
+#include <cstring>
+#ifdef USE_OPENMP
+#  include <omp.h>
+#endif
+
+
+//== NAMESPACES ============================================================== 
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== IMPLEMENTATION ========================================================== 
+
+
+template <class Mesh>
+void
+RenderBufferT<Mesh>::
+build(const Mesh& _mesh, unsigned int _attributes)
+{
+  // layout
+
+  attributes_ = 0;
+
+  if ((_attributes & NORMALS) &&
+      (_mesh.has_halfedge_normals() || _mesh.has_vertex_normals() ||
+       _mesh.has_face_normals()))
+    attributes_ |= NORMALS;
+
+  if ((_attributes & TEXCOORDS) &&
+      (_mesh.has_halfedge_texcoords2D() || _mesh.has_vertex_texcoords2D()))
+    attributes_ |= TEXCOORDS;
+
+  if ((_attributes & FACE_COLORS) && _mesh.has_face_colors())
+    attributes_ |= FACE_COLORS;
+  else if ((_attributes & VERTEX_COLORS) && _mesh.has_vertex_colors())
+    attributes_ |= VERTEX_COLORS;
+
+  stride_ = 3*sizeof(float);
+  normal_offset_ = texcoord_offset_ = color_offset_ = -1;
+
+  if (attributes_ & NORMALS)
+  {
+    normal_offset_ = stride_;
+    stride_ += 3*sizeof(float);
+  }
+  if (attributes_ & TEXCOORDS)
+  {
+    texcoord_offset_ = stride_;
+    stride_ += 2*sizeof(float);
+  }
+  if (attributes_ & (VERTEX_COLORS | FACE_COLORS))
+  {
+    color_offset_ = stride_;
+    stride_ += 4;
+  }
+
+  const unsigned int attr_size = stride_ - 3*sizeof(float);
+
+
+  // group the corners of each vertex by their attributes, the groups are
+  // numbered in the order of their first corner
+
+  const int n_vertices  = int(_mesh.n_vertices());
+  const int n_faces     = int(_mesh.n_faces());
+
+  corner_vertex_.assign(_mesh.n_halfedges(), unsigned(-1));
+
+  std::vector<unsigned int> vertex_first(n_vertices+1, 0);
+
+#ifdef USE_OPENMP
+#pragma omp parallel
+#endif
+  {
+    std::vector<unsigned char> groups;
+    std::vector<unsigned char> record(stride_);
+    const unsigned char*       attr = &record[0] + 3*sizeof(float);
+
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (int v=0; v<n_vertices; ++v)
+    {
+      const VertexHandle vh(v);
+      if (_mesh.has_vertex_status() && _mesh.status(vh).deleted())
+        continue;
+
+      unsigned int n_groups(0);
+      groups.clear();
+
+      for (typename Mesh::ConstVertexIHalfedgeIter vih_it = _mesh.cvih_iter(vh);
+           vih_it; ++vih_it)
+      {
+        const HalfedgeHandle heh = vih_it.handle();
+        if (!is_corner(_mesh, heh))
+          continue;
+
+        write_attributes(_mesh, heh, &record[0]);
+
+        unsigned int g(0);
+        while (g < n_groups && attr_size != 0 &&
+               std::memcmp(&groups[g*attr_size], attr, attr_size) != 0)
+          ++g;
+
+        if (g == n_groups)
+        {
+          groups.insert(groups.end(), attr, attr + attr_size);
+          ++n_groups;
+        }
+
+        corner_vertex_[heh.idx()] = g;
+      }
+
+      vertex_first[v+1] = n_groups;
+    }
+  }
+
+  for (int v=0; v<n_vertices; ++v)
+    vertex_first[v+1] += vertex_first[v];
+
+
+  // write one buffer vertex per group
+
+  const unsigned int n_buffer_vertices = vertex_first[n_vertices];
+
+  vertices_.resize(n_buffer_vertices * stride_);
+  source_vertex_.resize(n_buffer_vertices);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int v=0; v<n_vertices; ++v)
+  {
+    if (vertex_first[v] == vertex_first[v+1])
+      continue;
+
+    const VertexHandle vh(v);
+    unsigned int       next_group(0);
+
+    for (typename Mesh::ConstVertexIHalfedgeIter vih_it = _mesh.cvih_iter(vh);
+         vih_it; ++vih_it)
+    {
+      const HalfedgeHandle heh = vih_it.handle();
+      if (!is_corner(_mesh, heh))
+        continue;
+
+      const unsigned int g   = corner_vertex_[heh.idx()];
+      const unsigned int idx = vertex_first[v] + g;
+
+      corner_vertex_[heh.idx()] = idx;
+
+      // first corner of its group
+      if (g == next_group)
+      {
+        unsigned char* dst = &vertices_[idx * stride_];
+        write_position(_mesh, vh, dst);
+        write_attributes(_mesh, heh, dst);
+        source_vertex_[idx] = v;
+        ++next_group;
+      }
+    }
+  }
+
+
+  // triangle fans of the faces
+
+  std::vector<unsigned int> face_first(n_faces+1, 0);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int f=0; f<n_faces; ++f)
+  {
+    const FaceHandle fh(f);
+    if (_mesh.has_face_status() && _mesh.status(fh).deleted())
+      continue;
+
+    unsigned int valence(0);
+    for (typename Mesh::ConstFaceHalfedgeIter fh_it = _mesh.cfh_iter(fh);
+         fh_it; ++fh_it)
+      ++valence;
+
+    face_first[f+1] = valence - 2;
+  }
+
+  for (int f=0; f<n_faces; ++f)
+    face_first[f+1] += face_first[f];
+
+  indices_.resize(3 * face_first[n_faces]);
+  source_face_.resize(face_first[n_faces]);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int f=0; f<n_faces; ++f)
+  {
+    if (face_first[f] == face_first[f+1])
+      continue;
+
+    HalfedgeHandle heh = _mesh.halfedge_handle(FaceHandle(f));
+
+    const unsigned int c0 = corner_vertex_[heh.idx()];
+    heh = _mesh.next_halfedge_handle(heh);
+
+    for (unsigned int t=face_first[f]; t<face_first[f+1]; ++t)
+    {
+      indices_[3*t]   = c0;
+      indices_[3*t+1] = corner_vertex_[heh.idx()];
+      heh = _mesh.next_halfedge_handle(heh);
+      indices_[3*t+2] = corner_vertex_[heh.idx()];
+      source_face_[t] = f;
+    }
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+RenderBufferT<Mesh>::
+update_positions(const Mesh& _mesh)
+{
+  const int n = int(n_vertices());
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int i=0; i<n; ++i)
+    write_position(_mesh, VertexHandle(source_vertex_[i]),
+                   &vertices_[i * stride_]);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+int
+RenderBufferT<Mesh>::
+offset(Attribute _attribute) const
+{
+  switch (_attribute)
+  {
+    case NORMALS:       return normal_offset_;
+    case TEXCOORDS:     return texcoord_offset_;
+    case VERTEX_COLORS:
+    case FACE_COLORS:   return (attributes_ & _attribute) ? color_offset_ : -1;
+  }
+  return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+RenderBufferT<Mesh>::
+is_corner(const Mesh& _mesh, HalfedgeHandle _heh) const
+{
+  const FaceHandle fh = _mesh.face_handle(_heh);
+  return fh.is_valid() &&
+         !(_mesh.has_face_status() && _mesh.status(fh).deleted());
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+RenderBufferT<Mesh>::
+write_position(const Mesh& _mesh, VertexHandle _vh, unsigned char* _dst) const
+{
+  const typename Mesh::Point& p = _mesh.point(_vh);
+  const float f[3] = { float(p[0]), float(p[1]), float(p[2]) };
+  std::memcpy(_dst, f, sizeof(f));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+RenderBufferT<Mesh>::
+write_attributes(const Mesh& _mesh, HalfedgeHandle _heh,
+                 unsigned char* _dst) const
+{
+  if (attributes_ & NORMALS)
+  {
+    typename Mesh::Normal n;
+    if (_mesh.has_halfedge_normals())
+      n = _mesh.normal(_heh);
+    else if (_mesh.has_vertex_normals())
+      n = _mesh.normal(_mesh.to_vertex_handle(_heh));
+    else
+      n = _mesh.normal(_mesh.face_handle(_heh));
+
+    const float f[3] = { float(n[0]), float(n[1]), float(n[2]) };
+    std::memcpy(_dst + normal_offset_, f, sizeof(f));
+  }
+
+  if (attributes_ & TEXCOORDS)
+  {
+    const typename Mesh::TexCoord2D& t = _mesh.has_halfedge_texcoords2D() ?
+      _mesh.texcoord2D(_heh) : _mesh.texcoord2D(_mesh.to_vertex_handle(_heh));
+
+    const float f[2] = { float(t[0]), float(t[1]) };
+    std::memcpy(_dst + texcoord_offset_, f, sizeof(f));
+  }
+
+  if (attributes_ & (VERTEX_COLORS | FACE_COLORS))
+  {
+    const Vec4uc c = (attributes_ & FACE_COLORS) ?
+      color_cast<Vec4uc>(_mesh.color(_mesh.face_handle(_heh))) :
+      color_cast<Vec4uc>(_mesh.color(_mesh.to_vertex_handle(_heh)));
+
+    std::memcpy(_dst + color_offset_, c.data(), 4);
+  }
+}
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
@@ -0,0 +1,194 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#ifndef OPENMESH_RENDERBUFFER_HH
+#define OPENMESH_RENDERBUFFER_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Mesh/Handles.hh>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Packed vertex and index buffers of a mesh, e.g. for OpenGL vertex
+ *  buffer objects.
+ *
+ *  build() converts the faces of a mesh into an interleaved vertex buffer
+ *  and a triangle index buffer with 32 bit indices (polygons are
+ *  triangulated as fans). Every buffer vertex holds
+ *  - the position (3 floats, offset 0),
+ *  - optionally the normal (3 floats),
+ *  - optionally the texture coordinate (2 floats),
+ *  - optionally the color (4 unsigned bytes, RGBA)
+ *
+ *  at the byte offsets given by offset(), stride() bytes apart.
+ *
+ *  Normals and texture coordinates are taken per corner from the halfedge
+ *  properties if the mesh has them, from the vertex properties otherwise
+ *  (normals from the face normals if there are no vertex normals). Colors
+ *  are taken from the vertices or, with FACE_COLORS, from the faces. A mesh
+ *  vertex is split into several buffer vertices only where its corners
+ *  differ in one of these attributes; the buffer vertices of a mesh vertex
+ *  are consecutive. Deleted faces and vertices without faces are skipped.
+ *
+ *  If only the positions of the mesh changed, update_positions() rewrites
+ *  them without rebuilding the buffers. All passes run in parallel if
+ *  OpenMesh has been built with OpenMP. No graphics API is used.
+ */
+template <class Mesh>
+class RenderBufferT
+{
+public:
+
+  /// optional vertex attributes
+  enum Attribute
+  {
+    NORMALS       = 1,
+    TEXCOORDS     = 2,
+    VERTEX_COLORS = 4,
+    FACE_COLORS   = 8
+  };
+
+
+  /// constructor, the buffers are empty
+  RenderBufferT() : attributes_(0), stride_(0) {}
+
+  /// destructor
+  ~RenderBufferT() {}
+
+
+  /** (Re)build the buffers for _mesh with the attributes in _attributes
+      (bitwise or of Attribute). Attributes the mesh does not have are
+      ignored, see attributes(). */
+  void build(const Mesh& _mesh, unsigned int _attributes);
+
+  /** Copy the current points of _mesh into the buffer. The connectivity of
+      _mesh must not have changed since build(). */
+  void update_positions(const Mesh& _mesh);
+
+
+  /// attributes present in the buffer
+  unsigned int attributes() const { return attributes_; }
+
+  /// size of a buffer vertex in bytes
+  unsigned int stride() const { return stride_; }
+
+  /// byte offset of _attribute in a buffer vertex, -1 if not present
+  int offset(Attribute _attribute) const;
+
+  /// number of buffer vertices
+  unsigned int n_vertices() const { return unsigned(source_vertex_.size()); }
+
+  /// number of triangles
+  unsigned int n_triangles() const { return unsigned(indices_.size() / 3); }
+
+  /// interleaved vertex data, n_vertices()*stride() bytes
+  const std::vector<unsigned char>& vertices() const { return vertices_; }
+
+  /// triangle indices into vertices(), 3*n_triangles() entries
+  const std::vector<unsigned int>& indices() const { return indices_; }
+
+
+  /// mesh vertex of buffer vertex _i
+  VertexHandle source_vertex(unsigned int _i) const
+  { return VertexHandle(source_vertex_[_i]); }
+
+  /// mesh face of triangle _t
+  FaceHandle source_face(unsigned int _t) const
+  { return FaceHandle(source_face_[_t]); }
+
+  /// buffer vertex of the corner of face(_heh) at to_vertex(_heh)
+  unsigned int buffer_vertex(HalfedgeHandle _heh) const
+  { return corner_vertex_[_heh.idx()]; }
+
+
+private:
+
+  // write the attributes (but not the position) of the corner _heh to the
+  // buffer vertex at _dst
+  void write_attributes(const Mesh& _mesh, HalfedgeHandle _heh,
+                        unsigned char* _dst) const;
+
+  // write the position of _vh to _dst
+  void write_position(const Mesh& _mesh, VertexHandle _vh,
+                      unsigned char* _dst) const;
+
+  // is the corner _heh part of the buffer?
+  bool is_corner(const Mesh& _mesh, HalfedgeHandle _heh) const;
+
+
+  unsigned int                attributes_;
+  unsigned int                stride_;
+  int                         normal_offset_, texcoord_offset_, color_offset_;
+
+  std::vector<unsigned char>  vertices_;
+  std::vector<unsigned int>   indices_;
+
+  std::vector<int>            source_vertex_, source_face_;
+  std::vector<unsigned int>   corner_vertex_;
+};
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_RENDERBUFFER_C)
+#define OPENMESH_RENDERBUFFER_TEMPLATES
+#include "RenderBufferT.cc"
+#endif
+//=============================================================================
+#endif // OPENMESH_RENDERBUFFER_HH defined
+//=============================================================================
+
@@ -0,0 +1,450 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/System/omstream.hh>
+#include <OpenMesh/Core/Geometry/VectorT.hh>
+#include <OpenMesh/Tools/Utils/TriangleOrder.hh>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+
+//== IMPLEMENTATION ==========================================================
+
+
+TriangleOrder::
+TriangleOrder(Index _cache_size)
+  : cache_size_(std::max(_cache_size, Index(3)))
+{
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+TriangleOrder::CacheStatistics
+TriangleOrder::
+simulate(const Indices& _indices, Index _n_vertices) const
+{
+  CacheStatistics stats;
+
+  // insertion time of each vertex into the FIFO, 0 = never
+  std::vector<Index> cache_time(_n_vertices, 0);
+  Index              time(0);
+
+  for (size_t i=0; i<_indices.size(); ++i)
+  {
+    const Index v = _indices[i];
+
+    if (cache_time[v] == 0)
+      ++stats.n_vertices;
+
+    if (cache_time[v] == 0 || time - cache_time[v] >= cache_size_)
+    {
+      cache_time[v] = ++time;
+      ++stats.n_misses;
+    }
+  }
+
+  stats.n_triangles = Index(_indices.size() / 3);
+
+  return stats;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+TriangleOrder::
+optimize_cache(Indices& _indices, Index _n_vertices)
+{
+  const Index n_triangles = Index(_indices.size() / 3);
+
+  triangle_order_.resize(n_triangles);
+  for (Index t=0; t<n_triangles; ++t)
+    triangle_order_[t] = t;
+
+  vertex_remap_.resize(_n_vertices);
+  for (Index v=0; v<_n_vertices; ++v)
+    vertex_remap_[v] = v;
+
+
+  // vertex -> triangle adjacency
+
+  Indices offsets(_n_vertices+1, 0);
+  for (size_t i=0; i<3*size_t(n_triangles); ++i)
+    ++offsets[_indices[i]+1];
+  for (Index v=0; v<_n_vertices; ++v)
+    offsets[v+1] += offsets[v];
+
+  Indices adjacency(3*size_t(n_triangles));
+  {
+    Indices fill(offsets.begin(), offsets.end()-1);
+    for (size_t i=0; i<3*size_t(n_triangles); ++i)
+      adjacency[fill[_indices[i]]++] = Index(i/3);
+  }
+
+
+  // Tipsify: fan around the current vertex, continue with the neighbor
+  // that stays longest in the cache
+
+  std::vector<int>           live(_n_vertices);
+  std::vector<Index>         cache_time(_n_vertices, 0);
+  std::vector<unsigned char> emitted(n_triangles, 0);
+  Indices                    dead_end, candidates, order;
+
+  for (Index v=0; v<_n_vertices; ++v)
+    live[v] = int(offsets[v+1] - offsets[v]);
+
+  order.reserve(n_triangles);
+  clusters_.clear();
+
+  Index time   = cache_size_ + 1;
+  Index cursor = 0;
+  int   fan    = -1;
+  bool  miss   = true;
+
+  while (cursor < _n_vertices && live[cursor] == 0)
+    ++cursor;
+  if (cursor < _n_vertices)
+    fan = int(cursor);
+
+  while (fan >= 0)
+  {
+    // a new cluster starts where the fanning vertex is not cached
+    if (miss)
+      clusters_.push_back(Index(order.size()));
+
+    candidates.clear();
+
+    for (Index k=offsets[fan]; k<offsets[fan+1]; ++k)
+    {
+      const Index t = adjacency[k];
+      if (emitted[t])
+        continue;
+
+      for (Index j=0; j<3; ++j)
+      {
+        const Index v = _indices[3*t+j];
+        dead_end.push_back(v);
+        candidates.push_back(v);
+        --live[v];
+        if (time - cache_time[v] > cache_size_)
+          cache_time[v] = time++;
+      }
+
+      emitted[t] = 1;
+      order.push_back(t);
+    }
+
+    // next fanning vertex: a live candidate that stays cached while its
+    // remaining triangles are emitted, the oldest one first
+    int best(-1), best_priority(-1);
+    for (size_t i=0; i<candidates.size(); ++i)
+    {
+      const Index v = candidates[i];
+      if (live[v] <= 0)
+        continue;
+
+      int priority(0);
+      if (time - cache_time[v] + 2*Index(live[v]) <= cache_size_)
+        priority = int(time - cache_time[v]);
+
+      if (priority > best_priority)
+      {
+        best_priority = priority;
+        best          = int(v);
+      }
+    }
+
+    // dead end: most recently referenced live vertex, else the next one
+    if (best < 0)
+    {
+      while (!dead_end.empty() && best < 0)
+      {
+        const Index v = dead_end.back();
+        dead_end.pop_back();
+        if (live[v] > 0)
+          best = int(v);
+      }
+    }
+    if (best < 0)
+    {
+      while (cursor < _n_vertices && live[cursor] == 0)
+        ++cursor;
+      if (cursor < _n_vertices)
+        best = int(cursor);
+    }
+
+    fan  = best;
+    miss = (best >= 0) && (time - cache_time[best] > cache_size_);
+  }
+
+  clusters_.push_back(n_triangles);
+
+  permute_triangles(_indices, order);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+TriangleOrder::
+optimize_overdraw(Indices& _indices, Index _n_vertices,
+                  const unsigned char* _points, unsigned int _stride,
+                  float _threshold)
+{
+  const Index n_triangles = Index(_indices.size() / 3);
+
+  if (clusters_.empty() || clusters_.back() != n_triangles)
+  {
+    omerr() << "TriangleOrder::optimize_overdraw: call optimize_cache() first\n";
+    return;
+  }
+
+
+  const double acmr = simulate(_indices, _n_vertices).acmr();
+
+
+  // split the clusters where the ACMR of the part so far is low enough,
+  // every part is simulated with an empty cache as the parts are reordered
+
+  Indices            clusters;
+  std::vector<Index> cache_time(_n_vertices, 0);
+  Index              time(0);
+
+  for (size_t c=0; c+1<clusters_.size(); ++c)
+  {
+    Index begin(clusters_[c]), n_misses(0);
+
+    clusters.push_back(begin);
+    time += cache_size_;
+
+    for (Index t=begin; t<clusters_[c+1]; ++t)
+    {
+      for (Index j=0; j<3; ++j)
+      {
+        const Index v = _indices[3*t+j];
+        if (cache_time[v] == 0 || time - cache_time[v] >= cache_size_)
+        {
+          cache_time[v] = ++time;
+          ++n_misses;
+        }
+      }
+
+      if (t+1 < clusters_[c+1] &&
+          double(n_misses) / double(t+1 - begin) < _threshold * acmr)
+      {
+        begin    = t+1;
+        n_misses = 0;
+        time    += cache_size_;
+        clusters.push_back(begin);
+      }
+    }
+  }
+  clusters.push_back(n_triangles);
+
+
+  // area weighted centroid and normal of the clusters and the mesh
+
+  const size_t n_clusters = clusters.size()-1;
+
+  std::vector<Vec3f> centroid(n_clusters, Vec3f(0,0,0));
+  std::vector<Vec3f> normal(n_clusters, Vec3f(0,0,0));
+  Vec3f              mesh_centroid(0,0,0);
+  float              mesh_area(0);
+
+  for (size_t c=0; c<n_clusters; ++c)
+  {
+    float area(0);
+
+    for (Index t=clusters[c]; t<clusters[c+1]; ++t)
+    {
+      Vec3f p[3];
+      for (Index j=0; j<3; ++j)
+        std::memcpy(p[j].data(), _points + size_t(_indices[3*t+j])*_stride,
+                    3*sizeof(float));
+
+      const Vec3f n = (p[1]-p[0]) % (p[2]-p[0]);
+      const float a = n.norm();
+
+      centroid[c] += (p[0]+p[1]+p[2]) * (a/3.0f);
+      normal[c]   += n;
+      area        += a;
+    }
+
+    mesh_centroid += centroid[c];
+    mesh_area     += area;
+
+    if (area > 0)
+      centroid[c] /= area;
+  }
+
+  if (mesh_area > 0)
+    mesh_centroid /= mesh_area;
+
+
+  // draw outward facing clusters first
+
+  std::vector< std::pair<float, Index> > keys(n_clusters);
+  for (size_t c=0; c<n_clusters; ++c)
+  {
+    const float length = normal[c].norm();
+    const float facing = (length > 0) ?
+      ((centroid[c] - mesh_centroid) | normal[c]) / length : 0.0f;
+
+    keys[c] = std::make_pair(-facing, Index(c));
+  }
+  std::stable_sort(keys.begin(), keys.end());
+
+  Indices order;
+  order.reserve(n_triangles);
+  clusters_.clear();
+
+  for (size_t i=0; i<n_clusters; ++i)
+  {
+    const Index c = keys[i].second;
+    clusters_.push_back(Index(order.size()));
+    for (Index t=clusters[c]; t<clusters[c+1]; ++t)
+      order.push_back(t);
+  }
+  clusters_.push_back(n_triangles);
+
+  permute_triangles(_indices, order);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+TriangleOrder::
+optimize_fetch(Indices& _indices, Index _n_vertices)
+{
+  const Index invalid = Index(-1);
+
+  Indices remap(_n_vertices, invalid);
+  Index   next(0);
+
+  for (size_t i=0; i<_indices.size(); ++i)
+  {
+    Index& v = remap[_indices[i]];
+    if (v == invalid)
+      v = next++;
+    _indices[i] = v;
+  }
+
+  for (Index v=0; v<_n_vertices; ++v)
+    if (remap[v] == invalid)
+      remap[v] = next++;
+
+  if (vertex_remap_.size() != _n_vertices)
+  {
+    vertex_remap_.resize(_n_vertices);
+    for (Index v=0; v<_n_vertices; ++v)
+      vertex_remap_[v] = v;
+  }
+
+  for (Index v=0; v<_n_vertices; ++v)
+    vertex_remap_[v] = remap[vertex_remap_[v]];
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+TriangleOrder::
+remap_vertices(std::vector<unsigned char>& _vertices,
+               unsigned int _stride) const
+{
+  std::vector<unsigned char> vertices(_vertices.size());
+
+  for (size_t v=0; v<vertex_remap_.size(); ++v)
+    std::memcpy(&vertices[size_t(vertex_remap_[v]) * _stride],
+                &_vertices[v * _stride], _stride);
+
+  _vertices.swap(vertices);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+TriangleOrder::
+permute_triangles(Indices& _indices, const Indices& _order)
+{
+  Indices indices(_indices.size());
+  Indices triangle_order(_order.size());
+
+  for (size_t i=0; i<_order.size(); ++i)
+  {
+    const Index t = _order[i];
+    indices[3*i]      = _indices[3*t];
+    indices[3*i+1]    = _indices[3*t+1];
+    indices[3*i+2]    = _indices[3*t+2];
+    triangle_order[i] = triangle_order_[t];
+  }
+
+  _indices.swap(indices);
+  triangle_order_.swap(triangle_order);
+}
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
@@ -0,0 +1,185 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+//=============================================================================
+//
+//  CLASS TriangleOrder
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_TRIANGLEORDER_HH
+#define OPENMESH_TRIANGLEORDER_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \class TriangleOrder TriangleOrder.hh <OpenMesh/Tools/Utils/TriangleOrder.hh>
+
+    Reorders an indexed triangle list (e.g. the index buffer of
+    RenderBufferT) for rendering:
+
+    - optimize_cache() orders the triangles for the post-transform vertex
+      cache (Tipsify, Sander et al. 2007, "Fast triangle reordering for
+      vertex locality and reduced overdraw"). The running time is linear in
+      the number of triangles and independent of the cache size.
+    - optimize_overdraw() then sorts clusters of the cache optimized order
+      so that triangles facing outwards are drawn first, which reduces
+      overdraw for most view directions.
+    - optimize_fetch() finally renumbers the vertices in the order of their
+      first use, which makes the vertex fetches sequential.
+
+    simulate() reports the average cache miss ratio per triangle (ACMR) and
+    per vertex (ATVR) of a FIFO cache.
+
+    The triangles keep their vertex order (and orientation).
+    triangle_order() and vertex_remap() give the permutations applied so
+    far, to reorder per triangle or per vertex data accordingly.
+*/
+class TriangleOrder
+{
+public:
+
+  typedef unsigned int            Index;
+  typedef std::vector<Index>      Indices;
+
+
+  /// result of simulate()
+  struct CacheStatistics
+  {
+    CacheStatistics() : n_misses(0), n_triangles(0), n_vertices(0) {}
+
+    /// average number of cache misses per triangle
+    double acmr() const
+    { return n_triangles ? double(n_misses) / n_triangles : 0.0; }
+
+    /// average number of cache misses per referenced vertex
+    double atvr() const
+    { return n_vertices ? double(n_misses) / n_vertices : 0.0; }
+
+    Index n_misses, n_triangles, n_vertices;
+  };
+
+
+  /// Constructor, _cache_size is the size of the FIFO vertex cache.
+  explicit TriangleOrder(Index _cache_size = 16);
+
+  /// Destructor
+  ~TriangleOrder() {}
+
+
+  /// size of the simulated vertex cache
+  Index cache_size() const { return cache_size_; }
+
+  /// Simulate the FIFO vertex cache for the triangle list _indices.
+  CacheStatistics simulate(const Indices& _indices, Index _n_vertices) const;
+
+
+  /** Reorder the triangles of _indices (referring to _n_vertices vertices)
+      for the vertex cache. Restarts the permutations. */
+  void optimize_cache(Indices& _indices, Index _n_vertices);
+
+  /** Reorder the clusters of the triangle order computed by
+      optimize_cache() (which must be called first) to reduce overdraw.
+
+      _points are the vertex positions (3 floats) at a distance of
+      _stride bytes. The clusters found by optimize_cache() are split
+      further where the ACMR of the part so far (simulated with an empty
+      cache) falls below _threshold times the ACMR of the whole list. A larger _threshold
+      gives more, smaller clusters and less overdraw but more cache misses.
+  */
+  void optimize_overdraw(Indices& _indices, Index _n_vertices,
+                         const unsigned char* _points, unsigned int _stride,
+                         float _threshold = 1.05f);
+
+  /** Renumber the vertices in the order of their first use in _indices.
+      Unused vertices are moved to the end. */
+  void optimize_fetch(Indices& _indices, Index _n_vertices);
+
+
+  /// triangle i of the result was triangle triangle_order()[i] of the input
+  const Indices& triangle_order() const { return triangle_order_; }
+
+  /// new index of each vertex after optimize_fetch() (identity before)
+  const Indices& vertex_remap() const { return vertex_remap_; }
+
+  /// Apply vertex_remap() to an interleaved vertex buffer.
+  void remap_vertices(std::vector<unsigned char>& _vertices,
+                      unsigned int _stride) const;
+
+
+private:
+
+  // apply the triangle permutation _order to _indices and triangle_order_
+  void permute_triangles(Indices& _indices, const Indices& _order);
+
+
+  Index    cache_size_;
+
+  Indices  triangle_order_;   // new -> old triangle
+  Indices  vertex_remap_;     // old -> new vertex
+  Indices  clusters_;         // first triangle of each cluster (+ end)
+};
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_TRIANGLEORDER_HH defined
+//=============================================================================
+
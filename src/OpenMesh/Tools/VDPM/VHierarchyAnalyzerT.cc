@@ -0,0 +1,635 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+//=============================================================================
+//
+//  CLASS VHierarchyAnalyzerT - IMPLEMENTATION
+//
+//=============================================================================
+
+#define OPENMESH_VDPROGMESH_VHIERARCHYANALYZERT_C
+
+
+//== INCLUDES =================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <OpenMesh/Core/Utils/vector_cast.hh>
+#include <OpenMesh/Tools/VDPM/VHierarchyAnalyzerT.hh>
+#ifdef USE_OPENMP
+#  include <omp.h>
+#endif
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace VDPM {
+
+//== IMPLEMENTATION ========================================================== 
+
+
+template <class Mesh>
+void
+VHierarchyAnalyzerT<Mesh>::
+analyze(const VertexSplitContainer& _vsplits)
+{
+  const int n_nodes = int(vhierarchy_.num_nodes());
+  int       i;
+
+  mesh_.request_face_normals();
+  mesh_.request_vertex_normals();
+  mesh_.update_face_normals();
+  mesh_.update_vertex_normals();
+
+  mesh_.add_property(node_handle_);
+  mesh_.add_property(leaf_node_handle_);
+
+  residual_.assign(n_nodes, Vec3f(0.0f, 0.0f, 0.0f));
+  bound_.assign(n_nodes, 0.0f);
+  angle_.assign(n_nodes, 0.0f);
+
+  // leaves: normal of the full resolution mesh, no error
+  for (i=0; i<n_nodes; ++i)
+  {
+    VHierarchyNodeHandle  node_handle(i);
+    VHierarchyNode&       node = vhierarchy_.node(node_handle);
+
+    if (!node.is_leaf())
+      continue;
+
+    mesh_.property(node_handle_, node.vertex_handle()) = node_handle;
+
+    node.set_normal(vector_cast<Vec3f>(mesh_.normal(node.vertex_handle())));
+    node.set_radius(0.0f);
+    node.set_semi_angle(0.0f);
+    node.set_mue(0.0f);
+    node.set_sigma(0.0f);
+  }
+
+  typename Mesh::HalfedgeIter h_it, h_end(mesh_.halfedges_end());
+  for (h_it=mesh_.halfedges_begin(); h_it!=h_end; ++h_it)
+    mesh_.property(leaf_node_handle_, h_it) =
+      mesh_.property(node_handle_, mesh_.to_vertex_handle(h_it));
+
+  // undo the refinements, finest first
+  for (i=int(_vsplits.size()); i>0; --i)
+    compute_local(collapse(_vsplits[i-1]));
+
+  // Split the forest into independent subtrees (level by level) ...
+  std::vector<VHierarchyNodeHandle>  subtrees, top, next;
+
+  for (i=0; i<int(vhierarchy_.num_roots()); ++i)
+    subtrees.push_back(vhierarchy_.root_handle(i));
+
+  for (bool expanded=true; expanded && subtrees.size() < 1024; subtrees.swap(next))
+  {
+    expanded = false;
+    next.clear();
+
+    for (size_t j=0; j<subtrees.size(); ++j)
+    {
+      if (vhierarchy_.is_leaf_node(subtrees[j]))
+        next.push_back(subtrees[j]);
+      else
+      {
+        top.push_back(subtrees[j]);
+        next.push_back(vhierarchy_.lchild_handle(subtrees[j]));
+        next.push_back(vhierarchy_.rchild_handle(subtrees[j]));
+        expanded = true;
+      }
+    }
+  }
+
+  // ... merge them in parallel, children before parents ...
+  const int n_subtrees = int(subtrees.size());
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (i=0; i<n_subtrees; ++i)
+  {
+    std::vector<VHierarchyNodeHandle>  stack(1, subtrees[i]), order;
+
+    while (!stack.empty())
+    {
+      VHierarchyNodeHandle node_handle = stack.back();
+      stack.pop_back();
+
+      if (!vhierarchy_.is_leaf_node(node_handle))
+      {
+        order.push_back(node_handle);
+        stack.push_back(vhierarchy_.lchild_handle(node_handle));
+        stack.push_back(vhierarchy_.rchild_handle(node_handle));
+      }
+    }
+
+    for (size_t j=order.size(); j>0; --j)
+      merge(order[j-1]);
+  }
+
+  // ... and finally the nodes above the subtrees
+  for (size_t j=top.size(); j>0; --j)
+    merge(top[j-1]);
+
+  mesh_.remove_property(node_handle_);
+  mesh_.remove_property(leaf_node_handle_);
+  mesh_.release_vertex_normals();
+  mesh_.release_face_normals();
+
+  std::vector<Vec3f>().swap(residual_);
+  std::vector<float>().swap(bound_);
+  std::vector<float>().swap(angle_);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+VHierarchyNodeHandle
+VHierarchyAnalyzerT<Mesh>::
+collapse(const VertexSplit& _vsplit)
+{
+  typename Mesh::HalfedgeHandle h, o, hn, op, hpo, on, ono;
+
+  h   = mesh_.find_halfedge(_vsplit.v0, _vsplit.v1);
+  o   = mesh_.opposite_halfedge_handle(h);
+  hn  = mesh_.next_halfedge_handle(h);
+  hpo = mesh_.opposite_halfedge_handle(mesh_.prev_halfedge_handle(h));
+  op  = mesh_.prev_halfedge_handle(o);
+  on  = mesh_.next_halfedge_handle(o);
+  ono = mesh_.opposite_halfedge_handle(on);
+
+  VHierarchyNodeHandle
+    rchild_handle = mesh_.property(node_handle_, _vsplit.v1),
+    parent_handle = vhierarchy_.parent_handle(rchild_handle);
+
+  // maintain leaf node handles & locate fundamental cut vertices
+  if (_vsplit.vl.is_valid())
+  {
+    VHierarchyNodeHandle
+      fund_lcut_handle = mesh_.property(leaf_node_handle_, hn),
+      left_leaf_handle = mesh_.property(leaf_node_handle_, hpo);
+
+    mesh_.property(leaf_node_handle_, hn) = left_leaf_handle;
+
+    vhierarchy_.node(parent_handle).
+      set_fund_lcut(vhierarchy_.node_index(fund_lcut_handle));
+  }
+
+  if (_vsplit.vr.is_valid())
+  {
+    VHierarchyNodeHandle
+      fund_rcut_handle  = mesh_.property(leaf_node_handle_, on),
+      right_leaf_handle = mesh_.property(leaf_node_handle_, ono);
+
+    mesh_.property(leaf_node_handle_, op) = right_leaf_handle;
+
+    vhierarchy_.node(parent_handle).
+      set_fund_rcut(vhierarchy_.node_index(fund_rcut_handle));
+  }
+
+  mesh_.collapse(h);
+  mesh_.property(node_handle_, _vsplit.v1) = parent_handle;
+
+  return parent_handle;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+VHierarchyAnalyzerT<Mesh>::
+compute_local(VHierarchyNodeHandle _node_handle)
+{
+  VHierarchyNode&       node = vhierarchy_.node(_node_handle);
+  VertexHandle          vh   = node.vertex_handle();
+  VHierarchyNodeHandle  lchild_handle = node.lchild_handle();
+  VHierarchyNodeHandle  rchild_handle = node.rchild_handle();
+
+  // the faces around vh changed their shape
+  typename Mesh::VertexFaceIter vf_it;
+  for (vf_it=mesh_.vf_iter(vh); vf_it; ++vf_it)
+    mesh_.update_normal(vf_it.handle());
+
+  node.set_normal(vector_cast<Vec3f>(mesh_.calc_vertex_normal(vh)));
+
+  residual_[lchild_handle.idx()] = residual(point(lchild_handle), vh);
+  residual_[rchild_handle.idx()] = residual(point(rchild_handle), vh);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+VHierarchyAnalyzerT<Mesh>::
+merge(VHierarchyNodeHandle _node_handle)
+{
+  VHierarchyNode&  node = vhierarchy_.node(_node_handle);
+  const Vec3f      p    = point(_node_handle);
+  const Vec3f&     n    = node.normal();
+
+  VHierarchyNodeHandle children[2] =
+    { node.lchild_handle(), node.rchild_handle() };
+
+  float  radius(0.0f), angle(0.0f), bound(0.0f);
+  float  max_inner(0.0f), max_cross(0.0f);
+  int    c;
+
+  for (c=0; c<2; ++c)
+  {
+    const VHierarchyNode&  child = vhierarchy_.node(children[c]);
+    const int              idx   = children[c].idx();
+    const Vec3f&           res   = residual_[idx];
+
+    float cos_angle = std::max(-1.0f, std::min(1.0f, dot(n, child.normal())));
+
+    radius    = std::max(radius, (point(children[c]) - p).length() + child.radius());
+    angle     = std::max(angle,  acosf(cos_angle) + angle_[idx]);
+    bound     = std::max(bound,  res.length() + bound_[idx]);
+    max_inner = std::max(max_inner, fabsf(dot(res, n)) + bound_[idx]);
+    max_cross = std::max(max_cross, OpenMesh::cross(res, n).length() + bound_[idx]);
+  }
+
+  angle = std::min(angle, float(M_PI_2));
+
+  node.set_radius(radius);
+  node.set_semi_angle(angle);
+  angle_[_node_handle.idx()] = angle;
+  bound_[_node_handle.idx()] = bound;
+
+  // screen space error, see Hoppe: View-dependent refinement of PMs
+  if (max_cross < 1.0e-7)
+  {
+    node.set_mue(max_cross);
+    node.set_sigma(max_inner);
+  }
+  else
+  {
+    float  ratio = std::max(1.0f, max_inner/max_cross);
+    float  whole_degree = acosf(1.0f/ratio);
+    float  mue, max_mue(0.0f);
+
+    for (c=0; c<2; ++c)
+    {
+      const int     idx        = children[c].idx();
+      const Vec3f&  res        = residual_[idx];
+      const float   res_length = res.length();
+
+      if (bound_[idx] > 0.0f)
+      {
+        // the direction of the leaf residuals is unknown
+        mue = res_length + bound_[idx];
+      }
+      else if (res_length > 0.0f)
+      {
+        float degree = acosf(std::max(-1.0f, std::min(1.0f, dot(n,res) / res_length)));
+
+        if (degree > float(M_PI_2))  degree = float(M_PI) - degree;
+
+        if (degree < whole_degree)
+          mue = cosf(whole_degree - degree) * res_length;
+        else
+          mue = res_length;
+      }
+      else
+        mue = 0.0f;
+
+      max_mue = std::max(max_mue, mue);
+    }
+
+    node.set_mue(max_mue);
+    node.set_sigma(ratio*max_mue);
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+Vec3f
+VHierarchyAnalyzerT<Mesh>::
+residual(const Vec3f& _p, VertexHandle _vh) const
+{
+  Vec3f   res, tri[3];
+  Vec3f   result = _p - vector_cast<Vec3f>(mesh_.point(_vh));
+  float   min_distance = result.length();
+
+  typename Mesh::ConstVertexFaceIter vf_it;
+  for (vf_it=mesh_.cvf_iter(_vh); vf_it; ++vf_it)
+  {
+    typename Mesh::HalfedgeHandle heh = mesh_.halfedge_handle(vf_it.handle());
+    tri[0] = vector_cast<Vec3f>(mesh_.point(mesh_.to_vertex_handle(heh)));
+    heh    = mesh_.next_halfedge_handle(heh);
+    tri[1] = vector_cast<Vec3f>(mesh_.point(mesh_.to_vertex_handle(heh)));
+    heh    = mesh_.next_halfedge_handle(heh);
+    tri[2] = vector_cast<Vec3f>(mesh_.point(mesh_.to_vertex_handle(heh)));
+
+    res = point2triangle_residual(_p, tri);
+
+    if (res.length() < min_distance)
+    {
+      result       = res;
+      min_distance = res.length();
+    }
+  }
+
+  return result;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+Vec3f
+VHierarchyAnalyzerT<Mesh>::
+point(VHierarchyNodeHandle _node_handle) const
+{
+  return vector_cast<Vec3f>(mesh_.point(vhierarchy_.node(_node_handle).vertex_handle()));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+Vec3f
+VHierarchyAnalyzerT<Mesh>::
+point2triangle_residual(const Vec3f& _p, const Vec3f _tri[3])
+{
+  OpenMesh::Vec3f B = _tri[0];             // Tri.Origin();
+  OpenMesh::Vec3f E0 = _tri[1] - _tri[0];   // rkTri.Edge0()
+  OpenMesh::Vec3f E1 = _tri[2] - _tri[0];   // rkTri.Edge1()
+  OpenMesh::Vec3f D = _tri[0] - _p;         // kDiff
+  float  a = dot(E0, E0);                  // fA00
+  float  b = dot(E0, E1);                  // fA01
+  float  c = dot(E1, E1);                  // fA11
+  float  d = dot(E0, D);                   // fB0
+  float  e = dot(E1, D);                   // fB1
+  //float  f = dot(D, D);                    // fC
+  float s, t;
+  float det = fabsf(a*c - b*b);
+  s = b*e-c*d;
+  t = b*d-a*e;
+  
+  OpenMesh::Vec3f     residual;
+
+//  float distance2;
+
+  if ( s + t <= det )
+  {
+    if ( s < 0.0f )
+    {
+      if ( t < 0.0f )  // region 4
+      {
+        if ( d < 0.0f )
+        {
+          t = 0.0f;
+          if ( -d >= a )
+          {
+            s = 1.0f;
+//            distance2 = a+2.0f*d+f;
+          }
+          else
+          {
+            s = -d/a;
+//            distance2 = d*s+f;
+          }
+        }
+        else
+        {
+          s = 0.0f;
+          if ( e >= 0.0f )
+          {
+            t = 0.0f;
+//            distance2 = f;
+          }
+          else if ( -e >= c )
+          {
+            t = 1.0f;
+//            distance2 = c+2.0f*e+f;
+          }
+          else
+          {
+            t = -e/c;
+//            distance2 = e*t+f;
+          }
+        }
+      }
+      else  // region 3
+      {
+        s = 0.0f;
+        if ( e >= 0.0f )
+        {
+          t = 0.0f;
+//          distance2 = f;
+        }
+        else if ( -e >= c )
+        {
+          t = 1.0f;
+//          distance2 = c+2.0f*e+f;
+        }
+        else
+        {
+          t = -e/c;
+//          distance2 = e*t+f;
+        }
+      }
+    }
+    else if ( t < 0.0f )  // region 5
+    {
+      t = 0.0f;
+      if ( d >= 0.0f )
+      {
+        s = 0.0f;
+//        distance2 = f;
+      }
+      else if ( -d >= a )
+      {
+        s = 1.0f;
+//        distance2 = a+2.0f*d+f;
+      }
+      else
+      {
+        s = -d/a;
+//        distance2 = d*s+f;
+      }
+    }
+    else  // region 0
+    {
+      // minimum at interior point
+      float inv_det = 1.0f/det;
+      s *= inv_det;
+      t *= inv_det;
+//      distance2 = s*(a*s+b*t+2.0f*d) + t*(b*s+c*t+2.0f*e)+f;
+    }
+  }
+  else
+  {
+    float tmp0, tmp1, numer, denom;
+
+    if ( s < 0.0f )  // region 2
+    {
+      tmp0 = b + d;
+      tmp1 = c + e;
+      if ( tmp1 > tmp0 )
+      {
+        numer = tmp1 - tmp0;
+        denom = a-2.0f*b+c;
+        if ( numer >= denom )
+        {
+          s = 1.0f;
+          t = 0.0f;
+//          distance2 = a+2.0f*d+f;
+        }
+        else
+        {
+          s = numer/denom;
+          t = 1.0f - s;
+//          distance2 = s*(a*s+b*t+2.0f*d) + t*(b*s+c*t+2.0f*e)+f;
+        }
+      }
+      else
+      {
+        s = 0.0f;
+        if ( tmp1 <= 0.0f )
+        {
+          t = 1.0f;
+//          distance2 = c+2.0f*e+f;
+        }
+        else if ( e >= 0.0f )
+        {
+          t = 0.0f;
+//          distance2 = f;
+        }
+        else
+        {
+          t = -e/c;
+//          distance2 = e*t+f;
+        }
+      }
+    }
+    else if ( t < 0.0f )  // region 6
+    {
+      tmp0 = b + e;
+      tmp1 = a + d;
+      if ( tmp1 > tmp0 )
+      {
+        numer = tmp1 - tmp0;
+        denom = a-2.0f*b+c;
+        if ( numer >= denom )
+        {
+          t = 1.0f;
+          s = 0.0f;
+//          distance2 = c+2.0f*e+f;
+        }
+        else
+        {
+          t = numer/denom;
+          s = 1.0f - t;
+//          distance2 = s*(a*s+b*t+2.0f*d)+ t*(b*s+c*t+2.0f*e)+f;
+        }
+      }
+      else
+      {
+        t = 0.0f;
+        if ( tmp1 <= 0.0f )
+        {
+          s = 1.0f;
+//          distance2 = a+2.0f*d+f;
+        }
+        else if ( d >= 0.0f )
+        {
+          s = 0.0f;
+//          distance2 = f;
+        }
+        else
+        {
+          s = -d/a;
+//          distance2 = d*s+f;
+        }
+      }
+    }
+    else  // region 1
+    {
+      numer = c + e - b - d;
+      if ( numer <= 0.0f )
+      {
+        s = 0.0f;
+        t = 1.0f;
+//        distance2 = c+2.0f*e+f;
+      }
+      else
+      {
+        denom = a-2.0f*b+c;
+        if ( numer >= denom )
+        {
+          s = 1.0f;
+          t = 0.0f;
+//          distance2 = a+2.0f*d+f;
+        }
+        else
+        {
+          s = numer/denom;
+          t = 1.0f - s;
+//          distance2 = s*(a*s+b*t+2.0f*d) + t*(b*s+c*t+2.0f*e)+f;
+        }
+      }
+    }
+  }
+
+  residual = _p - (B + s*E0 + t*E1);
+
+  return  residual;
+}
+
+
+//=============================================================================
+} // namespace VDPM
+} // namespace OpenMesh
+//=============================================================================
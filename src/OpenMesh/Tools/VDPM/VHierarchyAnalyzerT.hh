@@ -0,0 +1,168 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *      Copyright (C) 2001-2011 by Computer Graphics Group, RWTH Aachen      *
+ *                           www.openmesh.org                                *
+ *                                                                           *
+ *---------------------------------------------------------------------------* 
+ *  This file is part of OpenMesh.                                           *
+ *                                                                           *
+ *  OpenMesh is free software: you can redistribute it and/or modify         * 
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenMesh is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenMesh.  If not,                                    *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/ 
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+//=============================================================================
+//
+//  CLASS VHierarchyAnalyzerT
+//
+//=============================================================================
+
+#ifndef OPENMESH_VDPROGMESH_VHIERARCHYANALYZERT_HH
+#define OPENMESH_VDPROGMESH_VHIERARCHYANALYZERT_HH
+
+
+//== INCLUDES =================================================================
+
+#include <vector>
+#include <OpenMesh/Core/Geometry/VectorT.hh>
+#include <OpenMesh/Core/Mesh/Handles.hh>
+#include <OpenMesh/Core/Utils/Property.hh>
+#include <OpenMesh/Tools/VDPM/VHierarchy.hh>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace VDPM {
+
+//== CLASS DEFINITION =========================================================
+
+
+/** One refinement step of a progressive mesh: vertex v0 is split off v1,
+    vl and vr are the vertices left and right of the new edge (v0,v1).
+    vl resp. vr is invalid if the split is at the boundary.
+ */
+struct VertexSplit
+{
+  VertexHandle v0, v1, vl, vr;
+};
+
+/// Container for the refinement steps, coarse to fine
+typedef std::vector<VertexSplit>  VertexSplitContainer;
+
+
+/** \class VHierarchyAnalyzerT VHierarchyAnalyzerT.hh <OpenMesh/Tools/VDPM/VHierarchyAnalyzerT.hh>
+
+    Computes the view-dependent attributes of all nodes of a vertex
+    hierarchy: fundamental cut nodes, bounding sphere radius, cone of
+    normals and the screen space error (mue, sigma).
+
+    The collapses are undone one by one from the finest level, this pass
+    only locates the fundamental cuts and collects O(valence) data per
+    node (normal at the node level, residuals of the two child vertices
+    to the faces around the parent). The attributes are then merged
+    bottom-up, each node only looks at its two children:
+
+    - The sphere of a node contains the spheres of its children.
+    - The cone of normals of a node contains the cones of its children.
+    - The residual of a leaf to the surface of a node is bounded by the
+      residual of the child vertex plus the residual bound of the child.
+
+    Hence radius and cone are conservative bounds of the values taken over
+    all leaves. For nodes whose children are leaves all values are exact.
+    Independent subtrees are merged in parallel.
+
+    The mesh has to be a triangle mesh with status attributes for
+    vertices, edges and faces. It is expected at full resolution, the
+    vertices of the leaf nodes being set in the hierarchy. analyze()
+    leaves it at base resolution, i.e. all refinement steps collapsed.
+ */
+template <class Mesh>
+class VHierarchyAnalyzerT
+{
+public:
+
+  typedef typename Mesh::Point  Point;
+
+  VHierarchyAnalyzerT(Mesh& _mesh, VHierarchy& _vhierarchy)
+    : mesh_(_mesh), vhierarchy_(_vhierarchy)
+  { }
+
+  /** Analyze the hierarchy. _vsplits are the refinement steps of the
+      progressive mesh in refinement order, i.e. _vsplits[i] created the
+      children of the node of vertex _vsplits[i].v1.
+   */
+  void analyze(const VertexSplitContainer& _vsplits);
+
+private:
+
+  /// Locate the fundamental cut nodes and collapse _vsplit
+  VHierarchyNodeHandle collapse(const VertexSplit& _vsplit);
+
+  /// Normal and child residuals of the node just created by a collapse
+  void compute_local(VHierarchyNodeHandle _node_handle);
+
+  /// Merge the attributes of the children of _node_handle into it
+  void merge(VHierarchyNodeHandle _node_handle);
+
+  /// Residual of _p to the faces around _vh (or to _vh itself)
+  Vec3f residual(const Vec3f& _p, VertexHandle _vh) const;
+
+  Vec3f point(VHierarchyNodeHandle _node_handle) const;
+
+  static Vec3f point2triangle_residual(const Vec3f& _p, const Vec3f _tri[3]);
+
+private:
+
+  Mesh&                                 mesh_;
+  VHierarchy&                           vhierarchy_;
+
+  VPropHandleT<VHierarchyNodeHandle>    node_handle_;
+  HPropHandleT<VHierarchyNodeHandle>    leaf_node_handle_;
+
+  // per node, only used during analyze()
+  std::vector<Vec3f>                    residual_;   // to the parent surface
+  std::vector<float>                    bound_;      // max. residual of the leaves
+  std::vector<float>                    angle_;      // semi-angle of the cone
+};
+
+
+//=============================================================================
+} // namespace VDPM
+} // namespace OpenMesh
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_VDPROGMESH_VHIERARCHYANALYZERT_C)
+#define OPENMESH_VDPROGMESH_VHIERARCHYANALYZERT_TEMPLATES
+#include "VHierarchyAnalyzerT.cc"
+#endif
+//=============================================================================
+#endif // OPENMESH_VDPROGMESH_VHIERARCHYANALYZERT_HH defined
+//=============================================================================
@@ -9,6 +9,17 @@
 #include "unittests_decimater.hh"
 #include "unittests_trimesh_normal_calculations.hh"
 #include "unittests_trimesh_others.hh"
+#include "unittests_exporter.hh"
+#include "unittests_subdivider_adaptive.hh"
+#include "unittests_subdivider_uniform.hh"
+#include "unittests_batch_editor.hh"
+#include "unittests_dualizer.hh"
+#include "unittests_frozen_mesh.hh"
+#include "unittests_remesher.hh"
+#include "unittests_render_buffer.hh"
+#include "unittests_triangle_order.hh"
+#include "unittests_vdpm_analyzer.hh"
+#include "unittests_vector_simd.hh"
 
 int main(int _argc, char** _argv) {
 
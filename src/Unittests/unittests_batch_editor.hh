@@ -0,0 +1,147 @@
+#ifndef INCLUDE_UNITTESTS_BATCH_EDITOR_HH
+#define INCLUDE_UNITTESTS_BATCH_EDITOR_HH
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/BatchEditorT.hh>
+#include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
+
+#include <iostream>
+#include <vector>
+
+class OpenMeshBatchEditor : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Operations changing faces with common vertices are rejected
+ */
+TEST_F(OpenMeshBatchEditor, RejectConflicts) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  OpenMesh::Utils::BatchEditorT<Mesh> editor(mesh_);
+
+  Mesh::HalfedgeHandle heh = mesh_.halfedge_handle(Mesh::EdgeHandle(0), 0);
+  Mesh::VertexHandle   v1  = mesh_.to_vertex_handle(heh);
+
+  EXPECT_TRUE(editor.collapse(heh));
+
+  // every edge around the remaining vertex conflicts
+  for (Mesh::VertexEdgeIter ve_it = mesh_.ve_iter(v1); ve_it; ++ve_it) {
+    EXPECT_FALSE(editor.flip(ve_it.handle()));
+    EXPECT_FALSE(editor.split(ve_it.handle(), mesh_.point(v1)));
+  }
+  for (Mesh::VertexFaceIter vf_it = mesh_.vf_iter(v1); vf_it; ++vf_it)
+    EXPECT_FALSE(editor.delete_face(vf_it.handle()));
+
+  EXPECT_EQ(1u, editor.n_queued());
+
+  // after cancel() the same edges are free again
+  editor.cancel();
+  EXPECT_TRUE(editor.flip(mesh_.edge_handle(heh)));
+  EXPECT_EQ(1u, editor.commit());
+  EXPECT_EQ(0u, editor.n_queued());
+
+  EXPECT_TRUE(OpenMesh::Utils::MeshCheckerT<Mesh>(mesh_).check());
+}
+
+/*
+ * Rounds of collapses and splits reuse the deleted elements
+ */
+TEST_F(OpenMeshBatchEditor, MutationLoop) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  const int euler = int(mesh_.n_vertices()) - int(mesh_.n_edges()) + int(mesh_.n_faces());
+
+  size_t n_holes = 0;
+
+  {
+    OpenMesh::Utils::BatchEditorT<Mesh> editor(mesh_);
+
+    // holes, so that there are boundary vertices
+    for (int i = 0; i < 100; ++i)
+      if (editor.delete_face(Mesh::FaceHandle(i * 150)))
+        ++n_holes;
+
+    EXPECT_GT(n_holes, 90u);
+    EXPECT_EQ(n_holes, editor.commit());
+    EXPECT_TRUE(OpenMesh::Utils::MeshCheckerT<Mesh>(mesh_).check());
+
+    const size_t n_vertices = mesh_.n_vertices();
+    const size_t n_edges    = mesh_.n_edges();
+    const size_t n_faces    = mesh_.n_faces();
+
+    for (int round = 0; round < 20; ++round) {
+
+      // collapse interior edges, then split as many interior edges
+      size_t n_collapses = 0, n_splits = 0;
+
+      for (Mesh::EdgeIter e_it = mesh_.edges_sbegin(); e_it != mesh_.edges_end(); ++e_it) {
+        Mesh::HalfedgeHandle heh = mesh_.halfedge_handle(e_it, 0);
+
+        if ((e_it.handle().idx() + round) % 7 == 0 &&
+            !mesh_.is_boundary(e_it) && !mesh_.is_boundary(mesh_.from_vertex_handle(heh)) &&
+            editor.collapse(heh))
+          ++n_collapses;
+      }
+
+      for (Mesh::EdgeIter e_it = mesh_.edges_sbegin(); e_it != mesh_.edges_end() && n_splits < n_collapses; ++e_it) {
+        Mesh::HalfedgeHandle heh = mesh_.halfedge_handle(e_it, 0);
+        Mesh::Point midpoint = (mesh_.point(mesh_.from_vertex_handle(heh)) +
+                                mesh_.point(mesh_.to_vertex_handle(heh))) * 0.5f;
+
+        if (!mesh_.is_boundary(e_it) && editor.split(e_it, midpoint))
+          ++n_splits;
+      }
+
+      EXPECT_GT(n_collapses, 100u);
+      EXPECT_EQ(n_collapses, n_splits);
+      EXPECT_EQ(n_collapses + n_splits, editor.commit());
+      EXPECT_EQ(n_splits, editor.split_vertices().size());
+
+      EXPECT_TRUE(OpenMesh::Utils::MeshCheckerT<Mesh>(mesh_).check()) << "Round " << round;
+
+      // the splits reused the collapsed elements
+      EXPECT_EQ(n_vertices, mesh_.n_vertices()) << "Round " << round;
+      EXPECT_EQ(n_edges,    mesh_.n_edges())    << "Round " << round;
+      EXPECT_EQ(n_faces,    mesh_.n_faces())    << "Round " << round;
+    }
+
+    editor.garbage_collection();
+    EXPECT_EQ(0u, editor.n_free());
+  }
+
+  EXPECT_TRUE(OpenMesh::Utils::MeshCheckerT<Mesh>(mesh_).check());
+  EXPECT_EQ(euler - int(n_holes),
+            int(mesh_.n_vertices()) - int(mesh_.n_edges()) + int(mesh_.n_faces()));
+}
+
+#endif // INCLUDE GUARD
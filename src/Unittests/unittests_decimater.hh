@@ -6,6 +6,37 @@
 #include <OpenMesh/Tools/Decimater/DecimaterT.hh>
 #include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
 #include <OpenMesh/Tools/Decimater/ModNormalFlippingT.hh>
+#include <OpenMesh/Tools/Decimater/ModAspectRatioT.hh>
+#include <OpenMesh/Tools/Decimater/ParallelDecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/StreamDecimaterT.hh>
+#include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
+
+#include <vector>
+
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+/*
+ * Binary module counting the evaluated collapses
+ */
+template <class DecimaterType>
+class ModCountT : public OpenMesh::Decimater::ModBaseT<DecimaterType>
+{
+public:
+
+  DECIMATING_MODULE( ModCountT, DecimaterType, Count );
+
+  ModCountT( DecimaterType &_dec ) : Base(_dec, true), n_evaluations_(0) {}
+
+  float collapse_priority(const CollapseInfo& /* _ci */)
+  {
+    ++n_evaluations_;
+    return Base::LEGAL_COLLAPSE;
+  }
+
+  size_t n_evaluations_;
+};
 
 class OpenMeshDecimater : public OpenMeshBase {
 
@@ -23,6 +54,50 @@ class OpenMeshDecimater : public OpenMeshBase {
             // Do some final stuff with the member data here...
         }
 
+        // Project the mesh onto the unit sphere around its center
+        void make_sphere(Mesh& _mesh) {
+            Mesh::Point center(0.0, 0.0, 0.0);
+            for (Mesh::VertexIter v_it = _mesh.vertices_begin(); v_it != _mesh.vertices_end(); ++v_it)
+              center += _mesh.point(v_it);
+            center /= _mesh.n_vertices();
+
+            for (Mesh::VertexIter v_it = _mesh.vertices_begin(); v_it != _mesh.vertices_end(); ++v_it)
+              _mesh.set_point(v_it, (_mesh.point(v_it) - center).normalize());
+
+            _mesh.request_face_normals();
+            _mesh.update_face_normals();
+        }
+
+        // Largest ratio of the longest edge to its height over all faces
+        float max_aspect_ratio(Mesh& _mesh) {
+            float max_aspect = 0.0f;
+            for (Mesh::FaceIter f_it = _mesh.faces_sbegin(); f_it != _mesh.faces_end(); ++f_it) {
+              Mesh::FaceVertexIter fv_it = _mesh.fv_iter(f_it);
+              const Mesh::Point& p0 = _mesh.point(fv_it);
+              const Mesh::Point& p1 = _mesh.point(++fv_it);
+              const Mesh::Point& p2 = _mesh.point(++fv_it);
+
+              float l2 = std::max((p1 - p0).sqrnorm(), std::max((p2 - p1).sqrnorm(), (p0 - p2).sqrnorm()));
+              float a2 = ((p1 - p0) % (p2 - p0)).sqrnorm();
+              max_aspect = std::max(max_aspect, float(sqrt(l2 * l2 / a2)));
+            }
+            return max_aspect;
+        }
+
+        // Largest distance of the vertices and face centers to the unit sphere
+        double sphere_deviation(Mesh& _mesh) {
+            double deviation = 0.0;
+            for (Mesh::FaceIter f_it = _mesh.faces_sbegin(); f_it != _mesh.faces_end(); ++f_it) {
+              Mesh::Point center(0.0, 0.0, 0.0);
+              for (Mesh::FaceVertexIter fv_it = _mesh.fv_iter(f_it); fv_it; ++fv_it) {
+                center += _mesh.point(fv_it) / 3.0f;
+                deviation = std::max(deviation, fabs(_mesh.point(fv_it).norm() - 1.0));
+              }
+              deviation = std::max(deviation, fabs(center.norm() - 1.0));
+            }
+            return deviation;
+        }
+
     // Member already defined in OpenMeshBase
     //Mesh mesh_;  
 };
@@ -59,4 +134,347 @@ TEST_F(OpenMeshDecimater, DecimateMesh) {
   EXPECT_EQ(9996, mesh_.n_faces()) << "The number of faces after decimation is not correct!";
 }
 
+/*
+ * The parallel initialization of the quadric module gives the same
+ * quadrics as summing up the face quadrics in a serial loop
+ */
+TEST_F(OpenMeshDecimater, QuadricInitialization) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  typedef OpenMesh::Decimater::DecimaterT< Mesh >  Decimater;
+  typedef OpenMesh::Decimater::ModQuadricT< Decimater >::Handle HModQuadric;
+  typedef OpenMesh::Geometry::Quadricd Quadricd;
+
+  Decimater decimater(mesh_);
+  HModQuadric hModQuadric;
+  decimater.add( hModQuadric );
+
+  // Serial reference
+  std::vector<Quadricd> quadrics(mesh_.n_vertices());
+
+  for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it) {
+    Mesh::FaceVertexIter fv_it = mesh_.fv_iter(f_it);
+    Mesh::VertexHandle vh0 = fv_it.handle(); ++fv_it;
+    Mesh::VertexHandle vh1 = fv_it.handle(); ++fv_it;
+    Mesh::VertexHandle vh2 = fv_it.handle();
+
+    OpenMesh::Vec3d v0 = OpenMesh::vector_cast<OpenMesh::Vec3d>(mesh_.point(vh0));
+    OpenMesh::Vec3d v1 = OpenMesh::vector_cast<OpenMesh::Vec3d>(mesh_.point(vh1));
+    OpenMesh::Vec3d v2 = OpenMesh::vector_cast<OpenMesh::Vec3d>(mesh_.point(vh2));
+
+    OpenMesh::Vec3d n = (v1-v0) % (v2-v0);
+    double area = n.norm();
+    if (area > FLT_MIN) {
+      n /= area;
+      area *= 0.5;
+    }
+
+    Quadricd q(n[0], n[1], n[2], -(v0|n));
+    q *= area;
+
+    quadrics[vh0.idx()] += q;
+    quadrics[vh1.idx()] += q;
+    quadrics[vh2.idx()] += q;
+  }
+
+  // Serial and parallel initialization
+  for (int n_threads = 1; n_threads <= 4; n_threads += 3) {
+#ifdef USE_OPENMP
+    int max_threads = omp_get_max_threads();
+    omp_set_num_threads(n_threads);
+#endif
+
+    decimater.initialize();
+
+#ifdef USE_OPENMP
+    omp_set_num_threads(max_threads);
+#endif
+
+    for (Mesh::HalfedgeIter h_it = mesh_.halfedges_begin(); h_it != mesh_.halfedges_end(); ++h_it) {
+      Decimater::CollapseInfo ci(mesh_, h_it.handle());
+
+      Quadricd q = quadrics[ci.v0.idx()];
+      q += quadrics[ci.v1.idx()];
+
+      EXPECT_EQ(float(q(ci.p1)), decimater.module(hModQuadric).collapse_priority(ci))
+        << "Priority of halfedge " << h_it.handle().idx() << " with " << n_threads << " threads";
+    }
+  }
+}
+
+/*
+ * Evaluating a quadric at many points at once gives the same results as
+ * evaluating it point by point
+ */
+TEST_F(OpenMeshDecimater, QuadricBatchEvaluation) {
+
+  typedef OpenMesh::Geometry::Quadricd Quadricd;
+  typedef OpenMesh::Geometry::Quadricf Quadricf;
+
+  Quadricd qd(0.3, 0.5, -0.2, 0.1);
+  qd += Quadricd(OpenMesh::Vec3d(0.1, 0.2, 0.3));
+
+  // float storage, converted from the double quadric
+  Quadricf qf(qd);
+  EXPECT_EQ(float(qd.b()), qf.b());
+  EXPECT_EQ(float(qd.j()), qf.j());
+
+  std::vector<OpenMesh::Vec3d> pd;
+  std::vector<OpenMesh::Vec3f> pf;
+  for (int i = 0; i < 11; ++i) {
+    pd.push_back(OpenMesh::Vec3d(0.1 * i, 1.0 - 0.2 * i, 0.05 * i * i));
+    pf.push_back(OpenMesh::vector_cast<OpenMesh::Vec3f>(pd.back()));
+  }
+
+  std::vector<double> ed(pd.size());
+  std::vector<float>  ef(pf.size());
+  qd(&pd[0], pd.size(), &ed[0]);
+  qf(&pf[0], pf.size(), &ef[0]);
+
+  for (size_t i = 0; i < pd.size(); ++i) {
+    EXPECT_DOUBLE_EQ(qd(pd[i]), ed[i]) << "Point " << i;
+    EXPECT_FLOAT_EQ(qf(pf[i]), ef[i]) << "Point " << i;
+
+    // plain definition v^T Q v
+    OpenMesh::Vec4d v(pd[i][0], pd[i][1], pd[i][2], 1.0);
+    EXPECT_NEAR((v | (qd * v)), ed[i], 1e-12) << "Point " << i;
+  }
+}
+
+/*
+ * Collapsing edges to the optimal positions of the quadrics reaches the
+ * same error bound with fewer faces and fewer evaluated collapses than
+ * halfedge collapses
+ */
+TEST_F(OpenMeshDecimater, DecimateMeshOptimalPlacement) {
+
+  typedef OpenMesh::Decimater::DecimaterT< Mesh >  Decimater;
+  typedef OpenMesh::Decimater::ModQuadricT< Decimater >::Handle HModQuadric;
+  typedef OpenMesh::Decimater::ModNormalFlippingT< Decimater >::Handle HModNormal;
+  typedef ModCountT< Decimater >::Handle HModCount;
+
+  size_t n_faces[2], n_collapses[2], n_evaluations[2];
+  double deviation[2];
+
+  for (int mode = 0; mode < 2; ++mode) {
+    Mesh mesh;
+    bool ok = OpenMesh::IO::read_mesh(mesh, "cube1.off");
+    ASSERT_TRUE(ok);
+
+    make_sphere(mesh);
+
+    Decimater decimater(mesh);
+    HModQuadric hModQuadric;
+    HModNormal  hModNormal;
+    HModCount   hModCount;
+    decimater.add( hModQuadric );
+    decimater.add( hModNormal );
+    decimater.add( hModCount );
+    decimater.module( hModQuadric ).set_max_err(1e-5, false);
+
+    decimater.set_collapse_mode(mode ? Decimater::OptimalPlacement : Decimater::HalfedgeCollapse);
+    ASSERT_TRUE(decimater.initialize());
+
+    n_collapses[mode]   = decimater.decimate();
+    n_evaluations[mode] = decimater.module( hModCount ).n_evaluations_;
+
+    mesh.garbage_collection();
+    n_faces[mode]   = mesh.n_faces();
+    deviation[mode] = sphere_deviation(mesh);
+
+    EXPECT_EQ(mesh.n_vertices(), 7526u - n_collapses[mode]);
+
+    OpenMesh::Utils::MeshCheckerT<Mesh> checker(mesh);
+    EXPECT_TRUE(checker.check()) << "Mesh is not consistent in mode " << mode;
+  }
+
+  EXPECT_LT(n_faces[1], n_faces[0]);
+  EXPECT_LE(deviation[1], deviation[0]);
+  EXPECT_LT(double(n_evaluations[1]) / n_collapses[1], 0.5 * double(n_evaluations[0]) / n_collapses[0]);
+}
+
+/*
+ * With optimal placement the remaining vertex moves too, the aspect ratio
+ * bound must hold for its faces as well
+ */
+TEST_F(OpenMeshDecimater, DecimateOptimalPlacementAspectRatio) {
+
+  typedef OpenMesh::Decimater::DecimaterT< Mesh >  Decimater;
+  typedef OpenMesh::Decimater::ModQuadricT< Decimater >::Handle HModQuadric;
+  typedef OpenMesh::Decimater::ModAspectRatioT< Decimater >::Handle HModAspectRatio;
+
+  Mesh mesh;
+  bool ok = OpenMesh::IO::read_mesh(mesh, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  make_sphere(mesh);
+
+  const float max_aspect = 1.05f * max_aspect_ratio(mesh);
+
+  Decimater decimater(mesh);
+  HModQuadric     hModQuadric;
+  HModAspectRatio hModAspectRatio;
+  decimater.add( hModQuadric );
+  decimater.add( hModAspectRatio );
+  decimater.module( hModAspectRatio ).set_aspect_ratio(max_aspect);
+
+  decimater.set_collapse_mode(Decimater::OptimalPlacement);
+  ASSERT_TRUE(decimater.initialize());
+
+  size_t n_collapses = decimater.decimate_to(1000);
+  mesh.garbage_collection();
+
+  EXPECT_GT(n_collapses, 3000u);
+  EXPECT_LE(max_aspect_ratio(mesh), max_aspect * 1.0001f);
+}
+
+/*
+ * Decimating a file in blocks gives a consistent mesh of the same
+ * topology, the seams between the blocks are closed
+ */
+TEST_F(OpenMeshDecimater, DecimateStreamed) {
+
+  Mesh input;
+  bool ok = OpenMesh::IO::read_mesh(input, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  Mesh mesh;
+  OpenMesh::Decimater::StreamDecimaterT< Mesh > decimater;
+  decimater.set_block_faces(input.n_faces() / 8);
+  decimater.set_vertex_cache(1000);
+
+  ok = decimater.decimate("cube1.off", 0.2f, mesh);
+  ASSERT_TRUE(ok);
+
+  EXPECT_GT(decimater.n_blocks(), 4u);
+  EXPECT_LE(mesh.n_faces(), size_t(0.2 * input.n_faces() + 2.5));
+  EXPECT_GT(mesh.n_faces(), size_t(0.1 * input.n_faces()));
+
+  OpenMesh::Utils::MeshCheckerT<Mesh> checker(mesh);
+  EXPECT_TRUE(checker.check()) << "Mesh is not consistent";
+
+  // Euler characteristic and boundary
+  size_t n_boundary[2] = { 0, 0 };
+  for (Mesh::HalfedgeIter h_it = input.halfedges_begin(); h_it != input.halfedges_end(); ++h_it)
+    if (input.is_boundary(h_it))
+      ++n_boundary[0];
+  for (Mesh::HalfedgeIter h_it = mesh.halfedges_begin(); h_it != mesh.halfedges_end(); ++h_it)
+    if (mesh.is_boundary(h_it))
+      ++n_boundary[1];
+
+  EXPECT_EQ(n_boundary[0], n_boundary[1]);
+  EXPECT_EQ(int(input.n_vertices() - input.n_edges() + input.n_faces()),
+            int(mesh.n_vertices() - mesh.n_edges() + mesh.n_faces()));
+
+  // the shape is kept
+  Mesh::Point bb_min[2], bb_max[2];
+  bb_min[0] = bb_max[0] = input.point(input.vertex_handle(0));
+  bb_min[1] = bb_max[1] = mesh.point(mesh.vertex_handle(0));
+  for (Mesh::VertexIter v_it = input.vertices_begin(); v_it != input.vertices_end(); ++v_it) {
+    bb_min[0].minimize(input.point(v_it));
+    bb_max[0].maximize(input.point(v_it));
+  }
+  for (Mesh::VertexIter v_it = mesh.vertices_begin(); v_it != mesh.vertices_end(); ++v_it) {
+    bb_min[1].minimize(mesh.point(v_it));
+    bb_max[1].maximize(mesh.point(v_it));
+  }
+
+  float diagonal = (bb_max[0] - bb_min[0]).length();
+  EXPECT_LT((bb_min[1] - bb_min[0]).length(), 0.02f * diagonal);
+  EXPECT_LT((bb_max[1] - bb_max[0]).length(), 0.02f * diagonal);
+}
+
+/*
+ * The corners of STL triangles are welded out of core, reading without
+ * collapses gives the connectivity of the indexed mesh
+ */
+TEST_F(OpenMeshDecimater, DecimateStreamedSTL) {
+
+  const char* files[2] = { "cube1.stl", "cube1Binary.stl" };
+
+  for (int i = 0; i < 2; ++i) {
+    Mesh mesh;
+    OpenMesh::Decimater::StreamDecimaterT< Mesh > decimater;
+    decimater.set_block_faces(15048 / 8);
+    decimater.set_vertex_cache(1000);
+
+    bool ok = decimater.decimate(files[i], 1.0f, mesh);
+    ASSERT_TRUE(ok) << files[i];
+
+    EXPECT_EQ(7526u,  mesh.n_vertices()) << files[i];
+    EXPECT_EQ(22572u, mesh.n_edges())    << files[i];
+    EXPECT_EQ(15048u, mesh.n_faces())    << files[i];
+
+    size_t n_boundary = 0;
+    for (Mesh::HalfedgeIter h_it = mesh.halfedges_begin(); h_it != mesh.halfedges_end(); ++h_it)
+      if (mesh.is_boundary(h_it))
+        ++n_boundary;
+
+    EXPECT_EQ(0u, n_boundary) << files[i];
+  }
+}
+
+/*
+ * Decimating four clusters with locked seams and a final seam pass gives
+ * the requested complexity and about the error of the global decimation
+ */
+TEST_F(OpenMeshDecimater, DecimateParallel) {
+
+  typedef OpenMesh::Decimater::DecimaterT< Mesh >  Decimater;
+  typedef OpenMesh::Decimater::ModQuadricT< Decimater >::Handle HModQuadric;
+
+  Mesh global, mesh;
+  bool ok = OpenMesh::IO::read_mesh(global, "cube1.off");
+  ASSERT_TRUE(ok);
+  ok = OpenMesh::IO::read_mesh(mesh, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  make_sphere(global);
+  make_sphere(mesh);
+
+  {
+    Decimater decimater(global);
+    HModQuadric hModQuadric;
+    decimater.add( hModQuadric );
+    ASSERT_TRUE(decimater.initialize());
+    EXPECT_EQ(6526u, decimater.decimate_to(1000));
+    global.garbage_collection();
+  }
+
+  // properties of the mesh are kept
+  OpenMesh::VPropHandleT<int> index;
+  mesh.add_property(index);
+  for (Mesh::VertexIter v_it = mesh.vertices_begin(); v_it != mesh.vertices_end(); ++v_it)
+    mesh.property(index, v_it) = v_it.handle().idx();
+
+  Mesh::Point p0 = mesh.point(mesh.vertex_handle(0));
+  size_t n_collapses, n_cluster_collapses;
+  {
+    OpenMesh::Decimater::ParallelDecimaterT< Mesh > decimater(mesh);
+    decimater.set_n_clusters(4);
+    n_collapses = decimater.decimate_to(1000);
+    n_cluster_collapses = decimater.n_cluster_collapses();
+    mesh.garbage_collection();
+  }
+
+  EXPECT_EQ(6526u, n_collapses);
+  EXPECT_GT(n_cluster_collapses, n_collapses / 2);
+  EXPECT_LT(n_cluster_collapses, n_collapses);
+
+  EXPECT_EQ(1000u, mesh.n_vertices());
+
+  OpenMesh::Utils::MeshCheckerT<Mesh> checker(mesh);
+  EXPECT_TRUE(checker.check()) << "Mesh is not consistent";
+
+  for (Mesh::VertexIter v_it = mesh.vertices_begin(); v_it != mesh.vertices_end(); ++v_it)
+    if (mesh.property(index, v_it) == 0) {
+      EXPECT_EQ(p0, mesh.point(v_it));
+    }
+
+  EXPECT_LT(sphere_deviation(mesh), 1.25 * sphere_deviation(global));
+}
+
 #endif // INCLUDE GUARD
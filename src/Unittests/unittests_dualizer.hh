@@ -0,0 +1,121 @@
+#ifndef INCLUDE_UNITTESTS_DUALIZER_HH
+#define INCLUDE_UNITTESTS_DUALIZER_HH
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/Mesh/PolyMesh_ArrayKernelT.hh>
+#include <OpenMesh/Tools/Dualizer/meshDualT.hh>
+#include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
+
+#include <iostream>
+#include <vector>
+
+typedef OpenMesh::PolyMesh_ArrayKernelT<> DualMesh;
+
+/*
+ * Reference dual built face by face with add_face
+ */
+void reference_dual(const DualMesh& _primal, DualMesh& _dual) {
+
+  std::vector<DualMesh::VertexHandle> dual_vertex(_primal.n_faces());
+
+  for (DualMesh::ConstFaceIter f_it = _primal.faces_begin(); f_it != _primal.faces_end(); ++f_it) {
+    DualMesh::Point cog(0,0,0);
+    unsigned int degree = 0;
+    for (DualMesh::ConstFaceVertexIter fv_it = _primal.cfv_iter(f_it); fv_it; ++fv_it, ++degree)
+      cog += _primal.point(fv_it);
+    dual_vertex[f_it.handle().idx()] = _dual.add_vertex(cog / degree);
+  }
+
+  std::vector<DualMesh::VertexHandle> face_vhandles;
+  for (DualMesh::ConstVertexIter v_it = _primal.vertices_begin(); v_it != _primal.vertices_end(); ++v_it) {
+    if (_primal.is_boundary(v_it))
+      continue;
+    face_vhandles.clear();
+    for (DualMesh::ConstVertexFaceIter vf_it = _primal.cvf_iter(v_it); vf_it; ++vf_it)
+      face_vhandles.push_back(dual_vertex[vf_it.handle().idx()]);
+    _dual.add_face(face_vhandles);
+  }
+}
+
+class OpenMeshDualizer : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;  
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * The bulk dual equals the add_face construction on a mesh with boundary
+ */
+TEST_F(OpenMeshDualizer, BulkDualMatchesAddFace) {
+
+  DualMesh primal;
+
+  bool ok = OpenMesh::IO::read_mesh(primal, "cube1.off");
+
+  ASSERT_TRUE(ok) << "Unable to load cube1.off";
+
+  // open the mesh: remove every 7th face
+  primal.request_face_status();
+  primal.request_edge_status();
+  primal.request_vertex_status();
+  for (unsigned int i = 0; i < primal.n_faces(); i += 7)
+    primal.delete_face(DualMesh::FaceHandle(i), false);
+  primal.garbage_collection();
+
+  DualMesh reference, dual;
+  OpenMesh::Util::MeshDualMap map;
+
+  reference_dual(primal, reference);
+  OpenMesh::Util::MeshDual(primal, dual, map);
+
+  EXPECT_EQ(reference.n_vertices(), dual.n_vertices()) << "Different number of vertices";
+  EXPECT_EQ(reference.n_edges(), dual.n_edges()) << "Different number of edges";
+  ASSERT_EQ(reference.n_faces(), dual.n_faces()) << "Different number of faces";
+
+  for (unsigned int i = 0; i < dual.n_vertices(); ++i)
+    EXPECT_EQ(reference.point(DualMesh::VertexHandle(i)), dual.point(DualMesh::VertexHandle(i))) << "Different point " << i;
+
+  size_t n_different = 0;
+  for (unsigned int i = 0; i < dual.n_faces(); ++i) {
+    std::vector<int> ref_face, dual_face;
+    for (DualMesh::FaceVertexIter fv_it = reference.fv_iter(DualMesh::FaceHandle(i)); fv_it; ++fv_it)
+      ref_face.push_back(fv_it.handle().idx());
+    for (DualMesh::FaceVertexIter fv_it = dual.fv_iter(DualMesh::FaceHandle(i)); fv_it; ++fv_it)
+      dual_face.push_back(fv_it.handle().idx());
+    if (ref_face != dual_face)
+      ++n_different;
+  }
+  EXPECT_EQ(0u, n_different) << "Different dual faces";
+
+  // check the boundary linkage of the dual
+  OpenMesh::Utils::MeshCheckerT<DualMesh> checker(dual);
+  OpenMesh::Utils::MeshCheckerT<DualMesh>::Errors errors;
+  EXPECT_TRUE(checker.check(OpenMesh::Utils::MeshCheckerT<DualMesh>::CHECK_ALL, errors)) << "Invalid dual connectivity";
+
+  // correspondence maps
+  for (DualMesh::VertexIter v_it = primal.vertices_begin(); v_it != primal.vertices_end(); ++v_it)
+    EXPECT_EQ(!primal.is_boundary(v_it), map.vertex_to_face[v_it.handle().idx()].is_valid());
+  for (DualMesh::FaceIter f_it = primal.faces_begin(); f_it != primal.faces_end(); ++f_it)
+    EXPECT_EQ(f_it.handle().idx(), map.face_to_vertex[f_it.handle().idx()].idx());
+}
+
+#endif // INCLUDE_UNITTESTS_DUALIZER_HH
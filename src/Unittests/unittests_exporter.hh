@@ -0,0 +1,77 @@
+#ifndef INCLUDE_UNITTESTS_EXPORTER_HH
+#define INCLUDE_UNITTESTS_EXPORTER_HH
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/IO/exporter/ExporterT.hh>
+
+class OpenMeshExporter : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+            
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;  
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Compare the bulk arrays of the exporter with its per element accessors
+ */
+TEST_F(OpenMeshExporter, BulkAccessMatchesPerElementAccess) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  mesh_.request_face_normals();
+  mesh_.update_face_normals();
+
+  OpenMesh::IO::ExporterT<Mesh> exporter(mesh_);
+
+  std::vector<OpenMesh::Vec3f> points_buf, normals_buf;
+  const OpenMesh::Vec3f* points  = exporter.get_points(points_buf);
+  const OpenMesh::Vec3f* normals = exporter.get_face_normals(normals_buf);
+
+  // Vec3f meshes hand out their own property arrays
+  EXPECT_EQ(mesh_.points(), points) << "Points were copied instead of referenced";
+  EXPECT_TRUE(points_buf.empty()) << "Buffer should not be used";
+  EXPECT_TRUE(exporter.vertex_normals_array() == 0) << "Vertex normals are not available";
+
+  for (unsigned int i = 0; i < mesh_.n_vertices(); ++i)
+    EXPECT_EQ(exporter.point(Mesh::VertexHandle(i)), points[i]) << "Wrong point at vertex " << i;
+
+  for (unsigned int i = 0; i < mesh_.n_faces(); ++i)
+    EXPECT_EQ(exporter.normal(Mesh::FaceHandle(i)), normals[i]) << "Wrong normal at face " << i;
+
+  std::vector<unsigned int> indices, offsets;
+  std::vector<Mesh::VertexHandle> vhandles;
+
+  EXPECT_EQ(3*mesh_.n_faces(), exporter.get_face_indices(indices, &offsets)) << "Wrong number of indices";
+  EXPECT_EQ(mesh_.n_faces()+1, offsets.size()) << "Wrong number of offsets";
+
+  for (unsigned int i = 0; i < mesh_.n_faces(); ++i) {
+    exporter.get_vhandles(Mesh::FaceHandle(i), vhandles);
+    ASSERT_EQ(vhandles.size(), offsets[i+1] - offsets[i]) << "Wrong valence at face " << i;
+    for (unsigned int j = 0; j < vhandles.size(); ++j)
+      EXPECT_EQ(vhandles[j].idx(), (int)indices[offsets[i]+j]) << "Wrong index at face " << i;
+  }
+}
+
+#endif // INCLUDE GUARD
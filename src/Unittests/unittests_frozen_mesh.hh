@@ -0,0 +1,137 @@
+#ifndef INCLUDE_UNITTESTS_FROZEN_MESH_HH
+#define INCLUDE_UNITTESTS_FROZEN_MESH_HH
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/FrozenMeshT.hh>
+
+#include <iostream>
+#include <vector>
+
+class OpenMeshFrozenMesh : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;  
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * The snapshot of a mesh with deleted elements has the same
+ * connectivity and geometry as the remaining source mesh
+ */
+TEST_F(OpenMeshFrozenMesh, SnapshotMatchesSource) {
+
+  typedef OpenMesh::Utils::FrozenMeshT<Mesh> FrozenMesh;
+  typedef FrozenMesh::Index                  Index;
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok) << "Unable to load cube1.off";
+
+  // delete some faces (and isolated vertices) without garbage collection
+  mesh_.request_face_status();
+  mesh_.request_edge_status();
+  mesh_.request_vertex_status();
+  for (unsigned int i = 0; i < mesh_.n_faces(); i += 5)
+    mesh_.delete_face(Mesh::FaceHandle(i), true);
+
+  mesh_.request_vertex_normals();
+  mesh_.request_face_normals();
+  mesh_.update_normals();
+
+  FrozenMesh frozen(mesh_);
+
+  // mapping
+  Index nv = 0;
+  for (Mesh::VertexIter v_it = mesh_.vertices_sbegin(); v_it != mesh_.vertices_end(); ++v_it, ++nv) {
+    ASSERT_EQ(nv, frozen.vertex(v_it.handle()));
+    ASSERT_EQ(v_it.handle(), frozen.source_vertex(nv));
+  }
+  EXPECT_EQ(nv, frozen.n_vertices());
+
+  Index nf = 0;
+  for (Mesh::FaceIter f_it = mesh_.faces_sbegin(); f_it != mesh_.faces_end(); ++f_it, ++nf) {
+    ASSERT_EQ(nf, frozen.face(f_it.handle()));
+    ASSERT_EQ(f_it.handle(), frozen.source_face(nf));
+  }
+  EXPECT_EQ(nf, frozen.n_faces());
+  EXPECT_EQ(3 * nf, frozen.n_corners());
+  EXPECT_EQ(FrozenMesh::InvalidIndex, frozen.face(Mesh::FaceHandle(0)));
+
+  // faces and corners
+  size_t n_different = 0;
+  for (Index f = 0; f < frozen.n_faces(); ++f) {
+    Mesh::FaceVertexIter fv_it = mesh_.fv_iter(frozen.source_face(f));
+    for (FrozenMesh::ConstIndexIter it = frozen.fv_begin(f); it != frozen.fv_end(f); ++it, ++fv_it)
+      if (!fv_it || frozen.source_vertex(*it) != fv_it.handle())
+        ++n_different;
+    if (fv_it)
+      ++n_different;
+
+    for (Index c = frozen.corner_begin(f); c != frozen.corner_end(f); ++c) {
+      Index o = frozen.opposite_corner(c);
+      if (o == FrozenMesh::InvalidIndex)
+        continue;
+      if (frozen.opposite_corner(o) != c ||
+          frozen.corner_vertex(o) != frozen.corner_vertex(frozen.prev_corner(c)) ||
+          frozen.corner_vertex(c) != frozen.corner_vertex(frozen.prev_corner(o)))
+        ++n_different;
+    }
+  }
+  EXPECT_EQ(0u, n_different) << "Faces or corners differ";
+
+  // one-rings: neighbors, incident faces and uniform Laplacian
+  n_different = 0;
+  for (Index v = 0; v < frozen.n_vertices(); ++v) {
+    Mesh::VertexHandle vh = frozen.source_vertex(v);
+
+    if (frozen.is_boundary(v) != mesh_.is_boundary(vh))
+      ++n_different;
+
+    Mesh::Point laplace_source(0,0,0), laplace_frozen(0,0,0);
+    Mesh::VertexVertexIter vv_it = mesh_.vv_iter(vh);
+    for (FrozenMesh::ConstIndexIter it = frozen.vv_begin(v); it != frozen.vv_end(v); ++it, ++vv_it) {
+      if (!vv_it || frozen.source_vertex(*it) != vv_it.handle())
+        ++n_different;
+      laplace_frozen += frozen.point(*it);
+      laplace_source += mesh_.point(vv_it);
+    }
+    if (vv_it || laplace_frozen != laplace_source)
+      ++n_different;
+
+    Mesh::VertexFaceIter vf_it = mesh_.vf_iter(vh);
+    for (FrozenMesh::ConstIndexIter it = frozen.vc_begin(v); it != frozen.vc_end(v); ++it, ++vf_it)
+      if (!vf_it || frozen.corner_vertex(*it) != v ||
+          frozen.source_face(frozen.corner_face(*it)) != vf_it.handle())
+        ++n_different;
+    if (vf_it)
+      ++n_different;
+  }
+  EXPECT_EQ(0u, n_different) << "One-rings differ";
+
+  // attribute columns
+  std::vector<Mesh::Normal> normals;
+  frozen.copy_vertex_property(mesh_, mesh_.vertex_normals_pph(), normals);
+  ASSERT_EQ(frozen.n_vertices(), normals.size());
+  for (Index v = 0; v < frozen.n_vertices(); ++v)
+    EXPECT_EQ(mesh_.normal(frozen.source_vertex(v)), normals[v]);
+}
+
+#endif // INCLUDE_UNITTESTS_FROZEN_MESH_HH
@@ -4,6 +4,8 @@
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
 
+#include <sstream>
+
 
 class OpenMeshLoader : public OpenMeshBase {
 
@@ -271,4 +273,177 @@ TEST_F(OpenMeshLoader, LoadSimplePLYWithNormals) {
 
 
 
+/*
+ * Load a batch of files of different formats in parallel. The same
+ * formats appear several times so that reader modules are used
+ * concurrently.
+ */
+TEST_F(OpenMeshLoader, LoadMultipleFilesInParallel) {
+
+    std::vector<std::string> files;
+    for (unsigned int i = 0; i < 4; ++i) {
+      files.push_back("cube1.off");
+      files.push_back("cube-minimal.ply");
+      files.push_back("cube-minimal.obj");
+      files.push_back("cube1Binary.stl");
+      files.push_back("does-not-exist.off");
+    }
+
+    std::vector<Mesh> meshes;
+    std::vector<OpenMesh::IO::Options> options;
+    std::vector<bool> ok;
+
+    size_t n_ok = OpenMesh::IO::read_meshes(meshes, files, options, ok, 4);
+
+    EXPECT_EQ(16u, n_ok) << "Wrong number of successfully loaded files!";
+    ASSERT_EQ(files.size(), meshes.size());
+    ASSERT_EQ(files.size(), ok.size());
+
+    for (unsigned int i = 0; i < files.size(); i += 5) {
+      EXPECT_TRUE(ok[i] && ok[i+1] && ok[i+2] && ok[i+3]) << "Failed to load a file of batch " << i/5;
+      EXPECT_FALSE(ok[i+4]) << "Loaded a missing file!";
+
+      EXPECT_EQ(7526u, meshes[i  ].n_vertices()) << "The number of loaded vertices is not correct!";
+      EXPECT_EQ(8u,    meshes[i+1].n_vertices()) << "The number of loaded vertices is not correct!";
+      EXPECT_EQ(12u,   meshes[i+1].n_faces())    << "The number of loaded faces is not correct!";
+      EXPECT_EQ(8u,    meshes[i+2].n_vertices()) << "The number of loaded vertices is not correct!";
+      EXPECT_EQ(15048u, meshes[i+3].n_faces())   << "The number of loaded faces is not correct!";
+    }
+}
+
+/*
+ * Load several files with one shared reader scratch context. Data of a
+ * previous file must not leak into the next one.
+ */
+TEST_F(OpenMeshLoader, LoadFilesWithSharedScratch) {
+
+    OpenMesh::IO::ImportScratch scratch;
+    OpenMesh::IO::Options opt;
+
+    mesh_.request_vertex_colors();
+
+    bool ok = OpenMesh::IO::read_mesh(mesh_, "cube-minimal-vertex-colors-as-vc-lines.obj", opt, scratch);
+
+    EXPECT_TRUE(ok) << "Unable to load cube-minimal-vertex-colors-as-vc-lines.obj";
+    EXPECT_EQ(8u,   mesh_.n_vertices()) << "The number of loaded vertices is not correct!";
+    EXPECT_EQ(12u,  mesh_.n_faces()) << "The number of loaded faces is not correct!";
+    EXPECT_EQ(255,  mesh_.color(mesh_.vertex_handle(7))[0] ) << "Wrong vertex color at vertex 7 component 0";
+
+    ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off", opt, scratch);
+
+    EXPECT_TRUE(ok) << "Unable to load cube1.off";
+    EXPECT_EQ(7526u,  mesh_.n_vertices()) << "The number of loaded vertices is not correct!";
+    EXPECT_EQ(15048u, mesh_.n_faces()) << "The number of loaded faces is not correct!";
+
+    opt = OpenMesh::IO::Options();
+    ok = OpenMesh::IO::read_mesh(mesh_, "cube-minimal.obj", opt, scratch);
+
+    EXPECT_TRUE(ok) << "Unable to load cube-minimal.obj";
+    EXPECT_EQ(8u,   mesh_.n_vertices()) << "The number of loaded vertices is not correct!";
+    EXPECT_EQ(18u,  mesh_.n_edges()) << "The number of loaded edges is not correct!";
+    EXPECT_EQ(12u,  mesh_.n_faces()) << "The number of loaded faces is not correct!";
+    EXPECT_FALSE(opt.vertex_has_color()) << "Colors of the previous file were kept!";
+
+    mesh_.release_vertex_colors();
+}
+
+/*
+ * Write an edited mesh and the connectivity snapshot to the OM format and
+ * read it back. Handles and status have to be restored exactly.
+ */
+TEST_F(OpenMeshLoader, LoadOMConnectivitySnapshot) {
+
+    bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+    ASSERT_TRUE(ok);
+
+    mesh_.request_vertex_status();
+    mesh_.request_edge_status();
+    mesh_.request_face_status();
+
+    // flips and splits, adding the faces again would number the items differently
+    unsigned int n_edited = 0;
+    for (unsigned int i = 0; i < mesh_.n_edges() && n_edited < 200; i += 7) {
+      Mesh::EdgeHandle eh(i);
+      if (n_edited % 2 == 0 && mesh_.is_flip_ok(eh))
+        mesh_.flip(eh);
+      else {
+        Mesh::HalfedgeHandle heh = mesh_.halfedge_handle(eh, 0);
+        mesh_.split(eh, (mesh_.point(mesh_.from_vertex_handle(heh)) + mesh_.point(mesh_.to_vertex_handle(heh))) * 0.5f);
+      }
+      mesh_.status(eh).set_selected(true);
+      ++n_edited;
+    }
+
+    ASSERT_EQ(200u, n_edited);
+
+    for (unsigned int i = 0; i < mesh_.n_faces(); i += 5)
+      mesh_.status(Mesh::FaceHandle(i)).set_tagged(true);
+    for (unsigned int i = 0; i < mesh_.n_vertices(); i += 3)
+      mesh_.status(Mesh::VertexHandle(i)).set_feature(true);
+
+    std::stringstream stream;
+    ok = OpenMesh::IO::write_mesh(mesh_, stream, ".om", OpenMesh::IO::Options::Connectivity);
+
+    ASSERT_TRUE(ok) << "Unable to write the OM stream";
+
+    Mesh mesh;
+    mesh.request_vertex_status();
+    mesh.request_edge_status();
+    mesh.request_face_status();
+
+    OpenMesh::IO::Options opt;
+    ok = OpenMesh::IO::read_mesh(mesh, stream, ".om", opt);
+
+    ASSERT_TRUE(ok) << "Unable to read the OM stream";
+    EXPECT_TRUE(opt.check(OpenMesh::IO::Options::Connectivity)) << "Connectivity chunk not used";
+
+    ASSERT_EQ(mesh_.n_vertices(), mesh.n_vertices()) << "Wrong number of vertices";
+    ASSERT_EQ(mesh_.n_edges(),    mesh.n_edges())    << "Wrong number of edges";
+    ASSERT_EQ(mesh_.n_faces(),    mesh.n_faces())    << "Wrong number of faces";
+
+    for (unsigned int i = 0; i < mesh_.n_vertices(); ++i) {
+      Mesh::VertexHandle vh(i);
+      EXPECT_EQ(mesh_.point(vh), mesh.point(vh)) << "Wrong point at vertex " << i;
+      EXPECT_EQ(mesh_.halfedge_handle(vh), mesh.halfedge_handle(vh)) << "Wrong halfedge at vertex " << i;
+      EXPECT_EQ(mesh_.status(vh).bits(), mesh.status(vh).bits()) << "Wrong status at vertex " << i;
+    }
+
+    for (unsigned int i = 0; i < mesh_.n_halfedges(); ++i) {
+      Mesh::HalfedgeHandle heh(i);
+      EXPECT_EQ(mesh_.to_vertex_handle(heh),     mesh.to_vertex_handle(heh))     << "Wrong vertex at halfedge " << i;
+      EXPECT_EQ(mesh_.next_halfedge_handle(heh), mesh.next_halfedge_handle(heh)) << "Wrong next at halfedge " << i;
+      EXPECT_EQ(mesh_.prev_halfedge_handle(heh), mesh.prev_halfedge_handle(heh)) << "Wrong prev at halfedge " << i;
+      EXPECT_EQ(mesh_.face_handle(heh),          mesh.face_handle(heh))          << "Wrong face at halfedge " << i;
+    }
+
+    for (unsigned int i = 0; i < mesh_.n_edges(); ++i)
+      EXPECT_EQ(mesh_.status(Mesh::EdgeHandle(i)).bits(), mesh.status(Mesh::EdgeHandle(i)).bits()) << "Wrong status at edge " << i;
+
+    for (unsigned int i = 0; i < mesh_.n_faces(); ++i) {
+      Mesh::FaceHandle fh(i);
+      EXPECT_EQ(mesh_.halfedge_handle(fh), mesh.halfedge_handle(fh)) << "Wrong halfedge at face " << i;
+      EXPECT_EQ(mesh_.status(fh).bits(), mesh.status(fh).bits()) << "Wrong status at face " << i;
+    }
+
+    // without the option the faces are added from the face list
+    stream.str("");
+    stream.clear();
+    ok = OpenMesh::IO::write_mesh(mesh_, stream, ".om");
+
+    ASSERT_TRUE(ok) << "Unable to write the OM stream";
+
+    opt = OpenMesh::IO::Options();
+    ok = OpenMesh::IO::read_mesh(mesh, stream, ".om", opt);
+
+    ASSERT_TRUE(ok) << "Unable to read the OM stream";
+    EXPECT_FALSE(opt.check(OpenMesh::IO::Options::Connectivity)) << "Connectivity chunk was not requested";
+    EXPECT_EQ(mesh_.n_vertices(), mesh.n_vertices()) << "Wrong number of vertices";
+    EXPECT_EQ(mesh_.n_faces(),    mesh.n_faces())    << "Wrong number of faces";
+
+    mesh_.release_vertex_status();
+    mesh_.release_edge_status();
+    mesh_.release_face_status();
+}
+
 #endif // INCLUDE GUARD
@@ -1,9 +1,11 @@
-#ifndef INCLUDE_UNITTESTS_DECIMATER_HH
-#define INCLUDE_UNITTESTS_DECIMATER_HH
+#ifndef INCLUDE_UNITTESTS_PROPERTY_HH
+#define INCLUDE_UNITTESTS_PROPERTY_HH
 
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/Utils/PropertyContainer.hh>
 #include <iostream>
+#include <vector>
 class OpenMeshProperties : public OpenMeshBase {
 
     protected:
@@ -24,6 +26,25 @@ class OpenMeshProperties : public OpenMeshBase {
     //Mesh mesh_;  
 };
 
+/*
+ * Custom property type and a property derived from PropertyT<int>
+ */
+struct PropertyTestData { int a; float b; };
+
+class DerivedIntProperty : public OpenMesh::PropertyT<int>
+{
+public:
+  DerivedIntProperty(const std::string& _name) : OpenMesh::PropertyT<int>(_name) {}
+  virtual OpenMesh::PropertyT<int>* clone() const { return new DerivedIntProperty(*this); }
+};
+
+// gives access to PropertyContainer::_add()
+class TestPropertyContainer : public OpenMesh::PropertyContainer
+{
+public:
+  size_t add_property(OpenMesh::BaseProperty* _bp) { return _add(_bp); }
+};
+
 /*
  * ====================================================================
  * Define tests below
@@ -211,4 +232,116 @@ TEST_F(OpenMeshProperties, VertexPropertyCheckBool) {
 
 }
 
+/* Adds many named properties, removes some of them and checks that
+ * lookup by name and type finds the right ones
+ */
+TEST_F(OpenMeshProperties, VertexPropertyLookupByName) {
+
+  mesh_.clear();
+  mesh_.add_vertex(Mesh::Point(0, 0, 0));
+
+  std::vector< OpenMesh::VPropHandleT<int> > handles;
+
+  for (int i = 0; i < 40; ++i) {
+    std::stringstream name;
+    name << "prop" << i;
+    OpenMesh::VPropHandleT<int> handle;
+    mesh_.add_property(handle, name.str());
+    mesh_.property(handle, mesh_.vertex_handle(0)) = i;
+    handles.push_back(handle);
+  }
+
+  // same name, different type
+  OpenMesh::VPropHandleT<double> doubleHandle;
+  mesh_.add_property(doubleHandle, "prop7");
+
+  // remove every third property, this invalidates the handles
+  const int firstIdx = handles[0].idx();
+  for (int i = 0; i < 40; i += 3)
+    mesh_.remove_property(handles[i]);
+
+  for (int i = 0; i < 40; ++i) {
+    std::stringstream name;
+    name << "prop" << i;
+    OpenMesh::VPropHandleT<int> handle;
+    bool found = mesh_.get_property_handle(handle, name.str());
+
+    if (i % 3 == 0) {
+      EXPECT_FALSE(found) << "Found removed property " << name.str();
+    } else {
+      ASSERT_TRUE(found) << "Property " << name.str() << " not found";
+      EXPECT_EQ(handles[i], handle) << "Wrong handle for " << name.str();
+      EXPECT_EQ(i, mesh_.property(handle, mesh_.vertex_handle(0))) << "Wrong value for " << name.str();
+    }
+  }
+
+  OpenMesh::VPropHandleT<double> foundDouble;
+  EXPECT_TRUE(mesh_.get_property_handle(foundDouble, "prop7")) << "Property of other type not found";
+  EXPECT_EQ(doubleHandle, foundDouble) << "Wrong handle for property of other type";
+
+  OpenMesh::VPropHandleT<float> foundFloat;
+  EXPECT_FALSE(mesh_.get_property_handle(foundFloat, "prop8")) << "Found property with wrong type";
+
+  // the removed slot is reused and the new name is found
+  OpenMesh::VPropHandleT<int> reused;
+  mesh_.add_property(reused, "reused");
+  EXPECT_EQ(firstIdx, reused.idx()) << "Slot of removed property not reused";
+
+  OpenMesh::VPropHandleT<int> handle;
+  EXPECT_TRUE(mesh_.get_property_handle(handle, "reused")) << "New property not found";
+  EXPECT_EQ(reused, handle) << "Wrong handle for new property";
+
+  // lookup works on a copy as well
+  Mesh copy = mesh_;
+  EXPECT_TRUE(copy.get_property_handle(handle, "prop5")) << "Property not found in copy";
+  EXPECT_EQ(handles[5], handle) << "Wrong handle in copy";
+}
+
+/* Enumerates the properties of a container by type, a property derived
+ * from PropertyT<int> is found through the dynamic_cast fallback
+ */
+TEST_F(OpenMeshProperties, PropertyContainerHandlesByType) {
+
+  TestPropertyContainer container;
+
+  OpenMesh::BasePropHandleT<int>   int0   = container.add(int(), "int0");
+  OpenMesh::BasePropHandleT<float> float0 = container.add(float(), "float0");
+  OpenMesh::BasePropHandleT<PropertyTestData> custom = container.add(PropertyTestData(), "custom");
+  OpenMesh::BasePropHandleT<int>   int1   = container.add(int(), "int1");
+  OpenMesh::BasePropHandleT<int>   derived(int(container.add_property(new DerivedIntProperty("derived"))));
+  OpenMesh::BasePropHandleT<float> float1 = container.add(float(), "float1");
+
+  std::vector< OpenMesh::BasePropHandleT<int> > ints;
+  container.handles(ints);
+  ASSERT_EQ(3u, ints.size()) << "Wrong number of int properties";
+  EXPECT_EQ(int0,    ints[0]);
+  EXPECT_EQ(int1,    ints[1]);
+  EXPECT_EQ(derived, ints[2]);
+
+  std::vector< OpenMesh::BasePropHandleT<float> > floats;
+  container.handles(floats);
+  ASSERT_EQ(2u, floats.size()) << "Wrong number of float properties";
+  EXPECT_EQ(float0, floats[0]);
+  EXPECT_EQ(float1, floats[1]);
+
+  std::vector< OpenMesh::BasePropHandleT<PropertyTestData> > customs;
+  container.handles(customs);
+  ASSERT_EQ(1u, customs.size()) << "Wrong number of custom properties";
+  EXPECT_EQ(custom, customs[0]);
+
+  EXPECT_TRUE (container.is_type<int>(derived.idx()));
+  EXPECT_FALSE(container.is_type<float>(derived.idx()));
+  EXPECT_FALSE(container.is_type<double>(int0.idx()));
+  EXPECT_FALSE(container.is_type<int>(-1));
+  EXPECT_FALSE(container.is_type<int>(int(container.size())));
+
+  // removed properties are not listed
+  container.remove(int1);
+  ints.clear();
+  container.handles(ints);
+  ASSERT_EQ(2u, ints.size()) << "Removed property listed";
+  EXPECT_EQ(int0,    ints[0]);
+  EXPECT_EQ(derived, ints[1]);
+}
+
 #endif // INCLUDE GUARD
@@ -0,0 +1,144 @@
+#ifndef INCLUDE_UNITTESTS_REMESHER_HH
+#define INCLUDE_UNITTESTS_REMESHER_HH
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Remesher/IsotropicRemesherT.hh>
+
+#include <iostream>
+#include <vector>
+
+class OpenMeshRemesher : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Remesh the cube to half of its mean edge length
+ */
+TEST_F(OpenMeshRemesher, RemeshToTargetLength) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  float mean = 0.0f;
+  for (Mesh::EdgeIter e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it)
+    mean += mesh_.calc_edge_length(e_it);
+  mean /= mesh_.n_edges();
+
+  const float target = 0.5f * mean;
+
+  {
+    OpenMesh::Remesher::IsotropicRemesherT<Mesh> remesher(mesh_);
+    remesher.set_target_length(target);
+
+    remesher.remesh(20);
+
+    EXPECT_GT(remesher.n_splits(), 0u);
+    EXPECT_GT(remesher.n_flips(), 0u);
+
+    // Converged: a second pass finds little to do
+    size_t n_ops = remesher.n_splits() + remesher.n_collapses() + remesher.n_flips();
+    remesher.remesh(20);
+    EXPECT_LT(10 * (remesher.n_splits() + remesher.n_collapses() + remesher.n_flips()), n_ops);
+
+    mesh_.garbage_collection();
+  }
+
+  // Closed, garbage collected two-manifold
+  EXPECT_EQ(2, int(mesh_.n_vertices()) - int(mesh_.n_edges()) + int(mesh_.n_faces()));
+  EXPECT_GT(mesh_.n_faces(), 3u * 15048u);
+
+  unsigned int n_good = 0;
+  for (Mesh::EdgeIter e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it) {
+    float length = mesh_.calc_edge_length(e_it);
+    if (length > 0.5f * target && length < 1.5f * target)
+      ++n_good;
+  }
+  EXPECT_GT(n_good, 95u * mesh_.n_edges() / 100u);
+
+  unsigned int n_regular = 0;
+  for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+    if (mesh_.valence(v_it) == 6)
+      ++n_regular;
+  EXPECT_GT(n_regular, 60u * mesh_.n_vertices() / 100u);
+}
+
+/*
+ * Remeshing around a few vertices stays local, the normals of the
+ * changed region are updated
+ */
+TEST_F(OpenMeshRemesher, RemeshRegion) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  mesh_.request_face_normals();
+  mesh_.request_vertex_normals();
+  mesh_.update_normals();
+
+  OpenMesh::Remesher::IsotropicRemesherT<Mesh> remesher(mesh_);
+  remesher.remesh(20);
+  mesh_.garbage_collection();
+
+  const float target = remesher.target_length();
+  const unsigned int n_faces = mesh_.n_faces();
+
+  // Split the faces around one vertex and remesh around the new vertices
+  Mesh::VertexHandle center(0);
+  std::vector<Mesh::FaceHandle> faces;
+  for (Mesh::VertexFaceIter vf_it = mesh_.vf_iter(center); vf_it; ++vf_it)
+    faces.push_back(vf_it.handle());
+
+  std::vector<Mesh::VertexHandle> region(1, center);
+  for (size_t i = 0; i < faces.size(); ++i) {
+    Mesh::Point p(0, 0, 0);
+    for (Mesh::FaceVertexIter fv_it = mesh_.fv_iter(faces[i]); fv_it; ++fv_it)
+      p += mesh_.point(fv_it) / 3.0f;
+    region.push_back(mesh_.add_vertex(p));
+    mesh_.split(faces[i], region.back());
+  }
+
+  remesher.remesh(region, 20);
+  mesh_.garbage_collection();
+
+  EXPECT_GT(remesher.n_collapses(), 0u);
+  EXPECT_LT(remesher.n_collapses() + remesher.n_flips(), 100u);
+  EXPECT_FLOAT_EQ(target, remesher.target_length());
+  EXPECT_NEAR(float(n_faces), float(mesh_.n_faces()), 0.01f * n_faces);
+  EXPECT_EQ(2, int(mesh_.n_vertices()) - int(mesh_.n_edges()) + int(mesh_.n_faces()));
+
+  unsigned int n_wrong = 0;
+  for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it)
+    if ((mesh_.normal(f_it) - mesh_.calc_face_normal(f_it)).norm() > 1e-4f)
+      ++n_wrong;
+  for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+    if ((mesh_.normal(v_it) - mesh_.calc_vertex_normal(v_it)).norm() > 1e-4f)
+      ++n_wrong;
+  EXPECT_EQ(0u, n_wrong) << "Normals not updated";
+}
+
+#endif // INCLUDE GUARD
@@ -0,0 +1,141 @@
+#ifndef INCLUDE_UNITTESTS_RENDER_BUFFER_HH
+#define INCLUDE_UNITTESTS_RENDER_BUFFER_HH
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/RenderBufferT.hh>
+
+#include <cstring>
+#include <iostream>
+
+class OpenMeshRenderBuffer : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;  
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Positions only: one buffer vertex per mesh vertex, triangles match the faces
+ */
+TEST_F(OpenMeshRenderBuffer, PositionsOnly) {
+
+  typedef OpenMesh::Utils::RenderBufferT<Mesh> RenderBuffer;
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok) << "Unable to load cube1.off";
+
+  RenderBuffer buffer;
+  buffer.build(mesh_, RenderBuffer::NORMALS | RenderBuffer::VERTEX_COLORS);
+
+  // the mesh has neither normals nor colors
+  EXPECT_EQ(0u, buffer.attributes());
+  EXPECT_EQ(12u, buffer.stride());
+  EXPECT_EQ(mesh_.n_vertices(), buffer.n_vertices());
+  ASSERT_EQ(mesh_.n_faces(), buffer.n_triangles());
+
+  size_t n_different = 0;
+  for (unsigned int t = 0; t < buffer.n_triangles(); ++t) {
+    Mesh::FaceVertexIter fv_it = mesh_.fv_iter(buffer.source_face(t));
+    for (unsigned int k = 0; k < 3; ++k, ++fv_it)
+      if (buffer.source_vertex(buffer.indices()[3*t+k]) != fv_it.handle())
+        ++n_different;
+  }
+  EXPECT_EQ(0u, n_different) << "Triangles differ from the faces";
+
+  // move the mesh and update the positions only
+  for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+    mesh_.set_point(v_it, mesh_.point(v_it) * 2.0f);
+
+  buffer.update_positions(mesh_);
+
+  n_different = 0;
+  for (unsigned int i = 0; i < buffer.n_vertices(); ++i) {
+    float p[3];
+    std::memcpy(p, &buffer.vertices()[i * buffer.stride()], sizeof(p));
+    if (Mesh::Point(p[0], p[1], p[2]) != mesh_.point(buffer.source_vertex(i)))
+      ++n_different;
+  }
+  EXPECT_EQ(0u, n_different) << "Positions not updated";
+}
+
+/*
+ * Vertices are split only where the halfedge normals or face colors differ
+ */
+TEST_F(OpenMeshRenderBuffer, SplitByHalfedgeAttributes) {
+
+  typedef OpenMesh::Utils::RenderBufferT<Mesh> RenderBuffer;
+
+  mesh_.request_face_normals();
+  mesh_.request_vertex_normals();
+  mesh_.request_halfedge_normals();
+  mesh_.request_face_colors();
+
+  OpenMesh::IO::Options opt;
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube-minimal.obj", opt);
+
+  ASSERT_TRUE(ok) << "Unable to load cube-minimal.obj";
+
+  mesh_.update_normals();
+
+  RenderBuffer buffer;
+
+  // smooth vertex normals: no split
+  mesh_.release_halfedge_normals();
+  buffer.build(mesh_, RenderBuffer::NORMALS);
+  EXPECT_EQ(8u, buffer.n_vertices());
+  EXPECT_EQ(12, buffer.offset(RenderBuffer::NORMALS));
+
+  // sharp halfedge normals: one vertex per cube side at each corner
+  mesh_.request_halfedge_normals();
+  mesh_.update_halfedge_normals();
+  buffer.build(mesh_, RenderBuffer::NORMALS);
+  EXPECT_EQ(24u, buffer.n_vertices());
+  EXPECT_EQ(12u, buffer.n_triangles());
+
+  // same color on the two triangles of a side: still one vertex per side
+  for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it)
+    mesh_.set_color(f_it, Mesh::Color(f_it.handle().idx() / 2, 0, 0));
+  buffer.build(mesh_, RenderBuffer::NORMALS | RenderBuffer::FACE_COLORS);
+  EXPECT_EQ(24u, buffer.n_vertices());
+  EXPECT_EQ(24u, buffer.offset(RenderBuffer::FACE_COLORS));
+  EXPECT_EQ(-1, buffer.offset(RenderBuffer::VERTEX_COLORS));
+
+  // different color per triangle: split along the side diagonals
+  for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it)
+    mesh_.set_color(f_it, Mesh::Color(f_it.handle().idx(), 0, 0));
+  buffer.build(mesh_, RenderBuffer::NORMALS | RenderBuffer::FACE_COLORS);
+  EXPECT_EQ(36u, buffer.n_vertices());
+
+  // every corner refers to a buffer vertex with the normal of its halfedge
+  size_t n_different = 0;
+  for (Mesh::HalfedgeIter h_it = mesh_.halfedges_begin(); h_it != mesh_.halfedges_end(); ++h_it) {
+    unsigned int i = buffer.buffer_vertex(h_it);
+    float n[3];
+    std::memcpy(n, &buffer.vertices()[i * buffer.stride() + buffer.offset(RenderBuffer::NORMALS)], sizeof(n));
+    if (buffer.source_vertex(i) != mesh_.to_vertex_handle(h_it) ||
+        Mesh::Normal(n[0], n[1], n[2]) != mesh_.normal(h_it.handle()))
+      ++n_different;
+  }
+  EXPECT_EQ(0u, n_different) << "Corner attributes differ";
+}
+
+#endif // INCLUDE_UNITTESTS_RENDER_BUFFER_HH
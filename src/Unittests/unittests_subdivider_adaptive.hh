@@ -0,0 +1,80 @@
+#ifndef INCLUDE_UNITTESTS_SUBDIVIDER_ADAPTIVE_HH
+#define INCLUDE_UNITTESTS_SUBDIVIDER_ADAPTIVE_HH
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Subdivider/Adaptive/Composite/PositionHistoryT.hh>
+
+#include <iostream>
+
+class OpenMeshSubdividerAdaptive : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;  
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Position history falls back to the closest earlier generation
+ */
+TEST_F(OpenMeshSubdividerAdaptive, PositionHistoryFallback) {
+
+  typedef OpenMesh::Vec3f Point;
+  OpenMesh::Subdivider::Adaptive::PositionHistoryT<Point> history;
+
+  // Nothing set, everything is zero
+  EXPECT_EQ(Point(0.0, 0.0, 0.0), history.position(0)) << "Empty history is not zero";
+  EXPECT_EQ(Point(0.0, 0.0, 0.0), history.position(5)) << "Empty history is not zero";
+
+  history.set_position(3, Point(3.0, 0.0, 0.0));
+
+  EXPECT_EQ(Point(0.0, 0.0, 0.0), history.position(2)) << "Generation before first one is not zero";
+  EXPECT_EQ(Point(3.0, 0.0, 0.0), history.position(3)) << "Wrong position of generation 3";
+  EXPECT_EQ(Point(3.0, 0.0, 0.0), history.position(9)) << "Later generations do not fall back to 3";
+
+  // Append with a gap
+  history.set_position(6, Point(6.0, 0.0, 0.0));
+
+  EXPECT_EQ(Point(3.0, 0.0, 0.0), history.position(5)) << "Gap does not fall back to 3";
+  EXPECT_EQ(Point(6.0, 0.0, 0.0), history.position(7)) << "Later generations do not fall back to 6";
+
+  // Prepend
+  history.set_position(1, Point(1.0, 0.0, 0.0));
+
+  EXPECT_EQ(Point(0.0, 0.0, 0.0), history.position(0)) << "Generation 0 is not zero";
+  EXPECT_EQ(Point(1.0, 0.0, 0.0), history.position(2)) << "Generation 2 does not fall back to 1";
+  EXPECT_EQ(Point(3.0, 0.0, 0.0), history.position(3)) << "Prepending changed generation 3";
+
+  // Overwrite inside, only the inherited generations change
+  history.set_position(4, Point(4.0, 0.0, 0.0));
+
+  EXPECT_EQ(Point(3.0, 0.0, 0.0), history.position(3)) << "Overwriting changed generation 3";
+  EXPECT_EQ(Point(4.0, 0.0, 0.0), history.position(5)) << "Generation 5 does not fall back to 4";
+  EXPECT_EQ(Point(6.0, 0.0, 0.0), history.position(6)) << "Overwriting changed generation 6";
+
+  history.set_position(3, Point(-3.0, 0.0, 0.0));
+
+  EXPECT_EQ(Point(-3.0, 0.0, 0.0), history.position(3)) << "Generation 3 not overwritten";
+  EXPECT_EQ(Point(4.0, 0.0, 0.0), history.position(4)) << "Overwriting 3 changed generation 4";
+
+  EXPECT_EQ(Point(0.0, 0.0, 0.0), history.position(-1)) << "Negative generation is not zero";
+}
+
+#endif // INCLUDE_UNITTESTS_SUBDIVIDER_ADAPTIVE_HH
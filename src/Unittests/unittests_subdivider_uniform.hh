@@ -0,0 +1,135 @@
+#ifndef INCLUDE_UNITTESTS_SUBDIVIDER_UNIFORM_HH
+#define INCLUDE_UNITTESTS_SUBDIVIDER_UNIFORM_HH
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Subdivider/Uniform/CompositeSqrt3T.hh>
+#include <OpenMesh/Tools/Subdivider/Uniform/LongestEdgeT.hh>
+#include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
+
+#include <iostream>
+
+typedef OpenMesh::TriMesh_ArrayKernelT<OpenMesh::Subdivider::Uniform::CompositeTraits> CompositeMesh;
+
+/*
+ * Composite sqrt(3) with separate VF and FF passes instead of the fused VFF pass
+ */
+class UnfusedCompositeSqrt3 : public OpenMesh::Subdivider::Uniform::CompositeSqrt3T<CompositeMesh> {
+
+  typedef OpenMesh::Subdivider::Uniform::CompositeSqrt3T<CompositeMesh> Inherited;
+
+  protected:
+
+    void apply_rules(void)
+    {
+      Inherited::Tvv3();
+      Inherited::VF();
+      Inherited::FF();
+      Inherited::FVc(coeffs_);
+    }
+};
+
+class OpenMeshSubdividerUniform : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;  
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * The fused rule pass yields the same points as the separate passes
+ */
+TEST_F(OpenMeshSubdividerUniform, CompositeSqrt3FusedRules) {
+
+  CompositeMesh fused, unfused;
+
+  bool ok = OpenMesh::IO::read_mesh(fused, "cube1.off");
+  ok = ok && OpenMesh::IO::read_mesh(unfused, "cube1.off");
+
+  ASSERT_TRUE(ok) << "Unable to load cube1.off";
+
+  OpenMesh::Subdivider::Uniform::CompositeSqrt3T<CompositeMesh> fused_subdivider;
+  UnfusedCompositeSqrt3 unfused_subdivider;
+
+  fused_subdivider(fused, 2);
+  unfused_subdivider(unfused, 2);
+
+  EXPECT_EQ(67718u, fused.n_vertices()) << "Wrong number of vertices after subdivision";
+  ASSERT_EQ(unfused.n_vertices(), fused.n_vertices()) << "Different number of vertices";
+
+  size_t n_different = 0;
+  for (unsigned int i = 0; i < fused.n_vertices(); ++i)
+    if (fused.point(CompositeMesh::VertexHandle(i)) != unfused.point(CompositeMesh::VertexHandle(i)))
+      ++n_different;
+
+  EXPECT_EQ(0u, n_different) << "Fused and separate rule passes differ";
+}
+
+/*
+ * Refine the cube with the longest edge first and in batches
+ */
+TEST_F(OpenMeshSubdividerUniform, LongestEdgeBatches) {
+
+  Mesh serial, batched;
+
+  bool ok = OpenMesh::IO::read_mesh(serial, "cube1.off");
+  ok = ok && OpenMesh::IO::read_mesh(batched, "cube1.off");
+
+  ASSERT_TRUE(ok) << "Unable to load cube1.off";
+
+  const unsigned int n_faces_before = serial.n_faces();
+
+  float max_length = 0.0f;
+  for (Mesh::EdgeIter e_it = serial.edges_begin(); e_it != serial.edges_end(); ++e_it)
+    max_length = std::max(max_length, serial.calc_edge_length(e_it));
+
+  max_length *= 0.25f;
+
+  OpenMesh::Subdivider::Uniform::LongestEdgeT<Mesh> serial_subdivider;
+  OpenMesh::Subdivider::Uniform::LongestEdgeT<Mesh> batched_subdivider;
+
+  serial_subdivider.set_max_edge_length(max_length);
+  batched_subdivider.set_max_edge_length(max_length);
+  batched_subdivider.set_batch_tolerance(0.2);
+
+  serial_subdivider(serial, 1);
+  batched_subdivider(batched, 1);
+
+  Mesh* meshes[2] = { &serial, &batched };
+
+  for (int i = 0; i < 2; ++i) {
+    Mesh& mesh = *meshes[i];
+
+    EXPECT_TRUE(OpenMesh::Utils::MeshCheckerT<Mesh>(mesh).check()) << "Inconsistent mesh " << i;
+    EXPECT_EQ(2, int(mesh.n_vertices()) - int(mesh.n_edges()) + int(mesh.n_faces())) << "Mesh " << i;
+
+    size_t n_long = 0;
+    for (Mesh::EdgeIter e_it = mesh.edges_begin(); e_it != mesh.edges_end(); ++e_it)
+      if (mesh.calc_edge_length(e_it) > max_length)
+        ++n_long;
+
+    EXPECT_EQ(0u, n_long) << "Edges longer than the maximum in mesh " << i;
+  }
+
+  EXPECT_GT(serial.n_faces(), 8u * n_faces_before);
+  EXPECT_NEAR(float(serial.n_faces()), float(batched.n_faces()), 0.01f * serial.n_faces());
+}
+
+#endif // INCLUDE_UNITTESTS_SUBDIVIDER_UNIFORM_HH
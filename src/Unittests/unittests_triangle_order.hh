@@ -0,0 +1,101 @@
+#ifndef INCLUDE_UNITTESTS_TRIANGLE_ORDER_HH
+#define INCLUDE_UNITTESTS_TRIANGLE_ORDER_HH
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/RenderBufferT.hh>
+#include <OpenMesh/Tools/Utils/TriangleOrder.hh>
+
+#include <cstring>
+#include <vector>
+
+class OpenMeshTriangleOrder : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;  
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Cache, overdraw and fetch optimization keep the triangles and reduce the cache misses
+ */
+TEST_F(OpenMeshTriangleOrder, OptimizeRenderBuffer) {
+
+  typedef OpenMesh::Utils::RenderBufferT<Mesh> RenderBuffer;
+  typedef OpenMesh::Utils::TriangleOrder       TriangleOrder;
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok) << "Unable to load cube1.off";
+
+  RenderBuffer buffer;
+  buffer.build(mesh_, 0);
+
+  const std::vector<unsigned int>&  original = buffer.indices();
+  std::vector<unsigned int>         indices  = original;
+  std::vector<unsigned char>        vertices = buffer.vertices();
+  const unsigned int                n_vertices = buffer.n_vertices();
+
+  TriangleOrder order(16);
+
+  TriangleOrder::CacheStatistics before = order.simulate(indices, n_vertices);
+  EXPECT_EQ(n_vertices, before.n_vertices);
+  EXPECT_EQ(buffer.n_triangles(), before.n_triangles);
+
+  order.optimize_cache(indices, n_vertices);
+  TriangleOrder::CacheStatistics cache = order.simulate(indices, n_vertices);
+
+  order.optimize_overdraw(indices, n_vertices, &vertices[0], buffer.stride());
+  TriangleOrder::CacheStatistics overdraw = order.simulate(indices, n_vertices);
+
+  order.optimize_fetch(indices, n_vertices);
+  order.remap_vertices(vertices, buffer.stride());
+  TriangleOrder::CacheStatistics fetch = order.simulate(indices, n_vertices);
+
+  EXPECT_LT(cache.acmr(), before.acmr());
+  EXPECT_LT(cache.acmr(), 0.8);
+  EXPECT_LT(overdraw.acmr(), 1.05 * 1.05 * cache.acmr());
+  EXPECT_EQ(overdraw.n_misses, fetch.n_misses);
+  EXPECT_GE(fetch.atvr(), 1.0);
+
+  // same triangles with the same orientation, same positions
+  ASSERT_EQ(original.size(), indices.size());
+  size_t n_different = 0;
+  for (unsigned int t = 0; t < buffer.n_triangles(); ++t)
+    for (unsigned int k = 0; k < 3; ++k) {
+      unsigned int old_v = original[3 * order.triangle_order()[t] + k];
+      if (order.vertex_remap()[old_v] != indices[3*t+k] ||
+          std::memcmp(&vertices[indices[3*t+k] * buffer.stride()],
+                      &buffer.vertices()[old_v * buffer.stride()], buffer.stride()) != 0)
+        ++n_different;
+    }
+  EXPECT_EQ(0u, n_different) << "Triangles changed";
+
+  // vertices are numbered in order of first use
+  unsigned int next = 0;
+  for (size_t i = 0; i < indices.size(); ++i) {
+    ASSERT_LE(indices[i], next);
+    if (indices[i] == next)
+      ++next;
+  }
+  EXPECT_EQ(n_vertices, next);
+}
+
+#endif // INCLUDE_UNITTESTS_TRIANGLE_ORDER_HH
@@ -3,9 +3,47 @@
 
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/Utils/ParallelT.hh>
 
 #include <iostream>
 
+/*
+ * Counts the faces and sums up their normals, used with parallel_reduce
+ */
+struct FaceCountBody {
+
+  FaceCountBody(const Mesh& _mesh) : mesh_(&_mesh), count_(0), normal_sum_(0,0,0) {}
+
+  void operator()(const Mesh::FaceRange& _r) {
+    for (int i = 0; i < _r.size(); ++i)
+      if (!_r.is_deleted(i)) {
+        ++count_;
+        normal_sum_ += mesh_->normal(_r[i]);
+      }
+  }
+
+  void join(const FaceCountBody& _other) {
+    count_      += _other.count_;
+    normal_sum_ += _other.normal_sum_;
+  }
+
+  const Mesh*  mesh_;
+  unsigned int count_;
+  Mesh::Normal normal_sum_;
+};
+
+/*
+ * Marks the visited vertices, used with parallel_for_each
+ */
+struct VisitVertex {
+
+  VisitVertex(std::vector<int>& _visits) : visits_(&_visits) {}
+
+  void operator()(Mesh::VertexHandle _vh) const { ++(*visits_)[_vh.idx()]; }
+
+  std::vector<int>* visits_;
+};
+
 class OpenMeshIterators : public OpenMeshBase {
 
     protected:
@@ -261,4 +299,58 @@ TEST_F(OpenMeshIterators, FaceIterEmptyMeshOneDeletedFace) {
 
 }
 
+/*
+ * Splitting a range, parallel_for_each and parallel_reduce with deleted elements
+ */
+TEST_F(OpenMeshIterators, ParallelRanges) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok) << "Unable to load cube1.off";
+
+  // split into blocks covering all faces once, in order
+  std::vector<Mesh::FaceRange> blocks;
+  OpenMesh::split_range(mesh_.face_range(100), blocks);
+
+  int next = 0;
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    EXPECT_EQ(next, blocks[i].begin());
+    EXPECT_FALSE(blocks[i].is_divisible());
+    next = blocks[i].end();
+  }
+  EXPECT_EQ(int(mesh_.n_faces()), next);
+  EXPECT_LT(10u, blocks.size());
+
+  // delete some faces and vertices
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+  for (unsigned int i = 0; i < mesh_.n_vertices(); i += 11)
+    mesh_.delete_vertex(Mesh::VertexHandle(i));
+
+  std::vector<int> visits(mesh_.n_vertices(), 0);
+  OpenMesh::parallel_for_each(mesh_.vertex_range(64), VisitVertex(visits));
+
+  for (unsigned int i = 0; i < mesh_.n_vertices(); ++i)
+    EXPECT_EQ(mesh_.status(Mesh::VertexHandle(i)).deleted() ? 0 : 1, visits[i]) << "Vertex " << i;
+
+  // parallel normal update and reduction match the serial computation
+  mesh_.request_face_normals();
+  mesh_.update_face_normals();
+
+  FaceCountBody serial(mesh_), parallel(mesh_);
+  for (Mesh::FaceIter f_it = mesh_.faces_sbegin(); f_it != mesh_.faces_end(); ++f_it) {
+    EXPECT_EQ(mesh_.calc_face_normal(f_it), mesh_.normal(f_it));
+    ++serial.count_;
+    serial.normal_sum_ += mesh_.calc_face_normal(f_it);
+  }
+
+  OpenMesh::parallel_reduce(mesh_.face_range(256), parallel);
+
+  EXPECT_EQ(serial.count_, parallel.count_);
+  EXPECT_NEAR(serial.normal_sum_[0], parallel.normal_sum_[0], 1e-3);
+  EXPECT_NEAR(serial.normal_sum_[1], parallel.normal_sum_[1], 1e-3);
+  EXPECT_NEAR(serial.normal_sum_[2], parallel.normal_sum_[2], 1e-3);
+}
+
 #endif // INCLUDE GUARD
@@ -107,4 +107,88 @@ TEST_F(OpenMeshNormals, NormalCalculations) {
 
 }
 
+/*
+ * Updating only the normals around edits recorded by the dirty tracking
+ */
+TEST_F(OpenMeshNormals, DirtyNormals) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+  mesh_.request_face_normals();
+  mesh_.request_vertex_normals();
+  mesh_.request_halfedge_normals();
+  mesh_.update_normals();
+
+  mesh_.request_dirty_tracking();
+  EXPECT_TRUE(mesh_.has_dirty_tracking());
+
+  // Some edits: flip, collapse, split and move a vertex
+  Mesh::EdgeHandle eh(100);
+  ASSERT_TRUE(mesh_.is_flip_ok(eh));
+  mesh_.flip(eh);
+
+  Mesh::HalfedgeHandle heh(2000);
+  ASSERT_TRUE(mesh_.is_collapse_ok(heh));
+  mesh_.collapse(heh);
+
+  Mesh::EdgeHandle split_eh(5000);
+  Mesh::HalfedgeHandle split_heh = mesh_.halfedge_handle(split_eh, 0);
+  Mesh::Point mid = (mesh_.point(mesh_.to_vertex_handle(split_heh)) +
+                     mesh_.point(mesh_.from_vertex_handle(split_heh))) * 0.5f;
+  mesh_.split(split_eh, mid + Mesh::Point(0.1f, 0.2f, 0.3f));
+
+  mesh_.set_point(Mesh::VertexHandle(42),
+                  mesh_.point(Mesh::VertexHandle(42)) + Mesh::Point(0, 0, 0.5f));
+
+  EXPECT_FALSE(mesh_.all_dirty());
+  EXPECT_GT(mesh_.dirty_vertices().size(), 0u);
+  EXPECT_LT(mesh_.dirty_vertices().size(), 30u);
+  EXPECT_LT(mesh_.dirty_faces().size(), 30u);
+
+  // Reference: recompute all normals of the non-deleted elements
+  // (update_normals() would also visit the deleted faces)
+  Mesh reference = mesh_;
+  for (Mesh::FaceIter f_it = reference.faces_sbegin(); f_it != reference.faces_end(); ++f_it)
+    reference.update_normal(f_it.handle());
+  for (Mesh::VertexIter v_it = reference.vertices_sbegin(); v_it != reference.vertices_end(); ++v_it)
+    reference.update_normal(v_it.handle());
+  for (Mesh::HalfedgeIter h_it = reference.halfedges_begin(); h_it != reference.halfedges_end(); ++h_it)
+    if (!reference.status(reference.edge_handle(h_it.handle())).deleted())
+      reference.set_normal(h_it.handle(), reference.calc_halfedge_normal(h_it.handle()));
+
+  mesh_.update_dirty_normals();
+  EXPECT_TRUE(mesh_.dirty_vertices().empty());
+  EXPECT_TRUE(mesh_.dirty_faces().empty());
+
+  for (Mesh::FaceIter f_it = mesh_.faces_sbegin(); f_it != mesh_.faces_end(); ++f_it)
+    EXPECT_LT((mesh_.normal(f_it) - reference.normal(f_it)).norm(), 1e-6)
+      << "Wrong normal at face " << f_it.handle().idx();
+
+  for (Mesh::VertexIter v_it = mesh_.vertices_sbegin(); v_it != mesh_.vertices_end(); ++v_it)
+    EXPECT_LT((mesh_.normal(v_it) - reference.normal(v_it)).norm(), 1e-6)
+      << "Wrong normal at vertex " << v_it.handle().idx();
+
+  for (Mesh::EdgeIter e_it = mesh_.edges_sbegin(); e_it != mesh_.edges_end(); ++e_it)
+    for (int i = 0; i < 2; ++i) {
+      Mesh::HalfedgeHandle h = mesh_.halfedge_handle(e_it, i);
+      EXPECT_LT((mesh_.normal(h) - reference.normal(h)).norm(), 1e-6)
+        << "Wrong normal at halfedge " << h.idx();
+    }
+
+  // garbage collection invalidates all recorded handles
+  mesh_.garbage_collection();
+  EXPECT_TRUE(mesh_.all_dirty());
+  mesh_.update_dirty_normals();
+  EXPECT_FALSE(mesh_.all_dirty());
+
+  mesh_.release_dirty_tracking();
+  EXPECT_FALSE(mesh_.has_dirty_tracking());
+}
+
 #endif // INCLUDE GUARD
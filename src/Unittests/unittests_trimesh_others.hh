@@ -3,8 +3,10 @@
 
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
 
 #include <iostream>
+#include <sstream>
 
 class OpenMeshOthers : public OpenMeshBase {
 
@@ -113,4 +115,131 @@ TEST_F(OpenMeshOthers, IsEstimatedFeatureEdge) {
 
 }
 
+/*
+ * Mark sets used concurrently on one mesh give the same result as the
+ * status bit sets
+ */
+TEST_F(OpenMeshOthers, MarkSetsInParallel) {
+
+  mesh_.clear();
+
+  ASSERT_TRUE(OpenMesh::IO::read_mesh(mesh_, "cube1.off")) << "Unable to load cube1.off";
+
+  const int n = int(mesh_.n_vertices());
+
+  // size of the two ring of each vertex, using the status bits
+  std::vector<int> expected(n);
+
+  mesh_.request_vertex_status();
+  {
+    Mesh::VertexStatusSet marked(mesh_);
+    for (int i = 0; i < n; ++i) {
+      std::vector<Mesh::VertexHandle> ring;
+      for (Mesh::VertexVertexIter vv_it = mesh_.vv_iter(mesh_.vertex_handle(i)); vv_it; ++vv_it)
+        for (Mesh::VertexVertexIter vvv_it = mesh_.vv_iter(vv_it.handle()); vvv_it; ++vvv_it)
+          if (!marked.is_in(vvv_it.handle())) {
+            marked.insert(vvv_it.handle());
+            ring.push_back(vvv_it.handle());
+          }
+      expected[i] = int(ring.size());
+      for (size_t j = 0; j < ring.size(); ++j)
+        marked.erase(ring[j]);
+    }
+  }
+  mesh_.release_vertex_status();
+
+  // same with one mark set per thread, status bits are not available
+  std::vector<int> result(n, -1);
+
+#ifdef USE_OPENMP
+  #pragma omp parallel
+#endif
+  {
+    Mesh::VertexMarkSet marked(mesh_);
+
+#ifdef USE_OPENMP
+    #pragma omp for
+#endif
+    for (int i = 0; i < n; ++i) {
+      int count = 0;
+      marked.clear();
+      for (Mesh::ConstVertexVertexIter vv_it = mesh_.cvv_iter(mesh_.vertex_handle(i)); vv_it; ++vv_it)
+        for (Mesh::ConstVertexVertexIter vvv_it = mesh_.cvv_iter(vv_it.handle()); vvv_it; ++vvv_it)
+          if (!marked.is_in(vvv_it.handle())) {
+            marked.insert(vvv_it.handle());
+            ++count;
+          }
+      result[i] = count;
+    }
+  }
+
+  for (int i = 0; i < n; ++i)
+    EXPECT_EQ(expected[i], result[i]) << "Wrong two ring size at vertex " << i;
+
+  // erase and clear
+  Mesh::VertexMarkSet marked(mesh_);
+  marked.insert(mesh_.vertex_handle(3));
+  marked.insert(mesh_.vertex_handle(5));
+  EXPECT_EQ(2u, marked.size());
+  marked.erase(mesh_.vertex_handle(3));
+  EXPECT_FALSE(marked.is_in(mesh_.vertex_handle(3)));
+  EXPECT_TRUE(marked.is_in(mesh_.vertex_handle(5)));
+  marked.clear();
+  EXPECT_FALSE(marked.is_in(mesh_.vertex_handle(5)));
+  EXPECT_EQ(0u, marked.size());
+}
+
+/*
+ * Mesh checker reports all violations with their handles, also when
+ * checking only the elements changed since a mark
+ */
+TEST_F(OpenMeshOthers, MeshCheckerErrors) {
+
+  typedef OpenMesh::Utils::MeshCheckerT<Mesh> Checker;
+
+  mesh_.clear();
+
+  ASSERT_TRUE(OpenMesh::IO::read_mesh(mesh_, "cube1.off")) << "Unable to load cube1.off";
+
+  Checker checker(mesh_);
+  Checker::Errors errors;
+
+  EXPECT_TRUE(checker.check(Checker::CHECK_ALL, errors)) << "Valid mesh reported as broken";
+  EXPECT_EQ(0u, errors.size()) << "Errors reported for valid mesh";
+
+  Checker::Mark mark = checker.mark();
+
+  // Nothing changed, nothing to check
+  EXPECT_TRUE(checker.check(Checker::CHECK_ALL, errors, mark));
+  EXPECT_EQ(0u, errors.size()) << "Errors reported for unchanged mesh";
+
+  // Make one halfedge degenerated
+  Mesh::HalfedgeHandle hh = mesh_.halfedge_handle(100);
+  mesh_.set_vertex_handle(hh, mesh_.from_vertex_handle(hh));
+
+  EXPECT_FALSE(checker.check(Checker::CHECK_ALL, errors)) << "Broken mesh reported as valid";
+
+  Checker::Errors changed;
+  EXPECT_FALSE(checker.check(Checker::CHECK_ALL, changed, mark)) << "Broken mesh reported as valid since mark";
+
+  bool found_full = false, found_changed = false;
+  for (size_t i = 0; i < errors.size(); ++i)
+    found_full |= (errors[i].type == Checker::HALFEDGE_DEGENERATED && errors[i].hh == hh);
+  for (size_t i = 0; i < changed.size(); ++i)
+    found_changed |= (changed[i].type == Checker::HALFEDGE_DEGENERATED && changed[i].hh == hh);
+
+  EXPECT_TRUE(found_full) << "Degenerated halfedge not reported";
+  EXPECT_TRUE(found_changed) << "Degenerated halfedge not reported since mark";
+  EXPECT_LE(changed.size(), errors.size()) << "Incremental check reported more than full check";
+
+  // Stream interface reports the same violations
+  std::ostringstream stream;
+  EXPECT_FALSE(checker.check(Checker::CHECK_ALL, stream));
+
+  std::ostringstream expected;
+  for (size_t i = 0; i < errors.size(); ++i)
+    Checker::print(errors[i], expected);
+  EXPECT_EQ(expected.str(), stream.str()) << "Stream output differs from error list";
+}
+
 #endif // INCLUDE GUARD
@@ -0,0 +1,208 @@
+#ifndef INCLUDE_UNITTESTS_VDPM_ANALYZER_HH
+#define INCLUDE_UNITTESTS_VDPM_ANALYZER_HH
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/VDPM/VHierarchyAnalyzerT.hh>
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+class OpenMeshVDPMAnalyzer : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Build a small vertex hierarchy by passes of independent collapses and
+ * compare the bottom-up attributes with the ones computed from the leaves
+ */
+TEST_F(OpenMeshVDPMAnalyzer, BottomUpAttributes) {
+
+  using OpenMesh::VDPM::VHierarchy;
+  using OpenMesh::VDPM::VHierarchyNode;
+  using OpenMesh::VDPM::VHierarchyNodeHandle;
+  using OpenMesh::VDPM::VertexSplit;
+  using OpenMesh::VDPM::VertexSplitContainer;
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+
+  // Progressive mesh: each pass collapses edges with untouched 1-rings
+  VertexSplitContainer collapses;
+
+  for (int pass = 0; pass < 6; ++pass) {
+    std::vector<bool> locked(mesh_.n_vertices(), false);
+
+    for (Mesh::EdgeIter e_it = mesh_.edges_sbegin(); e_it != mesh_.edges_end(); ++e_it) {
+      if (mesh_.status(e_it).deleted())
+        continue;
+
+      Mesh::HalfedgeHandle h = mesh_.halfedge_handle(e_it, 0);
+      Mesh::HalfedgeHandle o = mesh_.opposite_halfedge_handle(h);
+
+      VertexSplit vsplit;
+      vsplit.v0 = mesh_.from_vertex_handle(h);
+      vsplit.v1 = mesh_.to_vertex_handle(h);
+
+      if (locked[vsplit.v0.idx()] || locked[vsplit.v1.idx()] || !mesh_.is_collapse_ok(h))
+        continue;
+
+      if (!mesh_.is_boundary(h))
+        vsplit.vl = mesh_.to_vertex_handle(mesh_.next_halfedge_handle(h));
+      if (!mesh_.is_boundary(o))
+        vsplit.vr = mesh_.to_vertex_handle(mesh_.next_halfedge_handle(o));
+
+      for (Mesh::VertexVertexIter vv_it = mesh_.vv_iter(vsplit.v0); vv_it; ++vv_it)
+        locked[vv_it.handle().idx()] = true;
+      for (Mesh::VertexVertexIter vv_it = mesh_.vv_iter(vsplit.v1); vv_it; ++vv_it)
+        locked[vv_it.handle().idx()] = true;
+
+      mesh_.collapse(h);
+      collapses.push_back(vsplit);
+    }
+  }
+
+  ASSERT_GT(collapses.size(), 2000u);
+
+  // Vertex hierarchy: roots are the remaining vertices
+  VHierarchy vhierarchy;
+  std::vector<VHierarchyNodeHandle> node_of(mesh_.n_vertices());
+
+  unsigned int n_roots = 0;
+  for (Mesh::VertexIter v_it = mesh_.vertices_sbegin(); v_it != mesh_.vertices_end(); ++v_it)
+    ++n_roots;
+  vhierarchy.set_num_roots(n_roots);
+
+  unsigned int root = 0;
+  for (Mesh::VertexIter v_it = mesh_.vertices_sbegin(); v_it != mesh_.vertices_end(); ++v_it) {
+    VHierarchyNodeHandle node_handle = vhierarchy.add_node();
+    vhierarchy.node(node_handle).set_index(vhierarchy.generate_node_index(root++, 1));
+    vhierarchy.node(node_handle).set_vertex_handle(v_it.handle());
+    node_of[v_it.handle().idx()] = node_handle;
+  }
+
+  VertexSplitContainer vsplits(collapses.rbegin(), collapses.rend());
+  std::vector<VHierarchyNodeHandle> parents;
+
+  for (size_t i = 0; i < vsplits.size(); ++i) {
+    VHierarchyNodeHandle parent_handle = node_of[vsplits[i].v1.idx()];
+    vhierarchy.make_children(parent_handle);
+    parents.push_back(parent_handle);
+
+    VHierarchyNodeHandle lchild_handle = vhierarchy.lchild_handle(parent_handle);
+    VHierarchyNodeHandle rchild_handle = vhierarchy.rchild_handle(parent_handle);
+    vhierarchy.node(lchild_handle).set_vertex_handle(vsplits[i].v0);
+    vhierarchy.node(rchild_handle).set_vertex_handle(vsplits[i].v1);
+    node_of[vsplits[i].v0.idx()] = lchild_handle;
+    node_of[vsplits[i].v1.idx()] = rchild_handle;
+  }
+
+  // Analyze on the full resolution mesh
+  Mesh fine;
+  ok = OpenMesh::IO::read_mesh(fine, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  fine.request_vertex_status();
+  fine.request_edge_status();
+  fine.request_face_status();
+
+  OpenMesh::VDPM::VHierarchyAnalyzerT<Mesh> analyzer(fine, vhierarchy);
+  analyzer.analyze(vsplits);
+
+  // The mesh is left at base resolution
+  unsigned int n_remaining = 0;
+  for (Mesh::VertexIter v_it = fine.vertices_sbegin(); v_it != fine.vertices_end(); ++v_it)
+    ++n_remaining;
+  EXPECT_EQ(n_roots, n_remaining);
+
+  // Fundamental cut nodes of all splits inside the mesh
+  for (size_t i = 0; i < vsplits.size(); ++i) {
+    VHierarchyNodeHandle parent_handle = parents[i];
+
+    if (vsplits[i].vl.is_valid()) {
+      EXPECT_TRUE(vhierarchy.fund_lcut_index(parent_handle).is_valid(vhierarchy.tree_id_bits()));
+    }
+    if (vsplits[i].vr.is_valid()) {
+      EXPECT_TRUE(vhierarchy.fund_rcut_index(parent_handle).is_valid(vhierarchy.tree_id_bits()));
+    }
+  }
+
+  // Compare with the values taken over all leaves
+  unsigned int n_exact = 0;
+
+  for (unsigned int i = 0; i < vhierarchy.num_nodes(); ++i) {
+    VHierarchyNodeHandle node_handle(i);
+    const VHierarchyNode& node = vhierarchy.node(node_handle);
+
+    EXPECT_GE(node.mue_square(), 0.0f);
+    EXPECT_GE(node.sigma_square(), 0.0f);
+
+    if (node.is_leaf()) {
+      EXPECT_EQ(0.0f, node.radius());
+      continue;
+    }
+
+    std::vector<VHierarchyNodeHandle> stack(1, node_handle);
+    float radius = 0.0f, angle = 0.0f;
+    Mesh::Point p = fine.point(node.vertex_handle());
+
+    while (!stack.empty()) {
+      VHierarchyNodeHandle h = stack.back();
+      stack.pop_back();
+
+      if (vhierarchy.is_leaf_node(h)) {
+        const VHierarchyNode& leaf = vhierarchy.node(h);
+        float d = dot(node.normal(), leaf.normal());
+        radius = std::max(radius, (fine.point(leaf.vertex_handle()) - p).length());
+        angle  = std::max(angle, acosf(std::max(-1.0f, std::min(1.0f, d))));
+      } else {
+        stack.push_back(vhierarchy.lchild_handle(h));
+        stack.push_back(vhierarchy.rchild_handle(h));
+      }
+    }
+
+    float sin_square = sinf(std::min(angle, float(M_PI_2)));
+    sin_square *= sin_square;
+
+    EXPECT_GE(node.radius(), radius - 1e-5f) << "Radius of node " << i;
+    EXPECT_GE(node.sin_square(), sin_square - 1e-4f) << "Cone of node " << i;
+
+    if (vhierarchy.is_leaf_node(vhierarchy.lchild_handle(node_handle)) &&
+        vhierarchy.is_leaf_node(vhierarchy.rchild_handle(node_handle))) {
+      EXPECT_NEAR(radius, node.radius(), 1e-5f) << "Radius of node " << i;
+      EXPECT_NEAR(sin_square, node.sin_square(), 1e-4f) << "Cone of node " << i;
+      ++n_exact;
+    }
+  }
+
+  EXPECT_GT(n_exact, 0u);
+}
+
+#endif // INCLUDE GUARD
@@ -0,0 +1,155 @@
+#ifndef INCLUDE_UNITTESTS_VECTOR_SIMD_HH
+#define INCLUDE_UNITTESTS_VECTOR_SIMD_HH
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/Geometry/AlignedVectorT.hh>
+#include <OpenMesh/Core/IO/SR_store.hh>
+
+#include <sstream>
+#include <cstdlib>
+
+class OpenMeshVectorSIMD : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+            srand(7);
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+        template <class Vec>
+        Vec random_vector() {
+            Vec v;
+            for (size_t i = 0; i < Vec::size(); ++i)
+              v[i] = typename Vec::value_type(rand()) / typename Vec::value_type(RAND_MAX) - 0.5f;
+            return v;
+        }
+
+        // Compare the operators of Vec with the ones computed per component
+        template <class Vec>
+        void check_vector_operators() {
+            typedef typename Vec::value_type Scalar;
+            const size_t N = Vec::size();
+
+            for (int k = 0; k < 100; ++k) {
+              Vec a = random_vector<Vec>(), b = random_vector<Vec>();
+              Scalar s = Scalar(rand()) / Scalar(RAND_MAX) + Scalar(0.5);
+
+              Vec sum = a + b, diff = a - b, prod = a * b, quot = a / b;
+              Vec scaled = a * s, divided = a / s, neg = -a;
+              Vec min_v(a), max_v(a);
+              min_v.minimize(b);
+              max_v.maximize(b);
+
+              Scalar dot(0), sqrnorm(0);
+              for (size_t i = 0; i < N; ++i) {
+                EXPECT_EQ(a[i] + b[i], sum[i]);
+                EXPECT_EQ(a[i] - b[i], diff[i]);
+                EXPECT_EQ(a[i] * b[i], prod[i]);
+                EXPECT_EQ(a[i] / b[i], quot[i]);
+                EXPECT_EQ(a[i] * s, scaled[i]);
+                EXPECT_EQ(a[i] / s, divided[i]);
+                EXPECT_EQ(-a[i], neg[i]);
+                EXPECT_EQ(std::min(a[i], b[i]), min_v[i]);
+                EXPECT_EQ(std::max(a[i], b[i]), max_v[i]);
+                dot     += a[i] * b[i];
+                sqrnorm += a[i] * a[i];
+              }
+
+              EXPECT_EQ(dot, a | b);
+              EXPECT_EQ(sqrnorm, a.sqrnorm());
+
+              Vec c(a);
+              c += b;
+              EXPECT_TRUE(c == sum);
+              c -= b;
+              EXPECT_EQ(a + b - b, c);
+              c[N-1] += Scalar(1);
+              EXPECT_TRUE(c != a + b - b) << "Last component is not compared";
+            }
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * The SIMD versions of the Vec4f/Vec4d operators compute the same values
+ * as the generic code
+ */
+TEST_F(OpenMeshVectorSIMD, Vec4OperatorsMatchComponents) {
+  check_vector_operators<OpenMesh::Vec4f>();
+  check_vector_operators<OpenMesh::Vec4d>();
+  check_vector_operators<OpenMesh::Vec3f>();
+}
+
+/*
+ * The padded vectors give the same results as VectorT<Scalar,3>, keep the
+ * padding zero and are stored without it
+ */
+TEST_F(OpenMeshVectorSIMD, AlignedVec3MatchesVec3) {
+
+  check_vector_operators<OpenMesh::Vec3fa>();
+  check_vector_operators<OpenMesh::Vec3da>();
+
+  EXPECT_EQ(16u, sizeof(OpenMesh::Vec3fa));
+  EXPECT_EQ(3u,  OpenMesh::Vec3fa::size());
+
+  for (int k = 0; k < 100; ++k) {
+    OpenMesh::Vec3f  a = random_vector<OpenMesh::Vec3f>(), b = random_vector<OpenMesh::Vec3f>();
+    OpenMesh::Vec3fa aa(a), ba(b);
+
+    EXPECT_EQ(a % b, OpenMesh::Vec3f(aa % ba));
+    EXPECT_EQ(a.norm(), aa.norm());
+    EXPECT_EQ(a.normalized(), OpenMesh::Vec3f(aa.normalized()));
+    EXPECT_EQ(((b - a) % (a + b)).normalize(), OpenMesh::Vec3f(((ba - aa) % (aa + ba)).normalize()));
+
+    OpenMesh::Vec3fa q = aa / ba;
+    q /= 0.0f;
+    EXPECT_EQ(0.0f, q.data()[3]) << "Padding is not zero";
+    EXPECT_EQ(0.0f, (aa % ba).data()[3]) << "Padding is not zero";
+  }
+
+  // binary representation of VectorT<Scalar,3>
+  OpenMesh::Vec3fa v(1.0f, 2.0f, 3.0f), w;
+  std::stringstream stream;
+
+  EXPECT_EQ(12u, OpenMesh::IO::store(stream, v, false));
+  EXPECT_EQ(12u, stream.str().size());
+
+  OpenMesh::Vec3f u;
+  OpenMesh::IO::restore(stream, u, false);
+  EXPECT_EQ(OpenMesh::Vec3f(1.0f, 2.0f, 3.0f), u);
+
+  // storage in a property
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube-minimal.obj");
+  ASSERT_TRUE(ok);
+
+  OpenMesh::VPropHandleT<OpenMesh::Vec3fa> points;
+  mesh_.add_property(points);
+
+  for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+    mesh_.property(points, v_it) = mesh_.point(v_it);
+
+  for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
+    EXPECT_EQ(0u, size_t(&mesh_.property(points, v_it)) % __alignof__(OpenMesh::Vec3fa));
+    EXPECT_EQ(mesh_.point(v_it), OpenMesh::Vec3f(mesh_.property(points, v_it)));
+  }
+
+  mesh_.remove_property(points);
+}
+
+#endif // INCLUDE GUARD